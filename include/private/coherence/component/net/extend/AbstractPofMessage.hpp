@@ -47,6 +47,24 @@ class COH_EXPORT AbstractPofMessage
     // Evolvable, Portable used over EvolvablePortable as it is more efficient
     // to do "flat" instance of checks, and this one is done on every message
     {
+    // ----- Priority definition --------------------------------------------
+
+    public:
+        /**
+        * The priority with which a Message is written to its Connection,
+        * relative to other Messages waiting to be written.
+        *
+        * @since 15.1.1.0.0
+        */
+        typedef enum
+            {
+            priority_high   = 0, // latency critical, e.g. heartbeats
+            priority_normal = 1, // the default
+            priority_bulk   = 2, // large Messages which may be deferred
+            priority_count  = 3  // the number of priorities
+            } Priority;
+
+
     // ----- constructors ---------------------------------------------------
 
     protected:
@@ -149,6 +167,25 @@ class COH_EXPORT AbstractPofMessage
         */
         virtual void setImplVersion(int32_t nVersion);
 
+        /**
+        * Return the priority of this Message, one of the Priority enum
+        * values.
+        *
+        * @return the priority
+        *
+        * @since 15.1.1.0.0
+        */
+        virtual int32_t getPriority() const;
+
+        /**
+        * Set the priority of this Message.
+        *
+        * @param nPriority  the priority, one of the Priority enum values
+        *
+        * @since 15.1.1.0.0
+        */
+        virtual void setPriority(int32_t nPriority);
+
 
     // ----- data members ---------------------------------------------------
 
@@ -175,6 +212,11 @@ class COH_EXPORT AbstractPofMessage
         * being deserialized.
         */
         FinalView<Binary> f_vBinFuture;
+
+        /**
+        * The priority of this Message.
+        */
+        int32_t m_nPriority;
     };
 
 COH_CLOSE_NAMESPACE4
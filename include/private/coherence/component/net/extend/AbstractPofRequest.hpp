@@ -68,6 +68,19 @@ class COH_EXPORT AbstractPofRequest
         */
         bool isIncoming() const;
 
+        /**
+        * Called once the Status of this Request has been closed, either by
+        * the receipt of a Response or by being canceled, after the Status
+        * has been released by the Channel.
+        *
+        * This method is called on the thread that closed the Status, which
+        * is typically the Connection manager thread, and must therefore
+        * not block. The default implementation does nothing.
+        *
+        * @since 15.1.1.0.0
+        */
+        virtual void onCompleted();
+
 
     // ----- Request interface ----------------------------------------------
 
@@ -268,6 +281,14 @@ class COH_EXPORT AbstractPofRequest
                 */
                 virtual void onCompletion();
 
+                /**
+                * Notify the Request represented by this Status that the
+                * Status has been closed and released by the Channel.
+                *
+                * @since 15.1.1.0.0
+                */
+                virtual void notifyCompleted();
+
             // ----- accessors ------------------------------------------
 
             public:
@@ -295,6 +316,18 @@ class COH_EXPORT AbstractPofRequest
                 */
                 virtual int64_t getInitTimeMillis() const;
 
+                /**
+                * Return the time (in milliseconds) after which nothing is
+                * waiting for the Response to the Request, or 0 if there is
+                * no such deadline. A Request which has passed its deadline
+                * may be dropped before it is sent, and its Status canceled.
+                *
+                * @return the deadline
+                *
+                * @since 15.1.1.0.0
+                */
+                virtual int64_t getDeadlineMillis() const;
+
                 /**
                 * Return the PofChannel associated with this Status.
                 *
@@ -337,6 +370,15 @@ class COH_EXPORT AbstractPofRequest
                 */
                 virtual void setDefaultTimeoutMillis(int64_t cMillis);
 
+                /**
+                * Set the deadline of the Request.
+                *
+                * @param ldtDeadline  the deadline (in milliseconds), or 0
+                *
+                * @since 15.1.1.0.0
+                */
+                virtual void setDeadlineMillis(int64_t ldtDeadline);
+
 
             // ----- data members ---------------------------------------
 
@@ -371,6 +413,12 @@ class COH_EXPORT AbstractPofRequest
                 */
                 int64_t m_ldtInitTimeMillis;
 
+                /**
+                * The time (in milliseconds) after which nothing is waiting
+                * for the Response, or 0.
+                */
+                Volatile<int64_t> m_ldtDeadlineMillis;
+
                 /**
                 * The Request represented by this Status.
                 */
@@ -210,6 +210,38 @@ class COH_EXPORT PofChannel
         */
         virtual void openInternal();
 
+        /**
+        * Cancel and unregister every pending Request which has passed its
+        * deadline, and report the earliest deadline of the remaining ones
+        * to the ConnectionManager (see Peer::onRequestDeadline). This method
+        * is called on the service thread.
+        *
+        * @param ldtNow  the current time in milliseconds
+        *
+        * @return the number of Requests which were canceled
+        *
+        * @see AbstractPofRequest::Status#getDeadlineMillis
+        *
+        * @since 15.1.1.0.0
+        */
+        virtual int32_t purgeExpiredRequests(int64_t ldtNow);
+
+        /**
+        * Asynchronously send a Request to the peer endpoint through this
+        * Channel, giving its Status a deadline after which it is canceled
+        * with a RequestTimeoutException unless its Response has arrived.
+        *
+        * @param hRequest  the Request to send
+        * @param cMillis   the request timeout in milliseconds, -1 for the
+        *                  default request timeout, or 0 for none
+        *
+        * @return the Status of the Request
+        *
+        * @since 15.1.1.0.0
+        */
+        virtual Request::Status::Handle send(Request::Handle hRequest,
+                int64_t cMillis);
+
         /**
         * Called when a Message is received via this Channel. This method is
         * called on the service thread ("Channel0" Messages) or on a daemon
@@ -465,6 +497,19 @@ class COH_EXPORT PofChannel
         */
         virtual Request::Status::Handle registerRequest(Request::Handle hRequest);
 
+        /**
+        * Give the Status of a registered Request the deadline implied by
+        * the given request timeout, and report it to the ConnectionManager.
+        *
+        * @param hStatus  the Status of the Request
+        * @param cMillis  the request timeout in milliseconds, -1 for the
+        *                 default request timeout, or 0 for none
+        *
+        * @since 15.1.1.0.0
+        */
+        virtual void setRequestDeadline(Request::Status::Handle hStatus,
+                int64_t cMillis);
+
         /**
         * Unregister the given Status from the Request Map.
         *
@@ -307,6 +307,20 @@ class COH_EXPORT PofConnection
         */
         virtual void send(WriteBuffer::View vwb);
 
+        /**
+        * Send the given WriteBuffer over this Connection, ahead of any
+        * waiting WriteBuffers of a lower priority.
+        *
+        * @param vwb        the WriteBuffer to send
+        * @param nPriority  the priority of the WriteBuffer, one of the
+        *                   AbstractPofMessage::Priority enum values
+        *
+        * @throws ConnectionException on fatal Connection error
+        *
+        * @since 15.1.1.0.0
+        */
+        virtual void send(WriteBuffer::View vwb, int32_t nPriority);
+
         /*
         * Unregister the given Channel from the ChannelArray.
         *
@@ -10,6 +10,7 @@
 #include "coherence/lang.ns"
 
 #include "coherence/net/Invocable.hpp"
+#include "coherence/net/InvocationObserver.hpp"
 #include "coherence/net/InvocationService.hpp"
 #include "coherence/net/ServiceInfo.hpp"
 #include "coherence/run/xml/XmlElement.hpp"
@@ -22,6 +23,7 @@
 COH_OPEN_NAMESPACE4(coherence,component,net,extend)
 
 using coherence::net::Invocable;
+using coherence::net::InvocationObserver;
 using coherence::net::InvocationService;
 using coherence::net::ServiceInfo;
 using coherence::net::messaging::Channel;
@@ -66,6 +68,18 @@ class COH_EXPORT RemoteInvocationService
         */
         virtual Map::View query(Invocable::Handle hTask, Set::View vSetMembers);
 
+        /**
+        * {@inheritDoc}
+        *
+        * The InvocationRequest is sent without waiting for its Response, so
+        * the request timeout does not apply; an invocation that has not
+        * completed when the Channel is closed is reported to the observer
+        * through memberLeft. Exceptions raised before the request could be sent are
+        * thrown to the caller rather than reported to the observer.
+        */
+        virtual void execute(Invocable::Handle hTask, Set::View vSetMembers,
+                InvocationObserver::Handle hObserver);
+
 
     // ----- ServiceInfo interface ------------------------------------------
 
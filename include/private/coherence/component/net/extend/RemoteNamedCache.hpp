@@ -2440,6 +2440,41 @@ class COH_EXPORT RemoteNamedCache
         virtual MapListener::Handle instantiateConverterListener(
                 MapListener::Handle hListener);
 
+        /**
+        * Determine the filter under which the given filter-based listener
+        * is registered with the proxy.
+        * <p>
+        * A standard SemiLiteListener is registered with the given filter
+        * wrapped in a MapEventTransformerFilter that applies the
+        * SemiLiteEventTransformer, so that the proxy does not send old
+        * values that the listener will never read.
+        *
+        * @param vListener  the MapListener being added or removed
+        * @param vFilter    the filter the listener was registered with
+        * @param fLite      true if the listener is registered as lite
+        *
+        * @return the filter to register the listener with
+        *
+        * @since 15.1.1.0.0
+        */
+        virtual Filter::View getListenerFilter(MapListener::View vListener,
+                Filter::View vFilter, bool fLite) const;
+
+        /**
+        * Determine whether the given converter listener is registered with
+        * the BinaryCache under the given filter.
+        *
+        * @param hConvListener  the listener returned by
+        *                       instantiateConverterListener
+        * @param vFilter        the filter to check
+        *
+        * @return true if the listener is registered under the filter
+        *
+        * @since 15.1.1.0.0
+        */
+        bool isListenerRegistered(MapListener::Handle hConvListener,
+                Filter::View vFilter) const;
+
         /**
          * Instantiate a Binary cache view for this RemoteNamedCache.
          */
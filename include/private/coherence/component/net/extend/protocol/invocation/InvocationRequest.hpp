@@ -12,6 +12,8 @@
 #include "coherence/io/pof/PofReader.hpp"
 #include "coherence/io/pof/PofWriter.hpp"
 #include "coherence/net/Invocable.hpp"
+#include "coherence/net/InvocationObserver.hpp"
+#include "coherence/net/Member.hpp"
 
 #include "private/coherence/component/net/extend/AbstractPofResponse.hpp"
 #include "private/coherence/component/net/extend/protocol/invocation/InvocationServiceRequest.hpp"
@@ -24,12 +26,18 @@ using coherence::component::net::extend::AbstractPofResponse;
 using coherence::io::pof::PofReader;
 using coherence::io::pof::PofWriter;
 using coherence::net::Invocable;
+using coherence::net::InvocationObserver;
+using coherence::net::Member;
 
 
 /**
 * InvocationService::query(Invocable::Handle hTask, Set::View vSetMembers)
 * Request message.
 *
+* The same message is used by InvocationService::execute, in which case the
+* outcome of the Request is reported to the configured InvocationObserver
+* once the Response arrives, rather than to a thread blocked waiting for it.
+*
 * @author jh  2008.02.15
 */
 class COH_EXPORT InvocationRequest
@@ -79,6 +87,19 @@ class COH_EXPORT InvocationRequest
         virtual String::View getDescription() const;
 
 
+    // ----- AbstractPofRequest interface -----------------------------------
+
+    public:
+        /**
+        * {@inheritDoc}
+        *
+        * If an InvocationObserver has been configured, the outcome of this
+        * Request is dispatched to it on the event dispatcher thread of the
+        * Connection manager.
+        */
+        virtual void onCompleted();
+
+
     // ----- internal methods -----------------------------------------------
 
     protected:
@@ -105,6 +126,47 @@ class COH_EXPORT InvocationRequest
         */
         virtual void setTask(Invocable::View vTask);
 
+        /**
+        * Return the InvocationObserver to notify once this Request has
+        * completed.
+        *
+        * @return the InvocationObserver, or NULL if this Request is
+        *         processed synchronously
+        *
+        * @since 15.1.1.0.0
+        */
+        virtual InvocationObserver::Handle getObserver();
+
+        /**
+        * Configure the InvocationObserver to notify once this Request has
+        * completed.
+        *
+        * @param hObserver  the InvocationObserver
+        *
+        * @since 15.1.1.0.0
+        */
+        virtual void setObserver(InvocationObserver::Handle hObserver);
+
+        /**
+        * Return the Member reported to the InvocationObserver as having
+        * executed the task.
+        *
+        * @return the Member
+        *
+        * @since 15.1.1.0.0
+        */
+        virtual Member::View getMember() const;
+
+        /**
+        * Configure the Member reported to the InvocationObserver as having
+        * executed the task.
+        *
+        * @param vMember  the Member
+        *
+        * @since 15.1.1.0.0
+        */
+        virtual void setMember(Member::View vMember);
+
 
     // ----- constants ------------------------------------------------------
 
@@ -122,6 +184,16 @@ class COH_EXPORT InvocationRequest
         * The Invocable task to execute.
         */
         FinalView<Invocable> f_vTask;
+
+        /**
+        * The InvocationObserver to notify once this Request has completed.
+        */
+        FinalHandle<InvocationObserver> f_hObserver;
+
+        /**
+        * The Member reported to the InvocationObserver.
+        */
+        FinalView<Member> f_vMember;
     };
 
 COH_CLOSE_NAMESPACE6
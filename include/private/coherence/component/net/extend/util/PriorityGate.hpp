@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2000, 2026, Oracle and/or its affiliates.
+ *
+ * Licensed under the Universal Permissive License v 1.0 as shown at
+ * http://oss.oracle.com/licenses/upl.
+ */
+#ifndef COH_PRIORITY_GATE_HPP
+#define COH_PRIORITY_GATE_HPP
+
+#include "coherence/lang.ns"
+
+COH_OPEN_NAMESPACE5(coherence,component,net,extend,util)
+
+
+/**
+* PriorityGate admits one thread at a time, choosing among the waiting
+* threads by lane. Lane 0 is the highest priority; when the gate is exited
+* a thread waiting in the lowest numbered non-empty lane is admitted next.
+*
+* To prevent the starvation of lower priority lanes, once a waiting thread
+* has been bypassed by the specified number of consecutive admissions from
+* higher priority lanes, a thread from the lowest priority waiting lane is
+* admitted next.
+*
+* Threads within the same lane are admitted in no particular order.
+*
+* @since 15.1.1.0.0
+*/
+class COH_EXPORT PriorityGate
+    : public class_spec<PriorityGate>
+    {
+    friend class factory<PriorityGate>;
+
+    // ----- constructors ---------------------------------------------------
+
+    protected:
+        /**
+        * Create a new PriorityGate.
+        *
+        * @param cLanes      the number of lanes
+        * @param cMaxBypass  the number of consecutive times a waiting thread
+        *                    may be bypassed by a higher priority lane
+        */
+        PriorityGate(int32_t cLanes, int32_t cMaxBypass);
+
+    private:
+        /**
+        * Blocked copy constructor.
+        */
+        PriorityGate(const PriorityGate&);
+
+
+    // ----- PriorityGate interface -----------------------------------------
+
+    public:
+        /**
+        * Wait until the calling thread is admitted to the gate. A lane
+        * outside of the configured range is treated as the closest valid
+        * lane.
+        * <p>
+        * The wait cannot be interrupted; if the thread is interrupted while
+        * waiting its interrupt flag is set again once it has been admitted.
+        *
+        * @param nLane  the lane in which to wait
+        */
+        virtual void enter(int32_t nLane);
+
+        /**
+        * Exit the gate, admitting the next waiting thread, if any. This
+        * must be called by the thread which entered the gate.
+        */
+        virtual void exit();
+
+        /**
+        * Return the number of threads waiting in the specified lane.
+        *
+        * @param nLane  the lane
+        *
+        * @return the number of waiting threads
+        */
+        virtual int32_t getWaitingCount(int32_t nLane) const;
+
+
+    // ----- helpers --------------------------------------------------------
+
+    protected:
+        /**
+        * Determine if a thread waiting in the specified lane may enter the
+        * gate. Must be called while synchronized on the gate.
+        *
+        * @param nLane  the lane
+        *
+        * @return true iff a thread in the lane may enter
+        */
+        virtual bool isAdmissible(int32_t nLane) const;
+
+
+    // ----- data members ---------------------------------------------------
+
+    protected:
+        /**
+        * The number of threads waiting in each lane.
+        */
+        FinalHandle<Array<int32_t> > f_hacWaiting;
+
+        /**
+        * The number of consecutive admissions which have bypassed a
+        * waiting thread in a lower priority lane.
+        */
+        int32_t m_cBypass;
+
+        /**
+        * The number of consecutive bypasses after which the lowest priority
+        * waiting lane is admitted.
+        */
+        int32_t m_cMaxBypass;
+
+        /**
+        * True while a thread is within the gate.
+        */
+        bool m_fEntered;
+    };
+
+COH_CLOSE_NAMESPACE5
+
+#endif // COH_PRIORITY_GATE_HPP
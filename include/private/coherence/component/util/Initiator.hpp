@@ -109,6 +109,11 @@ class COH_EXPORT Initiator
         */
         virtual void checkPingTimeouts();
 
+        /**
+        * {@inheritDoc}
+        */
+        virtual void checkRequestTimeouts(int64_t ldtNow);
+
         /**
         * {@inheritDoc}
         */
@@ -12,6 +12,7 @@
 #include "coherence/io/ReadBuffer.hpp"
 #include "coherence/io/Serializer.hpp"
 #include "coherence/io/WriteBuffer.hpp"
+#include "coherence/native/NativeAtomic64.hpp"
 #include "coherence/net/OperationalContext.hpp"
 #include "coherence/net/Service.hpp"
 #include "coherence/run/xml/XmlElement.hpp"
@@ -244,6 +245,30 @@ class COH_EXPORT Peer
         */
         virtual void onConnectionOpened(PofConnection::Handle hConnection);
 
+        /**
+        * Called after a Request sent through a Channel managed by this
+        * ConnectionManager has been canceled because it did not complete
+        * before its deadline, whether while waiting for its response, while
+        * queued to be sent, or when purged by checkRequestTimeouts(). This
+        * method may be called on both client and service threads.
+        *
+        * @since 15.1.1.0.0
+        */
+        virtual void onRequestTimeout();
+
+        /**
+        * Called when a Request with a deadline is registered with a Channel
+        * managed by this ConnectionManager, so that the Channel(s) are
+        * checked for expired Requests by that deadline even if there is no
+        * default request timeout. This method may be called on both client
+        * and service threads.
+        *
+        * @param ldtDeadline  the deadline (in milliseconds) of the Request
+        *
+        * @since 15.1.1.0.0
+        */
+        virtual void onRequestDeadline(int64_t ldtDeadline);
+
         /**
         * Open a new Channel. This method is called by
         * Connection::openChannel() and is always run on client threads.
@@ -346,6 +371,16 @@ class COH_EXPORT Peer
         */
         virtual void checkPingTimeouts() = 0;
 
+        /**
+        * Cancel the pending Requests of the Channel(s) managed by this
+        * ConnectionManager which have passed their deadline.
+        *
+        * @param ldtNow  the current time in milliseconds
+        *
+        * @since 15.1.1.0.0
+        */
+        virtual void checkRequestTimeouts(int64_t ldtNow) = 0;
+
         /**
         * Decode the given BufferInput with the configured Codec and return a
         * new decoded Message. This method is called on either the service
@@ -865,6 +900,19 @@ class COH_EXPORT Peer
         */
         virtual int64_t getRequestTimeout() const;
 
+        /**
+        * Return the next time the Channel(s) managed by this
+        * ConnectionManager should be checked for expired Requests: the
+        * earliest pending Request deadline, or the regular check interval
+        * if there is a default request timeout, whichever comes first.
+        *
+        * @return the next time the Channel(s) managed by this
+        *         ConnectionManager should be checked for expired Requests
+        *
+        * @since 15.1.1.0.0
+        */
+        virtual int64_t getRequestNextCheckMillis() const;
+
         /**
         * Return the maximum size allowed for an incoming message. A value of 0
         * is interpreted as unlimited size.
@@ -885,6 +933,17 @@ class COH_EXPORT Peer
         */
         virtual int64_t getMaxOutgoingMessageSize() const;
 
+        /**
+        * Return the size above which an outgoing message of normal priority
+        * is written with bulk priority, allowing smaller messages to be
+        * written ahead of it. A value of 0 disables the demotion.
+        *
+        * @return the bulk message size
+        *
+        * @since 15.1.1.0.0
+        */
+        virtual int64_t getBulkMessageSize() const;
+
         /**
         * Return the total number of bytes received.
         */
@@ -1006,6 +1065,17 @@ class COH_EXPORT Peer
         */
         virtual void setRequestTimeout(int64_t cMillis);
 
+        /**
+        * Set the last time the Channel(s) managed by this ConnectionManager
+        * were checked for expired Requests.
+        *
+        * @param ldt  the last time the Channel(s) managed by this
+        *             ConnectionManager were checked for expired Requests
+        *
+        * @since 15.1.1.0.0
+        */
+        virtual void setRequestLastCheckMillis(int64_t ldt);
+
         /**
         * Set the maximum incoming message size.
         *
@@ -1024,6 +1094,15 @@ class COH_EXPORT Peer
         */
         virtual void setMaxOutgoingMessageSize(int64_t cbMax);
 
+        /**
+        * Set the bulk message size.
+        *
+        * @param cbBulk  the bulk message size
+        *
+        * @since 15.1.1.0.0
+        */
+        virtual void setBulkMessageSize(int64_t cbBulk);
+
         /**
         * Return the total number of bytes received.
         */
@@ -1220,6 +1299,21 @@ class COH_EXPORT Peer
         */
         int64_t m_cRequestTimeout;
 
+        /**
+        * The last time the Channel(s) managed by this ConnectionManager were
+        * checked for expired Requests.
+        */
+        int64_t m_ldtRequestLastCheckMillis;
+
+        /**
+        * The earliest deadline of the Requests pending with the Channel(s)
+        * managed by this ConnectionManager, as of the last check for expired
+        * Requests, or Integer64::max_value if there is none.
+        *
+        * @since 15.1.1.0.0
+        */
+        coherence::native::NativeAtomic64 m_ldtRequestDeadlineMillis;
+
         /**
         * The maximum incoming message size.
         *
@@ -1234,6 +1328,14 @@ class COH_EXPORT Peer
         */
         int64_t m_cbMaxOutgoingMessageSize;
 
+        /**
+        * The size above which an outgoing message is written with bulk
+        * priority.
+        *
+        * @see #getBulkMessageSize
+        */
+        int64_t m_cbBulkMessageSize;
+
         /**
         * Statistics: total number of bytes received.
         */
@@ -1253,7 +1355,7 @@ class COH_EXPORT Peer
         * The total number of timed-out requests since the last time the
         * statistics were reset.
         */
-        Volatile<int64_t> m_cStatsTimeoutCount;
+        coherence::native::NativeAtomic64 m_cStatsTimeoutCount;
 
         /**
         * A List of WrapperStreamFactory objects that affect how Messages are
@@ -67,6 +67,10 @@ class COH_EXPORT QueueProcessor
         /**
         * Instantiate a new queue instance.
         *
+        * By default this is a DualQueue; setting the
+        * coherence.daemon.queue system property to "single-consumer"
+        * selects the lock-free SingleConsumerQueue instead.
+        *
         * @return a new queue instance
         */
         virtual Queue::Handle instantiateQueue() const;
@@ -9,7 +9,9 @@
 
 #include "coherence/lang.ns"
 
+#include "coherence/util/List.hpp"
 #include "coherence/util/Listeners.hpp"
+#include "coherence/util/Map.hpp"
 #include "coherence/util/MapEvent.hpp"
 #include "coherence/util/MapListener.hpp"
 #include "coherence/util/Queue.hpp"
@@ -20,7 +22,9 @@
 
 COH_OPEN_NAMESPACE3(coherence,component,util)
 
+using coherence::util::List;
 using coherence::util::Listeners;
+using coherence::util::Map;
 using coherence::util::MapEvent;
 using coherence::util::MapListener;
 using coherence::util::MapListenerSupport;
@@ -99,6 +103,59 @@ class COH_EXPORT RunnableCacheEvent
         static void dispatchSafe(MapEvent::Handle hEvent,
                 Listeners::View vListeners, Queue::Handle hQueue);
 
+        /**
+        * Merge the specified task into a task for the same listener and
+        * key which is still waiting to be run, or failing that record the
+        * task as the one waiting for that listener and key.
+        *
+        * Only tasks for which isConflating() returns true take part in
+        * conflation; the caller must queue the task unless this method
+        * returns true.
+        *
+        * @param hTask        the task about to be queued
+        * @param hMapPending  the map of tasks waiting to be run, keyed by
+        *                     listener identity and then by event key;
+        *                     this map is also used as the synchronization
+        *                     point for conflation
+        *
+        * @return true iff the task's event has been merged into a pending
+        *         task and hTask must not be queued
+        *
+        * @since 15.1.1.0.0
+        */
+        static bool conflate(RunnableCacheEvent::Handle hTask,
+                Map::Handle hMapPending);
+
+        /**
+        * Deliver the events of the specified tasks to their listener, a
+        * BatchMapListener (possibly wrapped by ConverterMapListeners),
+        * through a single call to BatchMapListener::onMapEvents.
+        *
+        * @param vListTask  the RunnableCacheEvent tasks, all for the same
+        *                   listener, in the order they were queued
+        *
+        * @since 15.1.1.0.0
+        */
+        static void dispatchBatch(List::View vListTask);
+
+    protected:
+        /**
+        * Compute the single event which has the same net effect as the
+        * specified pending event followed by the specified new event.
+        *
+        * @param vEvtPending  the event waiting to be delivered
+        * @param vEvtNew      the subsequent event for the same key
+        * @param fDrop        set to true iff the events cancel each other
+        *                     out and neither needs to be delivered
+        *
+        * @return the merged event, or NULL if the events cannot be merged
+        *         (in which case fDrop is left unchanged)
+        *
+        * @since 15.1.1.0.0
+        */
+        static MapEvent::Handle merge(MapEvent::View vEvtPending,
+                MapEvent::View vEvtNew, bool& fDrop);
+
 
     // ----- accessors ------------------------------------------------------
 
@@ -156,6 +213,42 @@ class COH_EXPORT RunnableCacheEvent
         */
         virtual MapListener::View getMapListener() const;
 
+        /**
+        * Determine whether the listener this event is dispatched to only
+        * needs the net effect of the changes to each key, i.e. whether it
+        * is a ConflatingListener (possibly wrapped by a
+        * ConverterMapListener).
+        *
+        * @return true iff this event may be conflated with subsequent
+        *         events for the same listener and key
+        *
+        * @since 15.1.1.0.0
+        */
+        virtual bool isConflating() const;
+
+        /**
+        * Determine whether the listener this event is dispatched to is a
+        * BatchMapListener (possibly wrapped by a ConverterMapListener), in
+        * which case the event may be delivered by dispatchBatch rather than
+        * by running this task.
+        *
+        * @return true iff the event may be delivered as part of a batch
+        *
+        * @since 15.1.1.0.0
+        */
+        virtual bool isBatching() const;
+
+        /**
+        * Stop this task accepting conflated events, and return the event
+        * which is to be delivered.
+        *
+        * @return the event to deliver, or NULL if it has been cancelled out
+        *         by a subsequent event
+        *
+        * @since 15.1.1.0.0
+        */
+        virtual MapEvent::Handle claimEvent();
+
 
     // ----- data members ---------------------------------------------------
 
@@ -171,14 +264,38 @@ class COH_EXPORT RunnableCacheEvent
         FinalHandle<MapListenerSupport> f_hListenerSupport;
 
         /**
-        * Actual MapEvent to fire.
+        * Actual MapEvent to fire; replaced by the net event when
+        * subsequent events are conflated into this one.
         */
-        FinalHandle<MapEvent> f_hMapEvent;
+        MemberHandle<MapEvent> m_hMapEvent;
 
         /**
         * Optional MapListener object which the event is dispatched to.
         */
         FinalHandle<MapListener> f_hMapListener;
+
+        /**
+        * The map of pending tasks this task is registered with while it
+        * is waiting to be run, or NULL if it is not subject to
+        * conflation.
+        */
+        MemberHandle<Map> m_hMapPending;
+
+        /**
+        * True iff the event has been cancelled out by a subsequent event
+        * and must not be delivered.
+        */
+        bool m_fCancelled;
+
+        /**
+        * True iff the listener is a ConflatingListener.
+        */
+        bool m_fConflating;
+
+        /**
+        * True iff the listener is a BatchMapListener.
+        */
+        bool m_fBatching;
     };
 
 COH_CLOSE_NAMESPACE3
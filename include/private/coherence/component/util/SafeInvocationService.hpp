@@ -10,6 +10,7 @@
 #include "coherence/lang.ns"
 
 #include "coherence/net/Invocable.hpp"
+#include "coherence/net/InvocationObserver.hpp"
 #include "coherence/net/InvocationService.hpp"
 #include "coherence/util/Map.hpp"
 #include "coherence/util/Set.hpp"
@@ -19,6 +20,7 @@
 COH_OPEN_NAMESPACE3(coherence,component,util)
 
 using coherence::net::Invocable;
+using coherence::net::InvocationObserver;
 using coherence::net::InvocationService;
 using coherence::util::Map;
 using coherence::util::Set;
@@ -60,6 +62,12 @@ class COH_EXPORT SafeInvocationService
         virtual Map::View query(Invocable::Handle hTask,
                 Set::View vSetMembers);
 
+        /**
+        * {@inheritDoc}
+        */
+        virtual void execute(Invocable::Handle hTask, Set::View vSetMembers,
+                InvocationObserver::Handle hObserver);
+
 
     // ----- SafeInvocationService interface --------------------------------
 
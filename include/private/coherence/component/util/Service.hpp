@@ -18,6 +18,7 @@
 #include "coherence/util/Event.hpp"
 #include "coherence/util/EventListener.hpp"
 #include "coherence/util/Listeners.hpp"
+#include "coherence/util/Map.hpp"
 #include "coherence/util/Service.hpp"
 #include "coherence/util/ServiceEvent.hpp"
 #include "coherence/util/ServiceListener.hpp"
@@ -35,6 +36,7 @@ using coherence::util::Describable;
 using coherence::util::Event;
 using coherence::util::EventListener;
 using coherence::util::Listeners;
+using coherence::util::Map;
 using coherence::util::ServiceEvent;
 using coherence::util::ServiceListener;
 
@@ -290,6 +292,130 @@ class COH_EXPORT Service
                 */
                 virtual void drainQueue();
 
+                /**
+                * Return the number of threads which deliver MapEvents.
+                *
+                * With a single thread, the default, all events are
+                * delivered on the EventDispatcher thread. More threads are
+                * enabled through the coherence.events.threads property,
+                * in which case MapEvents are hashed by listener onto that
+                * many EventWorker threads. Each listener continues to
+                * receive its events one at a time and in order, while
+                * different listeners receive theirs in parallel; listeners
+                * which share state must therefore synchronize access to it.
+                *
+                * @return the number of event delivery threads
+                */
+                virtual size32_t getWorkerCount() const;
+
+                /**
+                * Set the number of threads which deliver MapEvents.
+                *
+                * This has no effect once the EventDispatcher has started.
+                *
+                * @param cWorkers  the number of event delivery threads
+                */
+                virtual void setWorkerCount(size32_t cWorkers);
+
+                /**
+                * Return the number of tasks waiting on the specified
+                * EventWorker.
+                *
+                * @param iWorker  the EventWorker index
+                *
+                * @return the queue depth, or 0 if there is no such worker
+                */
+                virtual size32_t getWorkerQueueDepth(size32_t iWorker) const;
+
+                /**
+                * Return the average number of milliseconds taken by the
+                * specified EventWorker to deliver each event.
+                *
+                * @param iWorker  the EventWorker index
+                *
+                * @return the average delivery latency, or 0 if there is no
+                *         such worker
+                */
+                virtual float64_t getWorkerLatencyMillis(size32_t iWorker) const;
+
+                /**
+                * Return whether the specified thread is one of the
+                * EventDispatcher's EventWorker threads.
+                *
+                * @param vThread  the thread
+                *
+                * @return true iff the thread is an EventWorker thread
+                */
+                virtual bool isWorkerThread(Thread::View vThread) const;
+
+                /**
+                * Return the maximum number of events delivered to a
+                * BatchMapListener by a single onMapEvents call.
+                *
+                * @return the maximum batch size
+                */
+                virtual size32_t getMaxBatchSize() const;
+
+                /**
+                * Set the maximum number of events delivered to a
+                * BatchMapListener by a single onMapEvents call.
+                *
+                * @param cMaxBatch  the maximum batch size; anything less
+                *                   than one is treated as one
+                */
+                virtual void setMaxBatchSize(size32_t cMaxBatch);
+
+            protected:
+                /**
+                * Return the index of the EventWorker which must deliver the
+                * specified task, or ObjectArray::npos if the task must be
+                * run by the EventDispatcher thread once all workers are idle.
+                *
+                * @param vTask  the task
+                *
+                * @return the EventWorker index or ObjectArray::npos
+                */
+                virtual size32_t getWorkerIndex(Runnable::View vTask) const;
+
+                /**
+                * Return the total number of tasks waiting on or being run by
+                * the EventWorkers.
+                *
+                * @return the worker backlog
+                */
+                virtual size32_t getWorkerBacklog() const;
+
+                /**
+                * Block the calling thread until all EventWorkers are idle.
+                */
+                virtual void drainWorkers();
+
+                /**
+                * Called by each EventWorker once it has run all of its
+                * tasks, waking the EventDispatcher should it be blocked in
+                * drainWorkers.
+                */
+                virtual void onWorkerIdle() const;
+
+                /**
+                * Add the specified task to the batch of events waiting to
+                * be delivered to its BatchMapListener, delivering the batch
+                * if it has reached the maximum batch size.
+                *
+                * @param hTask  the RunnableCacheEvent, for which isBatching()
+                *               is true
+                */
+                virtual void addToBatch(Runnable::Handle hTask);
+
+                /**
+                * Deliver all batches of events gathered by addToBatch.
+                *
+                * An exception thrown by one BatchMapListener is logged and
+                * does not prevent the remaining batches from being
+                * delivered.
+                */
+                virtual void flushBatches();
+
 
             // ----- QueueProcessor interface ---------------------------
 
@@ -309,6 +435,11 @@ class COH_EXPORT Service
                 virtual String::View getThreadName() const;
 
             protected:
+                /**
+                * {@inheritDoc}
+                */
+                virtual void onEnter();
+
                 /**
                 * {@inheritDoc}
                 */
@@ -379,6 +510,114 @@ class COH_EXPORT Service
                         * Reference back to the service component
                         */
                         WeakView<Service> m_wvService;
+
+                        /**
+                        * The RunnableCacheEvents for ConflatingListeners
+                        * which are still waiting to be run, keyed by
+                        * listener identity and then by event key.
+                        *
+                        * @see RunnableCacheEvent::conflate
+                        */
+                        FinalHandle<Map> f_hMapConflate;
+                    };
+
+            // ----- nested class EventWorker -----------------------
+
+            public:
+                /**
+                * A QueueProcessor which runs the tasks assigned to it by the
+                * EventDispatcher, in the order they were assigned.
+                */
+                class COH_EXPORT EventWorker
+                    : public class_spec<EventWorker,
+                        extends<QueueProcessor> >
+                    {
+                    friend class factory<EventWorker>;
+
+                    // ----- constructor ----------------------------
+
+                    protected:
+                        /**
+                        * Create a new EventWorker.
+                        *
+                        * @param vDispatcher  the owning EventDispatcher
+                        * @param iWorker      the index of this worker
+                        */
+                        EventWorker(EventDispatcher::View vDispatcher,
+                                size32_t iWorker);
+
+                    private:
+                    /**
+                    * Blocked copy constructor.
+                    */
+                    EventWorker(const EventWorker&);
+
+                    // ----- EventWorker interface ------------------
+
+                    public:
+                        /**
+                        * Return true if the worker is running a task or
+                        * has tasks waiting.
+                        *
+                        * @return true iff the worker is busy
+                        */
+                        virtual bool isBusy();
+
+                        /**
+                        * Return the average number of milliseconds taken
+                        * to run each task.
+                        *
+                        * @return the average task latency
+                        */
+                        virtual float64_t getLatencyMillis() const;
+
+                    // ----- Daemon interface -----------------------
+
+                    public:
+                        /**
+                        * {@inheritDoc}
+                        */
+                        virtual String::View getThreadName() const;
+
+                    protected:
+                        /**
+                        * {@inheritDoc}
+                        */
+                        virtual void onExit();
+
+                        /**
+                        * {@inheritDoc}
+                        */
+                        virtual void onNotify();
+
+                    // ----- data members ---------------------------
+
+                    protected:
+                        /**
+                        * Set to true while the worker is running tasks.
+                        */
+                        Volatile<bool> m_fDispatching;
+
+                        /**
+                        * The number of tasks run.
+                        */
+                        Volatile<int64_t> m_cTasks;
+
+                        /**
+                        * The total number of milliseconds spent running
+                        * tasks.
+                        */
+                        Volatile<int64_t> m_cMillisTotal;
+
+                        /**
+                        * The index of this worker.
+                        */
+                        size32_t m_iWorker;
+
+                        /**
+                        * Reference back to the owning EventDispatcher.
+                        */
+                        WeakView<EventDispatcher> m_wvDispatcher;
                     };
 
             // ----- data members ---------------------------------------
@@ -405,6 +644,29 @@ class COH_EXPORT Service
                 */
                 Volatile<bool> m_fDispatching;
 
+                /**
+                * The number of threads which deliver MapEvents.
+                */
+                size32_t m_cWorkers;
+
+                /**
+                * The EventWorkers, or NULL if events are delivered on the
+                * EventDispatcher thread.
+                */
+                FinalHandle<ObjectArray> f_haWorker;
+
+                /**
+                * The maximum number of events per onMapEvents call.
+                */
+                size32_t m_cMaxBatch;
+
+                /**
+                * The tasks for each BatchMapListener gathered during the
+                * current pass over the queue, keyed by listener identity.
+                * Only accessed by the EventDispatcher thread.
+                */
+                FinalHandle<Map> f_hMapBatch;
+
                 /**
                 * Reference back to the parent service component
                 */
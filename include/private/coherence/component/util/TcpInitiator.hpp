@@ -17,6 +17,7 @@
 
 #include "private/coherence/component/net/extend/PofConnection.hpp"
 #include "private/coherence/component/net/extend/TcpPofConnection.hpp"
+#include "private/coherence/component/net/extend/util/PriorityGate.hpp"
 #include "private/coherence/component/util/Initiator.hpp"
 #include "private/coherence/io/InputStream.hpp"
 #include "private/coherence/io/OutputStream.hpp"
@@ -29,6 +30,7 @@ COH_OPEN_NAMESPACE3(coherence,component,util)
 using coherence::io::InputStream;
 using coherence::io::OutputStream;
 using coherence::component::net::extend::PofConnection;
+using coherence::component::net::extend::util::PriorityGate;
 using coherence::native::NativeAtomic32;
 using coherence::net::AddressProvider;
 using coherence::net::InetSocketAddress;
@@ -284,6 +286,37 @@ class COH_EXPORT TcpInitiator
         */
         virtual void setSubport(int32_t nSubport);
 
+        /**
+        * Return the number of candidate addresses this TcpInitiator
+        * connects to concurrently when opening a Connection.
+        *
+        * @return the number of concurrent connect attempts
+        *
+        * @since 15.1.1.0.0
+        */
+        virtual int32_t getConnectParallelism() const;
+
+        /**
+        * Configure the number of candidate addresses this TcpInitiator
+        * connects to concurrently when opening a Connection.
+        * <p>
+        * When greater than one, a Socket is connected to each of up to
+        * this many addresses from the AddressProvider (or from a name
+        * service redirect) at once. The first to connect is used for the
+        * handshake and the others are closed, so that an unreachable proxy
+        * no longer costs a full connect timeout before the next address is
+        * tried. The default of one tries the addresses one at a time.
+        * <p>
+        * Each address is tried at most once per pass of the AddressProvider.
+        * Failed attempts are rejected in the order their addresses were
+        * handed out, and the winner is accepted only after its handshake.
+        *
+        * @param cParallel  the number of concurrent connect attempts
+        *
+        * @since 15.1.1.0.0
+        */
+        virtual void setConnectParallelism(int32_t cParallel);
+
     protected:
         /**
         * Set whether or not keep-alive is enabled on Socket objects
@@ -491,10 +524,12 @@ class COH_EXPORT TcpInitiator
                 */
                 virtual void openInternal();
 
+                using super::send;
+
                 /**
                 * {@inheritDoc}
                 */
-                virtual void send(WriteBuffer::View vwb);
+                virtual void send(WriteBuffer::View vwb, int32_t nPriority);
 
 
             // ----- accessor methods -----------------------------------
@@ -621,6 +656,14 @@ class COH_EXPORT TcpInitiator
                 */
                 NativeAtomic32 m_cConcurrentWriters;
 
+                /**
+                * The gate which admits concurrent writers to the socket
+                * output stream one at a time, in priority order.
+                *
+                * @since 15.1.1.0.0
+                */
+                FinalHandle<PriorityGate> f_hGateWrite;
+
                 /**
                 * Flag that indicates redirect; true if the TcpConnection 
                 * has been or should be redirected.
@@ -711,6 +754,11 @@ class COH_EXPORT TcpInitiator
         * The subport to connect to.
         */
         int32_t m_nSubport;
+
+        /**
+        * The number of candidate addresses to connect to concurrently.
+        */
+        int32_t m_cConnectParallelism;
     };
 
 COH_CLOSE_NAMESPACE3
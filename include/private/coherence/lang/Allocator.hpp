@@ -42,6 +42,126 @@ class COH_EXPORT Allocator
         * @throws IllegalStateException upon memory corruption detection
         */
         static void release(void* ab);
+
+        /**
+        * Return the number of size classes served by the thread-local
+        * memory pools.
+        *
+        * Size class i serves blocks of up to getSizeClassSlotSize(i) bytes,
+        * where each class doubles the slot size of the class below it.
+        *
+        * @return the size class count
+        */
+        static size_t getSizeClassCount();
+
+        /**
+        * Return the slot size of the specified size class.
+        *
+        * @param iClass  the size class
+        *
+        * @return the slot size in bytes, or 0 if the class does not exist
+        */
+        static size_t getSizeClassSlotSize(size_t iClass);
+
+        /**
+        * Return the number of allocations of the specified size class which
+        * were satisfied from the calling thread's pool.
+        *
+        * @param iClass  the size class
+        *
+        * @return the hit count
+        */
+        static size_t getSizeClassHits(size_t iClass);
+
+        /**
+        * Return the number of allocations of the specified size class which
+        * could not be satisfied from the calling thread's pool.
+        *
+        * @param iClass  the size class
+        *
+        * @return the miss count
+        */
+        static size_t getSizeClassMisses(size_t iClass);
+
+        /**
+        * Enter an arena scope on the calling thread.
+        *
+        * Within an arena scope small blocks are bump allocated from a
+        * thread-local chunk. Releasing such a block only decrements the live
+        * count of its chunk, and upon exiting the outermost scope the chunk
+        * is recycled in bulk if none of its blocks remain live. Blocks may
+        * outlive the scope and may be released by any thread, though each
+        * keeps its entire chunk allocated.
+        *
+        * Arena scopes nest, and have no effect unless a chunk size is
+        * configured via the coherence.heap.arena.size property or
+        * setArenaSize. Only allocations which are expected to die within
+        * the scope should be made within it, as a single surviving block
+        * prevents its chunk from being recycled.
+        *
+        * @see ArenaScope
+        */
+        static void enterArena();
+
+        /**
+        * Exit an arena scope on the calling thread.
+        */
+        static void exitArena();
+
+        /**
+        * Return the number of allocations made by the calling thread which
+        * were satisfied from an arena.
+        *
+        * @return the arena hit count
+        */
+        static size_t getArenaHits();
+
+        /**
+        * Return the number of times the calling thread's current arena
+        * chunk was recycled in bulk upon exiting an arena scope.
+        *
+        * @return the arena rewind count
+        */
+        static size_t getArenaRewinds();
+
+        /**
+        * Set the size of the chunks from which arena blocks are allocated.
+        *
+        * A size of 0 disables arena scopes, other sizes are rounded up to
+        * at least 4096 bytes. Arena scopes also have no effect if allocated
+        * blocks do not carry their size, see coherence.heap.padding.
+        *
+        * @param cb  the chunk size in bytes
+        *
+        * @return the prior chunk size
+        */
+        static size_t setArenaSize(size_t cb);
+
+
+    // ----- inner class: ArenaScope ----------------------------------------
+
+    public:
+        /**
+        * ArenaScope enters an arena scope for the life of the ArenaScope
+        * object.
+        */
+        class ArenaScope
+            {
+            public:
+                ArenaScope()
+                    {
+                    Allocator::enterArena();
+                    }
+
+                ~ArenaScope()
+                    {
+                    Allocator::exitArena();
+                    }
+
+            private:
+                ArenaScope(const ArenaScope&);
+                ArenaScope& operator=(const ArenaScope&);
+            };
     };
 
 COH_CLOSE_NAMESPACE2
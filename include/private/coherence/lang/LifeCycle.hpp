@@ -70,6 +70,8 @@ std::basic_ostream<Char, Traits>& operator<<(std::basic_ostream<Char, Traits>& o
             break;
         }
     out << ", ReaderLocks=" << state.value.cMemberReadLock;
+    out << ", ThinMonitor=" << state.value.cMonitorThin;
+    out << ", Contended=" << (state.value.fMonitorContended ? "true" : "false");
 
     out << ", LifeStage=";
     switch (state.value.nLifeStage)
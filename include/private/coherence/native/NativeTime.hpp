@@ -52,6 +52,14 @@ class COH_EXPORT NativeTime
         */
         virtual int64_t currentTimeMillis() const = 0;
 
+        /**
+        * Return the number of microseconds which have elapsed since the
+        * undefined platform specific start time.
+        *
+        * @since 15.1.1.0.0
+        */
+        virtual int64_t currentTimeMicros() const = 0;
+
         /**
         * Creates a new Date instance for the given time specified in
         * milliseconds.
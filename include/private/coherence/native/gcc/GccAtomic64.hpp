@@ -39,6 +39,26 @@ int64_t NativeAtomic64::update(int64_t lAssume, int64_t lValue)
     return __sync_val_compare_and_swap(&m_lAtomic, lAssumeAligned, lValueAligned);
     }
 
+int64_t NativeAtomic64::getAcquire() const
+    {
+    return get();
+    }
+
+void NativeAtomic64::setRelease(int64_t lValue)
+    {
+    set(lValue);
+    }
+
+int64_t NativeAtomic64::updateAcquire(int64_t lAssume, int64_t lValue)
+    {
+    return update(lAssume, lValue);
+    }
+
+int64_t NativeAtomic64::updateRelease(int64_t lAssume, int64_t lValue)
+    {
+    return update(lAssume, lValue);
+    }
+
 COH_CLOSE_NAMESPACE2
 
 #endif // COH_GCC_ATOMIC64
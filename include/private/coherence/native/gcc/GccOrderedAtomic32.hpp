@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2000, 2026, Oracle and/or its affiliates.
+ *
+ * Licensed under the Universal Permissive License v 1.0 as shown at
+ * http://oss.oracle.com/licenses/upl.
+ */
+#ifndef COH_GCC_ORDERED_ATOMIC32
+#define COH_GCC_ORDERED_ATOMIC32
+
+#include "coherence/lang/compatibility.hpp"
+#include "coherence/native/NativeAtomic32.hpp"
+
+COH_OPEN_NAMESPACE2(coherence,native)
+
+// NativeAtomic32 implementation based on the GCC __atomic builtins, which
+// expose the C++11 memory model (as used by std::atomic) to C++98 code. The
+// volatile operations are sequentially consistent, as JSR-133 requires, but
+// unlike the __sync based implementation they do not issue a full fence on
+// every load; the acquire/release variants are weaker still.
+
+// ----- NativeAtomic32 interface -------------------------------------------
+
+int32_t NativeAtomic32::get() const
+    {
+    return __atomic_load_n(&m_nAtomic, __ATOMIC_SEQ_CST);
+    }
+
+int32_t NativeAtomic32::getAcquire() const
+    {
+    return __atomic_load_n(&m_nAtomic, __ATOMIC_ACQUIRE);
+    }
+
+void NativeAtomic32::set(int32_t nValue)
+    {
+    __atomic_store_n(&m_nAtomic, nValue, __ATOMIC_SEQ_CST);
+    }
+
+void NativeAtomic32::setRelease(int32_t nValue)
+    {
+    __atomic_store_n(&m_nAtomic, nValue, __ATOMIC_RELEASE);
+    }
+
+int32_t NativeAtomic32::update(int32_t nAssume, int32_t nValue)
+    {
+    COH_ALIGN(4, int32_t, nAssumeAligned) = nAssume;
+
+    // on failure the actual value is written back into nAssumeAligned
+    __atomic_compare_exchange_n(&m_nAtomic, &nAssumeAligned, nValue,
+            /*fWeak*/ false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+    return nAssumeAligned;
+    }
+
+int32_t NativeAtomic32::updateAcquire(int32_t nAssume, int32_t nValue)
+    {
+    COH_ALIGN(4, int32_t, nAssumeAligned) = nAssume;
+
+    __atomic_compare_exchange_n(&m_nAtomic, &nAssumeAligned, nValue,
+            /*fWeak*/ false, __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE);
+    return nAssumeAligned;
+    }
+
+int32_t NativeAtomic32::updateRelease(int32_t nAssume, int32_t nValue)
+    {
+    COH_ALIGN(4, int32_t, nAssumeAligned) = nAssume;
+
+    __atomic_compare_exchange_n(&m_nAtomic, &nAssumeAligned, nValue,
+            /*fWeak*/ false, __ATOMIC_RELEASE, __ATOMIC_RELAXED);
+    return nAssumeAligned;
+    }
+
+COH_CLOSE_NAMESPACE2
+
+#endif // COH_GCC_ORDERED_ATOMIC32
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2000, 2026, Oracle and/or its affiliates.
+ *
+ * Licensed under the Universal Permissive License v 1.0 as shown at
+ * http://oss.oracle.com/licenses/upl.
+ */
+#ifndef COH_GCC_ORDERED_ATOMIC64
+#define COH_GCC_ORDERED_ATOMIC64
+
+#include "coherence/lang/compatibility.hpp"
+#include "coherence/native/NativeAtomic64.hpp"
+
+COH_OPEN_NAMESPACE2(coherence,native)
+
+// NativeAtomic64 implementation based on the GCC __atomic builtins, which
+// expose the C++11 memory model (as used by std::atomic) to C++98 code. The
+// volatile operations are sequentially consistent, as JSR-133 requires, but
+// unlike the __sync based implementation they do not issue a full fence on
+// every load; the acquire/release variants are weaker still.
+
+// ----- NativeAtomic64 interface -------------------------------------------
+
+int64_t NativeAtomic64::get() const
+    {
+    return __atomic_load_n(&m_lAtomic, __ATOMIC_SEQ_CST);
+    }
+
+int64_t NativeAtomic64::getAcquire() const
+    {
+    return __atomic_load_n(&m_lAtomic, __ATOMIC_ACQUIRE);
+    }
+
+void NativeAtomic64::set(int64_t lValue)
+    {
+    __atomic_store_n(&m_lAtomic, lValue, __ATOMIC_SEQ_CST);
+    }
+
+void NativeAtomic64::setRelease(int64_t lValue)
+    {
+    __atomic_store_n(&m_lAtomic, lValue, __ATOMIC_RELEASE);
+    }
+
+int64_t NativeAtomic64::update(int64_t lAssume, int64_t lValue)
+    {
+    COH_ALIGN(8, int64_t, lAssumeAligned) = lAssume;
+
+    // on failure the actual value is written back into lAssumeAligned
+    __atomic_compare_exchange_n(&m_lAtomic, &lAssumeAligned, lValue,
+            /*fWeak*/ false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+    return lAssumeAligned;
+    }
+
+int64_t NativeAtomic64::updateAcquire(int64_t lAssume, int64_t lValue)
+    {
+    COH_ALIGN(8, int64_t, lAssumeAligned) = lAssume;
+
+    __atomic_compare_exchange_n(&m_lAtomic, &lAssumeAligned, lValue,
+            /*fWeak*/ false, __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE);
+    return lAssumeAligned;
+    }
+
+int64_t NativeAtomic64::updateRelease(int64_t lAssume, int64_t lValue)
+    {
+    COH_ALIGN(8, int64_t, lAssumeAligned) = lAssume;
+
+    __atomic_compare_exchange_n(&m_lAtomic, &lAssumeAligned, lValue,
+            /*fWeak*/ false, __ATOMIC_RELEASE, __ATOMIC_RELAXED);
+    return lAssumeAligned;
+    }
+
+COH_CLOSE_NAMESPACE2
+
+#endif // COH_GCC_ORDERED_ATOMIC64
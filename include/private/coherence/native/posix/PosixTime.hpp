@@ -62,6 +62,22 @@ class COH_EXPORT PosixTime
             return cMillis;
             }
 
+        /**
+        * @inheritDoc
+        */
+        virtual int64_t currentTimeMicros() const
+            {
+            struct timeval tvNow;
+
+            COH_ENSURE_EQUALITY(gettimeofday(&tvNow, NULL), 0);
+
+            int64_t cMicros = tvNow.tv_sec;
+            cMicros *= 1000000;
+            cMicros += tvNow.tv_usec;
+
+            return cMicros;
+            }
+
         /**
         * @inheritDoc
         */
@@ -37,6 +37,26 @@ int32_t NativeAtomic32::update(int32_t nAssume, int32_t nValue)
     return atomic_cas_32((uint32_t*) &m_nAtomic, nAssumeAligned, nValueAligned);
     }
 
+int32_t NativeAtomic32::getAcquire() const
+    {
+    return get();
+    }
+
+void NativeAtomic32::setRelease(int32_t nValue)
+    {
+    set(nValue);
+    }
+
+int32_t NativeAtomic32::updateAcquire(int32_t nAssume, int32_t nValue)
+    {
+    return update(nAssume, nValue);
+    }
+
+int32_t NativeAtomic32::updateRelease(int32_t nAssume, int32_t nValue)
+    {
+    return update(nAssume, nValue);
+    }
+
 COH_CLOSE_NAMESPACE2
 
 #endif // COH_SOLARIS_ATOMIC32_HPP
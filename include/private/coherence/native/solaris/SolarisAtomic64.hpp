@@ -37,6 +37,26 @@ int64_t NativeAtomic64::update(int64_t lAssume, int64_t lValue)
     return atomic_cas_64((uint64_t*) &m_lAtomic, lAssumeAligned, lValueAligned);
     }
 
+int64_t NativeAtomic64::getAcquire() const
+    {
+    return get();
+    }
+
+void NativeAtomic64::setRelease(int64_t lValue)
+    {
+    set(lValue);
+    }
+
+int64_t NativeAtomic64::updateAcquire(int64_t lAssume, int64_t lValue)
+    {
+    return update(lAssume, lValue);
+    }
+
+int64_t NativeAtomic64::updateRelease(int64_t lAssume, int64_t lValue)
+    {
+    return update(lAssume, lValue);
+    }
+
 COH_CLOSE_NAMESPACE2
 
 #endif // COH_SOLARIS_ATOMIC64_HPP
@@ -38,6 +38,26 @@ int32_t NativeAtomic32::update(int32_t nAssume, int32_t nValue)
     return _InterlockedCompareExchange((LONG*) &m_nAtomic, nValueAligned, nAssumeAligned);
     }
 
+int32_t NativeAtomic32::getAcquire() const
+    {
+    return get();
+    }
+
+void NativeAtomic32::setRelease(int32_t nValue)
+    {
+    set(nValue);
+    }
+
+int32_t NativeAtomic32::updateAcquire(int32_t nAssume, int32_t nValue)
+    {
+    return update(nAssume, nValue);
+    }
+
+int32_t NativeAtomic32::updateRelease(int32_t nAssume, int32_t nValue)
+    {
+    return update(nAssume, nValue);
+    }
+
 COH_CLOSE_NAMESPACE2
 
 #endif // COH_WINDOWS_ATOMIC32_HPP
@@ -38,6 +38,26 @@ int64_t NativeAtomic64::update(int64_t lAssume, int64_t lValue)
     return _InterlockedCompareExchange64((LONGLONG*) &m_lAtomic, lValueAligned, lAssumeAligned);
     }
 
+int64_t NativeAtomic64::getAcquire() const
+    {
+    return get();
+    }
+
+void NativeAtomic64::setRelease(int64_t lValue)
+    {
+    set(lValue);
+    }
+
+int64_t NativeAtomic64::updateAcquire(int64_t lAssume, int64_t lValue)
+    {
+    return update(lAssume, lValue);
+    }
+
+int64_t NativeAtomic64::updateRelease(int64_t lAssume, int64_t lValue)
+    {
+    return update(lAssume, lValue);
+    }
+
 COH_CLOSE_NAMESPACE2
 
 #endif // COH_WINDOWS_ATOMIC64_HPP
@@ -69,6 +69,22 @@ class COH_EXPORT WindowsTime
             return systemTimeIn_ms - DELTA_EPOCH_IN_MILLIS;
             }
 
+        /**
+        * @inheritDoc
+        */
+        virtual int64_t currentTimeMicros() const
+            {
+            FILETIME fileTime;
+            GetSystemTimeAsFileTime(&fileTime);
+
+            ULARGE_INTEGER uli;
+            uli.LowPart  = fileTime.dwLowDateTime;
+            uli.HighPart = fileTime.dwHighDateTime;
+
+            ULONGLONG systemTimeIn_us(uli.QuadPart / 10);
+            return systemTimeIn_us - DELTA_EPOCH_IN_MILLIS * 1000;
+            }
+
         /**
         * @inheritDoc
         */
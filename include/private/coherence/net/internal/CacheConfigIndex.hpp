@@ -0,0 +1,373 @@
+/*
+ * Copyright (c) 2000, 2026, Oracle and/or its affiliates.
+ *
+ * Licensed under the Universal Permissive License v 1.0 as shown at
+ * http://oss.oracle.com/licenses/upl.
+ */
+#ifndef COH_CACHE_CONFIG_INDEX_HPP
+#define COH_CACHE_CONFIG_INDEX_HPP
+
+#include "coherence/lang.ns"
+
+#include "coherence/net/DefaultConfigurableCacheFactory.hpp"
+#include "coherence/run/xml/XmlElement.hpp"
+#include "coherence/util/Map.hpp"
+
+COH_OPEN_NAMESPACE3(coherence,net,internal)
+
+using coherence::net::DefaultConfigurableCacheFactory;
+using coherence::run::xml::XmlElement;
+using coherence::util::Map;
+
+
+/**
+* CacheConfigIndex is an immutable index over a cache configuration
+* document, compiled once so that scheme resolution does not need to walk
+* the XmlElement tree.
+*
+* Cache mappings are indexed by their exact cache-name and, for wildcard
+* mappings, by their prefix in a trie, allowing the mapping for a cache name
+* to be found in time proportional to the length of the name rather than
+* the number of mappings. Schemes are indexed by scheme-name and
+* service-name. The init-params of each mapping are parsed up front, and
+* when they contain no wildcard substitution the resulting attribute Map is
+* shared by every CacheInfo created for the mapping.
+*
+* The index reproduces the matching rules of a linear scan of the document:
+* an exact match is preferred, then the last matching wildcard mapping in
+* document order, and finally the last "*" mapping.
+*
+* @since 15.1.1.0.0
+*/
+class COH_EXPORT CacheConfigIndex
+    : public class_spec<CacheConfigIndex>
+    {
+    friend class factory<CacheConfigIndex>;
+
+    // ----- handle definitions (needed for nested classes) -----------------
+
+    public:
+        typedef this_spec::Handle Handle;
+        typedef this_spec::View   View;
+        typedef this_spec::Holder Holder;
+
+
+    // ----- nested class: Mapping ------------------------------------------
+
+    public:
+        /**
+        * A compiled cache-mapping element.
+        */
+        class COH_EXPORT Mapping
+            : public class_spec<Mapping>
+            {
+            friend class factory<Mapping>;
+
+            // ----- constructors ---------------------------------------
+
+            protected:
+                /**
+                * Compile the specified cache-mapping element.
+                *
+                * @param vXml  the cache-mapping element
+                */
+                Mapping(XmlElement::View vXml);
+
+            // ----- Mapping interface ----------------------------------
+
+            public:
+                /**
+                * Create a CacheInfo for the specified cache name.
+                *
+                * @param vsCacheName  the cache name
+                * @param vsSuffix     the part of the cache name matched by
+                *                     the wildcard, substituted for "*" in
+                *                     the init-param values
+                *
+                * @return the CacheInfo
+                */
+                virtual DefaultConfigurableCacheFactory::CacheInfo::View
+                        createCacheInfo(String::View vsCacheName,
+                                String::View vsSuffix) const;
+
+            // ----- accessors ------------------------------------------
+
+            public:
+                /**
+                * Return the cache-name of the mapping.
+                *
+                * @return the cache-name
+                */
+                virtual String::View getCacheName() const;
+
+                /**
+                * Return the index of the "*" within the cache-name, or
+                * npos if the cache-name does not contain a wildcard.
+                *
+                * @return the wildcard index
+                */
+                virtual size32_t getWildcardIndex() const;
+
+                /**
+                * Return true if the cache-name is an invalid wildcard
+                * pattern, i.e. one where the "*" is not the last character.
+                *
+                * @return true iff the cache-name is invalid
+                */
+                virtual bool isInvalid() const;
+
+                /**
+                * Return the cache-mapping element.
+                *
+                * @return the cache-mapping element
+                */
+                virtual XmlElement::View getXml() const;
+
+            // ----- data members ---------------------------------------
+
+            protected:
+                /**
+                * The cache-mapping element.
+                */
+                FinalView<XmlElement> f_vXml;
+
+                /**
+                * The cache-name.
+                */
+                FinalView<String> f_vsCacheName;
+
+                /**
+                * The scheme-name.
+                */
+                FinalView<String> f_vsSchemeName;
+
+                /**
+                * The non-empty init-param names.
+                */
+                FinalView<ObjectArray> f_vaParamName;
+
+                /**
+                * The part of each init-param value before the "*", or the
+                * whole value if it contains no "*".
+                */
+                FinalView<ObjectArray> f_vaParamPrefix;
+
+                /**
+                * The part of each init-param value after the "*", or NULL
+                * if it contains no "*".
+                */
+                FinalView<ObjectArray> f_vaParamSuffix;
+
+                /**
+                * The shared attribute Map, or NULL if any init-param value
+                * requires wildcard substitution.
+                */
+                FinalView<Map> f_vMapAttribute;
+
+                /**
+                * The index of the "*" within the cache-name.
+                */
+                size32_t m_ofWildcard;
+            };
+
+
+    // ----- nested class: Node ---------------------------------------------
+
+    public:
+        /**
+        * A node of the wildcard trie, reached by the UTF-8 octets of a
+        * cache-name prefix.
+        */
+        class COH_EXPORT Node
+            : public class_spec<Node>
+            {
+            friend class factory<Node>;
+
+            // ----- constructors ---------------------------------------
+
+            protected:
+                /**
+                * Create a new Node.
+                */
+                Node();
+
+            // ----- Node interface -------------------------------------
+
+            public:
+                /**
+                * Return the child Node for the specified octet.
+                *
+                * @param b  the octet
+                *
+                * @return the child Node, or NULL if there is none
+                */
+                virtual Node::View getChild(octet_t b) const;
+
+                /**
+                * Return the child Node for the specified octet, creating
+                * it if necessary.
+                *
+                * @param b  the octet
+                *
+                * @return the child Node
+                */
+                virtual Node::Handle ensureChild(octet_t b);
+
+            // ----- accessors ------------------------------------------
+
+            public:
+                /**
+                * Return the wildcard Mapping whose prefix ends at this
+                * Node.
+                *
+                * @return the Mapping, or NULL
+                */
+                virtual Mapping::View getMapping() const;
+
+                /**
+                * Return the document order of the Mapping.
+                *
+                * @return the document order
+                */
+                virtual int32_t getOrder() const;
+
+                /**
+                * Set the wildcard Mapping whose prefix ends at this Node.
+                *
+                * @param vMapping  the Mapping
+                * @param nOrder    the document order of the Mapping
+                */
+                virtual void setMapping(Mapping::View vMapping, int32_t nOrder);
+
+                /**
+                * Return an invalid wildcard Mapping whose prefix ends at
+                * this Node.
+                *
+                * @return the invalid Mapping, or NULL
+                */
+                virtual Mapping::View getInvalid() const;
+
+                /**
+                * Set an invalid wildcard Mapping whose prefix ends at this
+                * Node.
+                *
+                * @param vMapping  the invalid Mapping
+                */
+                virtual void setInvalid(Mapping::View vMapping);
+
+            // ----- data members ---------------------------------------
+
+            protected:
+                /**
+                * The octet leading to each child, parallel to m_haChild.
+                */
+                MemberHandle<Array<octet_t> > m_habEdge;
+
+                /**
+                * The child Nodes.
+                */
+                MemberHandle<ObjectArray> m_haChild;
+
+                /**
+                * The wildcard Mapping whose prefix ends at this Node.
+                */
+                MemberView<Mapping> m_vMapping;
+
+                /**
+                * An invalid wildcard Mapping whose prefix ends at this Node.
+                */
+                MemberView<Mapping> m_vInvalid;
+
+                /**
+                * The document order of m_vMapping.
+                */
+                int32_t m_nOrder;
+            };
+
+
+    // ----- constructors ---------------------------------------------------
+
+    protected:
+        /**
+        * Compile the specified cache configuration.
+        *
+        * @param vXmlConfig  the cache configuration
+        */
+        CacheConfigIndex(XmlElement::View vXmlConfig);
+
+    private:
+        /**
+        * Blocked copy constructor.
+        */
+        CacheConfigIndex(const CacheConfigIndex&);
+
+
+    // ----- CacheConfigIndex interface -------------------------------------
+
+    public:
+        /**
+        * Find the cache-mapping for the specified cache name, and create
+        * the corresponding CacheInfo.
+        *
+        * @param vsCacheName  the cache name
+        *
+        * @return the CacheInfo
+        *
+        * @throws IllegalArgumentException if no mapping matches the cache
+        *         name, or an invalid wildcard pattern matches it
+        */
+        virtual DefaultConfigurableCacheFactory::CacheInfo::View
+                findSchemeMapping(String::View vsCacheName) const;
+
+        /**
+        * Return the first caching scheme with the specified scheme-name.
+        *
+        * @param vsSchemeName  the scheme-name
+        *
+        * @return the scheme element, or NULL if there is none
+        */
+        virtual XmlElement::View findScheme(String::View vsSchemeName) const;
+
+        /**
+        * Return the first caching scheme with the specified service-name.
+        *
+        * @param vsServiceName  the service-name
+        *
+        * @return the scheme element, or NULL if there is none
+        */
+        virtual XmlElement::View findServiceScheme(
+                String::View vsServiceName) const;
+
+
+    // ----- data members ---------------------------------------------------
+
+    protected:
+        /**
+        * Mappings keyed by cache-name, holding the first mapping for each.
+        */
+        FinalHandle<Map> f_hMapExact;
+
+        /**
+        * The root of the wildcard trie.
+        */
+        FinalHandle<Node> f_hRoot;
+
+        /**
+        * The last "*" mapping, if any.
+        */
+        FinalView<Mapping> f_vMappingDefault;
+
+        /**
+        * Caching schemes keyed by scheme-name.
+        */
+        FinalHandle<Map> f_hMapScheme;
+
+        /**
+        * Caching schemes keyed by service-name.
+        */
+        FinalHandle<Map> f_hMapService;
+    };
+
+COH_CLOSE_NAMESPACE3
+
+#endif // COH_CACHE_CONFIG_INDEX_HPP
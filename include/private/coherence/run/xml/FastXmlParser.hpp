@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2000, 2026, Oracle and/or its affiliates.
+ *
+ * Licensed under the Universal Permissive License v 1.0 as shown at
+ * http://oss.oracle.com/licenses/upl.
+ */
+#ifndef COH_FAST_XML_PARSER_HPP
+#define COH_FAST_XML_PARSER_HPP
+
+#include "coherence/lang.ns"
+
+#include "coherence/run/xml/XmlDocument.hpp"
+#include "coherence/run/xml/XmlElement.hpp"
+
+#include <istream>
+
+COH_OPEN_NAMESPACE3(coherence,run,xml)
+
+
+/**
+* An XML parser which produces the same XmlDocument as SimpleParser, but
+* does so in a single pass directly over the UTF-8 octets of the document.
+*
+* Unlike SimpleParser it does not run the document through an XmlScript and
+* XmlTokenizer, and so does not create a Token, ParsePosition or String for
+* each lexical element; Strings are only created for the names, attribute
+* values, content and comments which end up in the resulting document.
+* Whitespace between elements is skipped without being copied.
+*
+* The parser is selected by XmlHelper::loadXml when the
+* coherence.xml.parser system property is set to "fast".
+*
+* @since 15.1.1.0.0
+*/
+class COH_EXPORT FastXmlParser
+    : public class_spec<FastXmlParser>
+    {
+    friend class factory<FastXmlParser>;
+
+    // ----- constructor ----------------------------------------------------
+
+    protected:
+        /**
+        * Create a new FastXmlParser.
+        */
+        FastXmlParser();
+
+    private:
+        /**
+        * Blocked copy constructor.
+        */
+        FastXmlParser(const FastXmlParser&);
+
+
+    // ----- FastXmlParser interface ----------------------------------------
+
+    public:
+        /**
+        * Parse the specified String into an XmlDocument object.
+        *
+        * @param vsXml  the String to parse
+        *
+        * @return an XmlDocument object
+        *
+        * @throws IOException if an error occurs during parsing
+        */
+        virtual XmlDocument::Handle parseXml(String::View vsXml);
+
+        /**
+        * Parse the specified istream into an XmlDocument object.
+        *
+        * @param stream  the istream object
+        *
+        * @return an XmlDocument object
+        *
+        * @throws IOException if an error occurs during parsing
+        */
+        virtual XmlDocument::Handle parseXml(std::istream& stream);
+
+        /**
+        * Parse the specified UTF-8 octets into an XmlDocument object.
+        *
+        * @param ach  the octets to parse
+        * @param cb   the number of octets
+        *
+        * @return an XmlDocument object
+        *
+        * @throws IOException if an error occurs during parsing
+        */
+        virtual XmlDocument::Handle parseXml(const char* ach, size32_t cb);
+
+
+    // ----- implementation -------------------------------------------------
+
+    protected:
+        /**
+        * Parse the prolog, root element and trailing comments of the
+        * document.
+        *
+        * @param hXml  the document to populate
+        */
+        virtual void parseDocument(XmlDocument::Handle hXml);
+
+        /**
+        * Parse the remainder of an XML declaration, following "<?xml".
+        *
+        * @param hXml  the document to populate
+        */
+        virtual void parseXmlDecl(XmlDocument::Handle hXml);
+
+        /**
+        * Parse the remainder of a DOCTYPE, following "<!DOCTYPE".
+        *
+        * @param hXml  the document to populate
+        */
+        virtual void parseDoctype(XmlDocument::Handle hXml);
+
+        /**
+        * Parse the attributes and content of an element whose name has
+        * already been consumed.
+        *
+        * @param hXml  the element to populate
+        */
+        virtual void parseElement(XmlElement::Handle hXml);
+
+        /**
+        * Parse any comments and processing instructions at the current
+        * position.
+        *
+        * @param hXml  the document to add comments to
+        */
+        virtual void parseMisc(XmlDocument::Handle hXml);
+
+        /**
+        * Parse the remainder of a comment, following "<!--".
+        *
+        * @param hXml         the element to add the comment to
+        * @param fIsDocument  true if the comment is outside of the root
+        *                     element
+        */
+        virtual void parseComment(XmlElement::Handle hXml, bool fIsDocument);
+
+        /**
+        * Parse the remainder of a processing instruction, following "<?".
+        * The XML declaration is not permitted.
+        */
+        virtual void parsePi();
+
+
+    // ----- parsing helpers ------------------------------------------------
+
+    protected:
+        /**
+        * Skip any whitespace at the current position.
+        */
+        void skipWhitespace();
+
+        /**
+        * Determine if the octets at the current position match the
+        * specified C string.
+        *
+        * @param ach  the C string
+        *
+        * @return true iff the octets match
+        */
+        bool isAt(const char* ach) const;
+
+        /**
+        * Consume the specified C string, which must be at the current
+        * position.
+        *
+        * @param ach  the C string
+        */
+        void match(const char* ach);
+
+        /**
+        * Consume the specified name if it is at the current position and
+        * is not followed by another name character.
+        *
+        * @param ach  the name
+        *
+        * @return true iff the name was consumed
+        */
+        bool peekName(const char* ach);
+
+        /**
+        * Consume the name at the current position.
+        *
+        * @return the name
+        */
+        String::View parseName();
+
+        /**
+        * Consume the quoted literal at the current position, following
+        * any whitespace, an '=' and any further whitespace if fEquals is
+        * true.
+        *
+        * @param fEquals  true if the literal is preceded by an '='
+        *
+        * @return the unquoted literal
+        */
+        String::View parseLiteral(bool fEquals);
+
+        /**
+        * Advance to the next occurrence of the specified C string.
+        *
+        * @param ach  the C string
+        *
+        * @return the position of the C string
+        */
+        const char* scan(const char* ach);
+
+        /**
+        * Throw an exception describing a syntax error at the current
+        * position.
+        *
+        * @param vsMsg  the description of the error
+        */
+        void fail(String::View vsMsg) const;
+
+
+    // ----- data members ---------------------------------------------------
+
+    protected:
+        /**
+        * The start of the document being parsed.
+        */
+        const char* m_achStart;
+
+        /**
+        * The current position.
+        */
+        const char* m_pch;
+
+        /**
+        * The end of the document being parsed.
+        */
+        const char* m_pchEnd;
+    };
+
+COH_CLOSE_NAMESPACE3
+
+#endif // COH_FAST_XML_PARSER_HPP
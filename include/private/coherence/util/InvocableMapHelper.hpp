@@ -125,6 +125,26 @@ class COH_EXPORT InvocableMapHelper
                 Filter::View vFilter, bool fEntries, bool fSort,
                 Comparator::View vComparator);
 
+        /**
+        * Evaluate the filter against the entries of the map for the keys in
+        * the specified range of the array, moving the matching keys (or
+        * entries) to the start of that range.
+        *
+        * @param vMap       the underlying Map
+        * @param vFilter    the Filter, or NULL to only check for presence
+        * @param fEntries   if true, collect entries; otherwise keys
+        * @param haoResult  the candidate keys
+        * @param iFrom      the index of the first key to evaluate
+        * @param iTo        the index after the last key to evaluate
+        *
+        * @return the number of matches, stored from index iFrom
+        *
+        * @since 15.1.1.0.0
+        */
+        static size32_t evaluateRange(Map::View vMap, Filter::View vFilter,
+                bool fEntries, ObjectArray::Handle haoResult, size32_t iFrom,
+                size32_t iTo);
+
         /**
         * Add an index to the given map of indexes, keyed by the given
         * extractor. Also add the index as a listener to the given
@@ -163,6 +183,63 @@ class COH_EXPORT InvocableMapHelper
         static void removeIndex(ValueExtractor::View vExtractor,
                 ObservableMap::Handle hMap, Map::Handle hMapIndex);
 
+        /**
+        * Return the minimum number of candidate entries for which query
+        * evaluates its residual filter in parallel. The initial value is
+        * taken from the coherence.query.parallel.threshold system property,
+        * and is zero, leaving parallel evaluation off, if it is not set.
+        *
+        * @return the threshold, or zero if queries are always evaluated by
+        *         the calling thread
+        *
+        * @since 15.1.1.0.0
+        */
+        static size32_t getParallelQueryThreshold();
+
+        /**
+        * Set the minimum number of candidate entries for which query
+        * evaluates its residual filter in parallel.
+        *
+        * @param cEntries  the threshold, or zero to disable parallel
+        *                  evaluation
+        *
+        * @since 15.1.1.0.0
+        */
+        static void setParallelQueryThreshold(size32_t cEntries);
+
+        /**
+        * Return the number of threads, including the calling thread, over
+        * which a parallel query evaluation is split. The other threads are
+        * drawn from a pool shared by all queries, which is created when a
+        * query is first evaluated in parallel and grows to this size on
+        * demand. The initial value is taken from the
+        * coherence.query.parallel.threads system property.
+        *
+        * @return the number of threads
+        *
+        * @since 15.1.1.0.0
+        */
+        static size32_t getParallelQueryThreads();
+
+        /**
+        * Set the number of threads, including the calling thread, over
+        * which a parallel query evaluation is split.
+        *
+        * @param cThreads  the number of threads; at least one
+        *
+        * @since 15.1.1.0.0
+        */
+        static void setParallelQueryThreads(size32_t cThreads);
+
+        /**
+        * Stop the threads of the pool shared by parallel query evaluations
+        * and wait for them to exit. The pool is created again should a
+        * query later be evaluated in parallel.
+        *
+        * @since 15.1.1.0.0
+        */
+        static void shutdownParallelQueries();
+
 
     // ----- helpers -------------------------------------------------------
 
@@ -176,6 +253,23 @@ class COH_EXPORT InvocableMapHelper
         * @return a listener for given index
         */
         static MapListener::Handle ensureListener(MapIndex::Handle hIndex);
+
+        /**
+        * Evaluate the filter against the candidate keys on
+        * getParallelQueryThreads() threads, compacting the matches to the
+        * start of the array.
+        *
+        * @param vMap       the underlying Map
+        * @param vFilter    the Filter, or NULL to only check for presence
+        * @param fEntries   if true, collect entries; otherwise keys
+        * @param haoResult  the candidate keys
+        *
+        * @return the number of matches
+        *
+        * @since 15.1.1.0.0
+        */
+        static size32_t evaluateParallel(Map::View vMap, Filter::View vFilter,
+                bool fEntries, ObjectArray::Handle haoResult);
     };
 
 COH_CLOSE_NAMESPACE2
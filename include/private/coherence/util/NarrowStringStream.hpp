@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2000, 2026, Oracle and/or its affiliates.
+ *
+ * Licensed under the Universal Permissive License v 1.0 as shown at
+ * http://oss.oracle.com/licenses/upl.
+ */
+#ifndef COH_NARROW_STRING_STREAM_HPP
+#define COH_NARROW_STRING_STREAM_HPP
+
+#include "coherence/lang.ns"
+
+#include <ostream>
+#include <streambuf>
+#include <string>
+
+COH_OPEN_NAMESPACE2(coherence,util)
+
+
+/**
+* NarrowStringStream is a std::ostream which formats into a fixed size
+* buffer held within the stream itself, and only falls back to the heap
+* once that buffer is exhausted. The accumulated UTF-8 octets are handed to
+* String::create as is, without the intermediate std::string copy and the
+* wide character re-encoding incurred by COH_TO_STRING in the internal
+* build.
+*
+* As it is a std::ostream any type with a narrow operator<< may be written
+* to it. It is intended to be allocated on the stack, and is most easily
+* used through the COH_TO_STACK_STRING macro.
+*
+* @since 15.1.1.0.0
+*/
+class COH_EXPORT NarrowStringStream
+    : public std::ostream
+    {
+    // ----- constants ------------------------------------------------------
+
+    public:
+        /**
+        * The number of octets which may be formatted before spilling to
+        * the heap.
+        */
+        static const size32_t buffer_size = 256;
+
+
+    // ----- nested class: Buffer -------------------------------------------
+
+    public:
+        /**
+        * The streambuf backing a NarrowStringStream.
+        */
+        class COH_EXPORT Buffer
+            : public std::streambuf
+            {
+            public:
+                /**
+                * Create a new, empty Buffer.
+                */
+                Buffer();
+
+            public:
+                /**
+                * Create a String from the octets written so far.
+                *
+                * @return the String
+                */
+                String::Handle toString();
+
+            protected:
+                /**
+                * {@inheritDoc}
+                */
+                virtual int_type overflow(int_type ch);
+
+                /**
+                * {@inheritDoc}
+                */
+                virtual std::streamsize xsputn(const char* ach,
+                        std::streamsize cch);
+
+                /**
+                * Move the content of the fixed buffer to the overflow
+                * string, making the fixed buffer available again.
+                */
+                void spill();
+
+            private:
+                /**
+                * The fixed buffer.
+                */
+                char m_ach[buffer_size];
+
+                /**
+                * The octets which no longer fit in the fixed buffer.
+                */
+                std::string m_sOverflow;
+            };
+
+
+    // ----- constructors ---------------------------------------------------
+
+    public:
+        /**
+        * Create a new, empty NarrowStringStream.
+        */
+        NarrowStringStream();
+
+    private:
+        /**
+        * Blocked copy constructor.
+        */
+        NarrowStringStream(const NarrowStringStream&);
+
+
+    // ----- NarrowStringStream interface -----------------------------------
+
+    public:
+        /**
+        * Return this stream as a std::ostream lvalue, allowing a temporary
+        * NarrowStringStream to be used with non-member operator<<.
+        *
+        * @return this stream
+        */
+        std::ostream& self()
+            {
+            return *this;
+            }
+
+        /**
+        * Create a String from the content written to this stream.
+        *
+        * @return the String
+        */
+        String::Handle toString()
+            {
+            return m_buf.toString();
+            }
+
+
+    // ----- data members ---------------------------------------------------
+
+    private:
+        /**
+        * The stream's buffer.
+        */
+        Buffer m_buf;
+    };
+
+COH_CLOSE_NAMESPACE2
+
+
+/**
+* This macro will take any set of narrow streamable contents and turn them
+* into a coherence#lang#String instance, formatting into a stack buffer
+* rather than a heap allocated wide stream.
+*
+* @param CONTENTS  the contents to use in constructing the String.
+*
+* Usage example:
+* @code
+* String::Handle hsFoo = COH_TO_STACK_STRING("This value: " << 5);
+* @endcode
+*/
+#define COH_TO_STACK_STRING(CONTENTS) \
+    ((coherence::util::NarrowStringStream&) \
+        (coherence::util::NarrowStringStream().self() << CONTENTS)).toString()
+
+#endif // COH_NARROW_STRING_STREAM_HPP
@@ -487,6 +487,22 @@ class COH_EXPORT StringHelper
         */
         static int64_t parseMemorySize(String::View vS, int32_t nDefaultPower);
 
+        /**
+        * Return the non-negative integer value of the specified system
+        * property. A property which is not a valid number is logged and
+        * ignored; negative values are treated as zero.
+        *
+        * @param vsName    the name of the property
+        * @param nDefault  the value to return if the property is not set or
+        *                  is not a valid number
+        *
+        * @return the value of the property
+        *
+        * @since 15.1.1.0.0
+        */
+        static int32_t getCountProperty(String::View vsName,
+                int32_t nDefault = 0);
+
         /**
         * Calculate the number of decimal digits needed to display the passed
         * value.
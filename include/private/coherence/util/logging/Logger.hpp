@@ -11,7 +11,10 @@
 
 #include "coherence/net/OperationalContext.hpp"
 
+#include "coherence/util/AtomicCounter.hpp"
+
 #include "private/coherence/util/Date.hpp"
+#include "private/coherence/util/NarrowStringStream.hpp"
 #include "private/coherence/util/logging/LogOutput.hpp"
 #include "private/coherence/component/util/QueueProcessor.hpp"
 
@@ -182,6 +185,38 @@ class COH_EXPORT Logger
         */
         virtual void setLimit(int32_t cChar);
 
+        /**
+        * Return the maximum number of messages which may be waiting to be
+        * written by the logger thread, or zero if unlimited.
+        *
+        * @return the queue limit
+        *
+        * @since 15.1.1.0.0
+        */
+        virtual int32_t getQueueLimit() const;
+
+        /**
+        * Set the maximum number of messages which may be waiting to be
+        * written by the logger thread. Messages logged while the limit is
+        * reached are dropped without being queued, and counted; the logger
+        * thread reports the number dropped once it catches up.
+        *
+        * @param cMessages  the queue limit, or zero for unlimited
+        *
+        * @since 15.1.1.0.0
+        */
+        virtual void setQueueLimit(int32_t cMessages);
+
+        /**
+        * Return the number of messages dropped since this Logger was created
+        * because the queue limit had been reached.
+        *
+        * @return the number of dropped messages
+        *
+        * @since 15.1.1.0.0
+        */
+        virtual int64_t getDroppedCount() const;
+
         /**
         * Return set of paramaterizable strings that may appear in a formatted
         * log message.
@@ -383,6 +418,15 @@ class COH_EXPORT Logger
         */
         static int32_t getDefaultLimit();
 
+        /**
+        * Return the default queue limit.
+        *
+        * @return the default queue limit
+        *
+        * @since 15.1.1.0.0
+        */
+        static int32_t getDefaultQueueLimit();
+
     protected:
         /**
         * Create a new Log message. A log message is an
@@ -422,6 +466,19 @@ class COH_EXPORT Logger
         virtual void onLog();
 
 
+    // ----- QueueProcessor interface ---------------------------------------
+
+    protected:
+        /**
+        * {@inheritDoc}
+        *
+        * The Logger's queue is only ever drained by the logger thread, so
+        * the lock-free SingleConsumerQueue is always used, keeping the
+        * logging threads from contending on a monitor.
+        */
+        virtual Queue::Handle instantiateQueue() const;
+
+
     // ----- Daemon interface -----------------------------------------------
 
     protected:
@@ -489,6 +546,22 @@ class COH_EXPORT Logger
         * The product edition.
         */
         MemberView<String> m_vsEdition;
+
+        /**
+        * The maximum number of queued messages, or zero if unlimited.
+        */
+        int32_t m_cQueueLimit;
+
+        /**
+        * The number of messages dropped due to the queue limit.
+        */
+        FinalHandle<AtomicCounter> f_hCountDropped;
+
+        /**
+        * The number of dropped messages already reported by the logger
+        * thread.
+        */
+        int64_t m_cDroppedReported;
     };
 
 COH_CLOSE_NAMESPACE3
@@ -525,6 +598,9 @@ COH_CLOSE_NAMESPACE3
 *
 * Log a message to the Coherence logger at a given log level.
 *
+* The level is checked before CONTENTS is evaluated, so a disabled level
+* costs no formatting.
+*
 * @param CONTENTS  the streamable contents to write to the stream
 * @param LEVEL     the level at which to log the message
 */
@@ -564,7 +640,7 @@ COH_CLOSE_NAMESPACE3
         if (_nLevel >= 0 && fLogger) \
             { \
             _hLog->log(_nLevel, EX, \
-                    COH_TO_STRING(CONTENTS), NULL); \
+                    COH_TO_STACK_STRING(CONTENTS), NULL); \
             } \
         else \
             { \
@@ -105,9 +105,10 @@ struct LifeCycle
     */
     enum
         {
-        max_read_locks = 0xFF,   // maximum number of reader threads, before blocking
-        max_handles    = 0x7FFF, // maximum number of handles to an Object
-        max_views      = 0x7FFF  // maximum number of views to an Object
+        max_read_locks   = 0xFF,   // maximum number of reader threads, before blocking
+        max_thin_monitor = 0x7FFF, // maximum thin monitor recursion, before inflating
+        max_handles      = 0x7FFF, // maximum number of handles to an Object
+        max_views        = 0x7FFF  // maximum number of views to an Object
         };
 
 
@@ -161,6 +162,23 @@ struct LifeCycle
             * currently gate_open.
             */
             unsigned int cMemberReadLock : 8; // if changed update max_read_locks
+
+            /**
+            * The number of times the Object's thin monitor is held by its
+            * owning thread.
+            *
+            * The thin monitor is only used while the monitor is flat and the
+            * Object has escaped, a non-zero value indicates that the monitor
+            * is held and that the Object's condition pointer identifies the
+            * owning thread.
+            */
+            unsigned int cMonitorThin : 15; // if changed update max_thin_monitor
+
+            /**
+            * Indicates that another thread has given up waiting on the thin
+            * monitor and requires that the monitor be inflated.
+            */
+            unsigned int fMonitorContended : 1;
             } value;
 
         // ----- operators ------------------------------------------------------
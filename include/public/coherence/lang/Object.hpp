@@ -1127,6 +1127,26 @@ class COH_EXPORT Object
         */
         NativeCondition& _ensureMonitor() const;
 
+        /**
+        * Attempt to enter the Object's thin monitor.
+        *
+        * The thin monitor allows an escaped Object to be synchronized upon
+        * without inflating its NativeCondition, so long as the monitor is
+        * not contended and is not waited upon.
+        *
+        * @return true if the thin monitor was entered, false if the
+        *         inflated monitor must be used instead
+        */
+        bool _enterThinMonitor() const;
+
+        /**
+        * Attempt to exit the Object's thin monitor.
+        *
+        * @return true if the thin monitor was exited, false if the
+        *         inflated monitor must be used instead
+        */
+        bool _exitThinMonitor() const;
+
 
     // ----- static methods -------------------------------------------------
 
@@ -1179,6 +1199,24 @@ class COH_EXPORT Object
             return NULL == get_pointer(v) ? 0 : v->hashCode();
             }
 
+        /**
+        * @internal
+        *
+        * Specify if uncontended monitors on escaped Objects are to be held
+        * as thin locks. The initial setting is taken from the
+        * coherence.monitor.thin property.
+        *
+        * The setting only affects monitors which are subsequently entered,
+        * and may be changed at any time.
+        *
+        * @param fThin  true to enable thin monitors
+        *
+        * @return the prior setting
+        *
+        * @since 15.1.1.0.0
+        */
+        static bool _setThinMonitorEnabled(bool fThin);
+
 
     // ----- memory management ----------------------------------------------
 
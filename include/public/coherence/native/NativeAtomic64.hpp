@@ -57,6 +57,17 @@ class COH_EXPORT NativeAtomic64
         */
         int64_t get() const;
 
+        /**
+        * Return the current value, with acquire semantics only.
+        *
+        * Subsequent loads and stores by the calling thread will not be
+        * reordered before this load, but unlike get() no ordering is
+        * guaranteed relative to the calling thread's prior stores.
+        *
+        * @return the current value
+        */
+        int64_t getAcquire() const;
+
         /**
         * Return the assumed value without performing any memory
         * synchronization. This value should not be trusted, but is suitable
@@ -77,6 +88,17 @@ class COH_EXPORT NativeAtomic64
         */
         void set(int64_t lValue);
 
+        /**
+        * Unconditionally set the value, with release semantics only.
+        *
+        * Prior loads and stores by the calling thread will not be reordered
+        * after this store, but unlike set() no ordering is guaranteed
+        * relative to the calling thread's subsequent loads.
+        *
+        * @param lValue  the new value
+        */
+        void setRelease(int64_t lValue);
+
         /**
         * Unconditionally (and in a non thread-safe manor) set the value.
         *
@@ -99,6 +121,37 @@ class COH_EXPORT NativeAtomic64
         */
         int64_t update(int64_t lAssume, int64_t lValue);
 
+        /**
+        * Set the value so long as the current value matches the expected
+        * value, with acquire semantics only.
+        *
+        * This is suitable for operations such as reference count increments
+        * where the calling thread needs to observe the effects of threads
+        * which previously released the value, but does not itself publish
+        * any state through it.
+        *
+        * @param lAssume  the expected current value
+        * @param lValue   the new value
+        *
+        * @return the prior actual value, if the returned value
+        *         does is not equal to the supplied assumed
+        *         value then update did not take place
+        */
+        int64_t updateAcquire(int64_t lAssume, int64_t lValue);
+
+        /**
+        * Set the value so long as the current value matches the expected
+        * value, with release semantics only.
+        *
+        * @param lAssume  the expected current value
+        * @param lValue   the new value
+        *
+        * @return the prior actual value, if the returned value
+        *         does is not equal to the supplied assumed
+        *         value then update did not take place
+        */
+        int64_t updateRelease(int64_t lAssume, int64_t lValue);
+
         /**
         * Set the value so long as the current value matches the expected value.
         *
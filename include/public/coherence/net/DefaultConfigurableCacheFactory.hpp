@@ -22,6 +22,7 @@
 #include "coherence/run/xml/XmlElement.hpp"
 #include "coherence/run/xml/XmlValue.hpp"
 
+#include "coherence/util/Collection.hpp"
 #include "coherence/util/Map.hpp"
 #include "coherence/util/MapListener.hpp"
 
@@ -35,6 +36,7 @@ using coherence::net::cache::ContinuousQueryCache;
 using coherence::run::xml::XmlDocument;
 using coherence::run::xml::XmlElement;
 using coherence::run::xml::XmlValue;
+using coherence::util::Collection;
 using coherence::util::Map;
 using coherence::util::MapListener;
 
@@ -214,6 +216,10 @@ class COH_EXPORT DefaultConfigurableCacheFactory
         * In the configuration XML find a "cache-mapping" element associated with a
         * given cache name.
         *
+        * The mappings are indexed when the configuration is set, so the
+        * lookup takes time proportional to the length of the cache name
+        * rather than the number of mappings.
+        *
         * @param vsCacheName  the value of the "cache-name" element to look for
         *
         * @return a CacheInfo object associated with a given cache name
@@ -265,6 +271,48 @@ class COH_EXPORT DefaultConfigurableCacheFactory
         virtual NamedCache::Handle configureCache(CacheInfo::View vInfo,
                 XmlElement::View vXmlScheme);
 
+        /**
+        * Ensure a cache for each of the specified names.
+        *
+        * The scheme of each cache which is not already active is resolved
+        * up front, and the caches are then configured concurrently by up to
+        * getEnsureCacheParallelism() threads, so that the round trips
+        * needed to ensure remote caches overlap rather than run one after
+        * the other. The time taken to ensure each cache is logged.
+        *
+        * If any of the caches cannot be configured the first failure is
+        * rethrown once all of the other caches have been processed; the
+        * caches which were configured remain registered with this factory.
+        *
+        * @param vColCacheNames  the names of the caches to ensure
+        *
+        * @return a Map of each cache name to its NamedCache
+        *
+        * @since 15.1.1.0.0
+        */
+        virtual Map::View ensureCaches(Collection::View vColCacheNames);
+
+        /**
+        * Configure a cache for the given scheme, unless an active cache of
+        * the same name is already registered with this factory, and
+        * register it.
+        *
+        * The cache is configured without holding the cache store's monitor,
+        * so that several caches may be configured concurrently. Only one
+        * thread configures a given cache name at a time; any other thread
+        * ensuring the same name waits for it and then returns the cache it
+        * registered.
+        *
+        * @param vInfo       the cache info
+        * @param vXmlScheme  the corresponding resolved scheme
+        *
+        * @return the registered cache
+        *
+        * @since 15.1.1.0.0
+        */
+        virtual NamedCache::Handle ensureConfiguredCache(CacheInfo::View vInfo,
+                XmlElement::View vXmlScheme);
+
 
     protected:
         /**
@@ -584,6 +632,28 @@ class COH_EXPORT DefaultConfigurableCacheFactory
         */
         virtual void setOperationalContext(OperationalContext::View vContext);
 
+        /**
+        * Return the maximum number of threads used by ensureCaches() to
+        * configure caches concurrently.
+        *
+        * @return the ensure cache parallelism
+        *
+        * @since 15.1.1.0.0
+        */
+        virtual int32_t getEnsureCacheParallelism() const;
+
+        /**
+        * Set the maximum number of threads used by ensureCaches() to
+        * configure caches concurrently. The default is taken from the
+        * coherence.cachefactory.ensure.parallel system property, or 8.
+        *
+        * @param cThreads  the ensure cache parallelism; values less than one
+        *                  are treated as one
+        *
+        * @since 15.1.1.0.0
+        */
+        virtual void setEnsureCacheParallelism(int32_t cThreads);
+
         /**
         * The default XML configuration used when one isn't explicitly passed
         * in the constructor for this class.
@@ -628,6 +698,14 @@ class COH_EXPORT DefaultConfigurableCacheFactory
         */
         FinalView<XmlElement> f_vXmlConfig;
 
+        /**
+        * Index over f_vXmlConfig used to resolve cache mappings and schemes
+        * without walking the XML.
+        *
+        * @since 15.1.1.0.0
+        */
+        FinalView<Object> f_vConfigIndex;
+
         /**
         * Store that holds cache references by name and optionally,
         * if configured, Subject.
@@ -644,6 +722,20 @@ class COH_EXPORT DefaultConfigurableCacheFactory
         * The parent ThreadGroup for all Services associated with this factory.
         */
         FinalHandle<ThreadGroup> f_hThreadGroup;
+
+        /**
+        * The maximum number of threads used by ensureCaches().
+        */
+        int32_t m_cEnsureCacheParallelism;
+
+        /**
+        * The names of the caches being configured by ensureConfiguredCache(),
+        * each mapped to the monitor on which other callers for that name
+        * wait.
+        *
+        * @since 15.1.1.0.0
+        */
+        FinalHandle<Map> f_hMapPendingCache;
     };
 
 COH_CLOSE_NAMESPACE2
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2000, 2026, Oracle and/or its affiliates.
+ *
+ * Licensed under the Universal Permissive License v 1.0 as shown at
+ * http://oss.oracle.com/licenses/upl.
+ */
+#ifndef COH_INVOCATION_OBSERVER_HPP
+#define COH_INVOCATION_OBSERVER_HPP
+
+#include "coherence/lang.ns"
+
+#include "coherence/net/Member.hpp"
+
+COH_OPEN_NAMESPACE2(coherence,net)
+
+
+/**
+* The InvocationObserver is an object that asynchronously receives
+* notification of results from the execution of Invocable objects.
+*
+* The methods of an InvocationObserver are called on the event dispatcher
+* thread of the InvocationService, and as such should not block or perform
+* long running operations.
+*
+* @see InvocationService#execute
+*
+* @since 15.1.1.0.0
+*/
+class COH_EXPORT InvocationObserver
+    : public interface_spec<InvocationObserver>
+    {
+    // ----- InvocationObserver interface -----------------------------------
+
+    public:
+        /**
+        * This method is called by the InvocationService to inform the
+        * InvocationObserver that a member has finished running the
+        * Invocable object.
+        *
+        * @param vMember   the member that executed the Invocable object
+        * @param ohResult  the result of the execution
+        */
+        virtual void memberCompleted(Member::View vMember,
+                Object::Holder ohResult) = 0;
+
+        /**
+        * This method is called by the InvocationService to inform the
+        * InvocationObserver that a member has thrown an exception while
+        * running the Invocable object, or that the invocation could not be
+        * delivered to the member.
+        *
+        * @param vMember    the member that failed to execute the Invocable
+        *                   object
+        * @param ohFailure  the Exception that was thrown
+        */
+        virtual void memberFailed(Member::View vMember,
+                Exception::Holder ohFailure) = 0;
+
+        /**
+        * This method is called by the InvocationService to inform the
+        * InvocationObserver that a member that the Invocable object was
+        * intended for execution upon has left the service. For an Extend
+        * client this is the proxy it is connected to, whose connection was
+        * closed before the result arrived.
+        *
+        * @param vMember  the member that left the service
+        */
+        virtual void memberLeft(Member::View vMember) = 0;
+
+        /**
+        * This method is called by the InvocationService to inform the
+        * InvocationObserver that all members have reported back on the
+        * results of the Invocable object.
+        */
+        virtual void invocationCompleted() = 0;
+    };
+
+COH_CLOSE_NAMESPACE2
+
+#endif // COH_INVOCATION_OBSERVER_HPP
@@ -10,12 +10,16 @@
 #include "coherence/lang.ns"
 
 #include "coherence/net/Invocable.hpp"
+#include "coherence/net/InvocationObserver.hpp"
+#include "coherence/net/Member.hpp"
 #include "coherence/net/Service.hpp"
+#include "coherence/util/Iterator.hpp"
 #include "coherence/util/Map.hpp"
 #include "coherence/util/Set.hpp"
 
 COH_OPEN_NAMESPACE2(coherence,net)
 
+using coherence::util::Iterator;
 using coherence::util::Map;
 using coherence::util::Set;
 
@@ -55,6 +59,53 @@ class COH_EXPORT InvocationService
         * @return a Map of result objects keyed by Member object
         */
         virtual Map::View query(Invocable::Handle hTask, Set::View vSetMembers) = 0;
+
+        /**
+        * Asynchronously invoke the specified task on each of the specified
+        * members. This method will return as soon as the task has been
+        * sent; the result of the invocation on each member is reported to
+        * the specified InvocationObserver, if any, on the event dispatcher
+        * thread of this service.
+        * <p>
+        * Any number of invocations may be outstanding at the same time,
+        * allowing a single thread to pipeline many tasks to the cluster
+        * without waiting for each to complete.
+        * <p>
+        * Currently, the client implementation of this interface only
+        * supports invocation on the cluster member to which the client is
+        * connected. Therefore, the specified Set of Member objects must
+        * be NULL.
+        * <p>
+        * The default implementation is not asynchronous: it calls query on
+        * the calling thread, reports each result to the observer and then
+        * returns. An exception thrown by query is thrown to the caller.
+        *
+        * @param hTask        the Invocable object to distribute to the
+        *                     specified members in order to be invoked on
+        *                     those members
+        * @param vSetMembers  must be NULL (future use)
+        * @param hObserver    an optional InvocationObserver object that
+        *                     will receive notifications related to the
+        *                     Invocable object
+        *
+        * @since 15.1.1.0.0
+        */
+        virtual void execute(Invocable::Handle hTask, Set::View vSetMembers,
+                InvocationObserver::Handle hObserver)
+            {
+            Map::View vMapResult = query(hTask, vSetMembers);
+            if (NULL != hObserver)
+                {
+                for (Iterator::Handle hIter = vMapResult->entrySet()->iterator();
+                        hIter->hasNext(); )
+                    {
+                    Map::Entry::View vEntry = cast<Map::Entry::View>(hIter->next());
+                    hObserver->memberCompleted(
+                            cast<Member::View>(vEntry->getKey()), vEntry->getValue());
+                    }
+                hObserver->invocationCompleted();
+                }
+            }
     };
 
 COH_CLOSE_NAMESPACE2
@@ -118,7 +118,8 @@ class COH_EXPORT AbstractBundler
         /**
          * Obtain the timeout delay value.
          *
-         * @return the timeout delay value in milliseconds
+         * @return the timeout delay value in milliseconds, rounded up if the
+         *         delay was specified with a finer resolution
          */
         virtual int64_t getDelayMillis() const;
 
@@ -129,6 +130,29 @@ class COH_EXPORT AbstractBundler
          */
         virtual void setDelayMillis(int64_t lDelay);
 
+        /**
+         * Obtain the timeout delay value.
+         *
+         * @return the timeout delay value in microseconds
+         *
+         * @since 15.1.1.0.0
+         */
+        virtual int64_t getDelayMicros() const;
+
+        /**
+         * Specify the timeout delay value with a sub-millisecond resolution.
+         *
+         * A bundle whose delay has expired is executed by the first thread
+         * that enters it afterwards, or as soon as any other bundle of this
+         * bundler completes; otherwise the first thread is only woken by the
+         * monitor timer, which has a one millisecond resolution.
+         *
+         * @param lDelay  the timeout delay value in microseconds
+         *
+         * @since 15.1.1.0.0
+         */
+        virtual void setDelayMicros(int64_t lDelay);
+
         /**
          * Check whether or not auto-adjustment is allowed.
          *
@@ -144,6 +168,45 @@ class COH_EXPORT AbstractBundler
          */
         virtual void setAllowAutoAdjust(bool fAutoAdjust);
 
+        /**
+         * Check whether or not a bundle is flushed as soon as no other bundle
+         * is being executed.
+         *
+         * @return true if the bundler flushes on idle
+         *
+         * @since 15.1.1.0.0
+         */
+        virtual bool isFlushOnIdle() const;
+
+        /**
+         * Specify whether or not a bundle is flushed as soon as no other
+         * bundle is being executed.
+         *
+         * When set, the first thread entering a bundle waits for more
+         * requests only while another bundle of this bundler is in flight
+         * (still executing), and flushes as soon as that execution completes,
+         * the size threshold is reached or the delay expires. Under light
+         * load every request is thus sent immediately, while under heavy
+         * load requests accumulate for as long as the previous bundle takes
+         * to execute. When not set (the default, unless the
+         * coherence.bundler.flush.idle system property is "true") the first
+         * thread always waits for the delay or the size threshold.
+         *
+         * @param fFlush  true to flush when no other bundle is in flight
+         *
+         * @since 15.1.1.0.0
+         */
+        virtual void setFlushOnIdle(bool fFlush);
+
+        /**
+         * Obtain the number of bundles currently being executed.
+         *
+         * @return the number of bundles in flight
+         *
+         * @since 15.1.1.0.0
+         */
+        virtual int64_t getInFlightCount() const;
+
     // ----- statistics ------------------------------------------------------
 
     protected:
@@ -405,6 +468,14 @@ class COH_EXPORT AbstractBundler
                  */
                 int64_t m_ldtStart;
 
+                /**
+                 * The time, in microseconds, at which the delay of the first
+                 * thread entering the bundle expires.
+                 *
+                 * @since 15.1.1.0.0
+                 */
+                int64_t m_ldtDeadlineMicros;
+
                 /**
                  * Statistics: a total time duration this Bundle has spent in bundled
                  * request processing (burst).
@@ -519,6 +590,15 @@ class COH_EXPORT AbstractBundler
          */
         virtual Bundle::Handle instantiateBundle() = 0;
 
+        /**
+         * Called when a bundle's execution completes, to wake the first
+         * thread of each open bundle that waits for the bundler to become
+         * idle.
+         *
+         * @since 15.1.1.0.0
+         */
+        virtual void onBurstComplete();
+
     // ----- constants and data fields ---------------------------------------
 
     public:
@@ -552,6 +632,11 @@ class COH_EXPORT AbstractBundler
          */
         FinalHandle<AtomicCounter> f_hCountThreads;
 
+        /**
+         * A counter for the number of bundles currently being executed.
+         */
+        FinalHandle<AtomicCounter> f_hCountInFlight;
+
     private:
         /**
          * The bundle size threshold. We use double for this value to allow for
@@ -573,9 +658,15 @@ class COH_EXPORT AbstractBundler
         bool m_fAllowAuto;
 
         /**
-         * The delay timeout in milliseconds. Default value is one millisecond.
+         * The delay timeout in microseconds. Default value is one millisecond.
+         */
+        int64_t m_lDelayMicros;
+
+        /**
+         * Specifies whether or not a bundle is flushed as soon as no other
+         * bundle is in flight.
          */
-        int64_t m_lDelayMillis;
+        bool m_fFlushOnIdle;
 
         /**
          * Last active (open) bundle position.
@@ -0,0 +1,256 @@
+/*
+ * Copyright (c) 2000, 2026, Oracle and/or its affiliates.
+ *
+ * Licensed under the Universal Permissive License v 1.0 as shown at
+ * http://oss.oracle.com/licenses/upl.
+ */
+#ifndef COH_ABSTRACT_INVOKE_BUNDLER_HPP
+#define COH_ABSTRACT_INVOKE_BUNDLER_HPP
+
+#include "coherence/lang.ns"
+
+#include "coherence/net/cache/AbstractBundler.hpp"
+
+#include "coherence/util/Collection.hpp"
+#include "coherence/util/InvocableMap.hpp"
+#include "coherence/util/Map.hpp"
+
+COH_OPEN_NAMESPACE3(coherence,net,cache)
+
+using coherence::util::Collection;
+using coherence::util::InvocableMap;
+using coherence::util::Map;
+
+/**
+ * An abstract bundler for the NamedCache invoke() and invokeAll()
+ * operations.
+ *
+ * Requests which share an EntryProcessor are grouped into a single bundled
+ * invocation; two EntryProcessors are shared if they are equal, which
+ * unless an EntryProcessor overrides equals() means that they are the same
+ * object. A bundle may hold several such groups, each of which is executed
+ * separately when the bundle is processed. A request for a key which is
+ * already part of its group in the open bundle is not bundled, so that the
+ * EntryProcessor is still executed once per request against that entry.
+ *
+ * If the bundled invocation of a group fails, the exception is rethrown to
+ * every request of that group rather than repeating the invocation per
+ * request, as the EntryProcessor may already have been applied to some of
+ * the entries.
+ *
+ * @since 15.1.1.0.0
+ */
+class COH_EXPORT AbstractInvokeBundler
+    : public abstract_spec<AbstractInvokeBundler,
+        extends<AbstractBundler> >
+    {
+    // ----- handle definitions (needed for nested classes) -----------------
+
+    public:
+        typedef this_spec::Handle Handle;
+        typedef this_spec::View   View;
+        typedef this_spec::Holder Holder;
+
+    // ----- constructors ---------------------------------------------------
+
+    protected:
+        /**
+         * @internal
+         */
+        AbstractInvokeBundler();
+
+    private:
+        /**
+         * Blocked copy constructor.
+         */
+        AbstractInvokeBundler(const AbstractInvokeBundler&);
+
+    // ----- bundling support -----------------------------------------------
+
+    public:
+        /**
+         * Process the specified key in a most optimal way according to the
+         * bundle settings.
+         *
+         * @param vKey    the key to process
+         * @param hAgent  the EntryProcessor to use
+         *
+         * @return an execution result according to the caller's contract
+         */
+        Object::Holder process(Object::View vKey,
+                InvocableMap::EntryProcessor::Handle hAgent);
+
+        /**
+         * Process a collection of keys in a most optimal way according to
+         * the bundle settings.
+         *
+         * @param vColKeys  the collection of keys to process
+         * @param hAgent    the EntryProcessor to use
+         *
+         * @return an execution result according to the caller's contract
+         */
+        Map::View processAll(Collection::View vColKeys,
+                InvocableMap::EntryProcessor::Handle hAgent);
+
+        // ----- subclassing support ----------------------------------------
+
+        /**
+         * The bundle operation to be performed against a collected set of
+         * keys which share the specified EntryProcessor by the concrete
+         * AbstractInvokeBundler implementations.
+         *
+         * @param vColKeys  a key collection to perform the bundled operation
+         *                  for
+         * @param hAgent    the EntryProcessor to use
+         *
+         * @return the Map of operation results
+         */
+        virtual Map::View bundle(Collection::View vColKeys,
+                InvocableMap::EntryProcessor::Handle hAgent) = 0;
+
+        /**
+         * Un-bundle bundled operation. This operation is used if the number
+         * of active threads is below the {@link #getThreadThreshold()
+         * ThreadThreshold} value or if the key is already part of the open
+         * bundle for the same EntryProcessor.
+         *
+         * @param vKey    a key to perform the un-bundled operation for
+         * @param hAgent  the EntryProcessor to use
+         *
+         * @return the operation result for the specified key, may be NULL
+         */
+        virtual Object::Holder unbundle(Object::View vKey,
+                InvocableMap::EntryProcessor::Handle hAgent) = 0;
+
+        // ----- AbstractBundler methods ------------------------------------
+
+        /**
+         * {@inheritDoc}
+         */
+        virtual AbstractBundler::Bundle::Handle instantiateBundle();
+
+    // ----- inner class: Bundle --------------------------------------------
+
+    /**
+     * Bundle represents a unit of optimized execution.
+     */
+    protected:
+        class COH_EXPORT Bundle
+            : public class_spec<Bundle,
+                extends<AbstractBundler::Bundle> >
+            {
+            friend class factory<Bundle>;
+
+            // ----- constructors -----------------------------------------
+
+            protected:
+                /**
+                 * Default constructor.
+                 *
+                 * @param hBundler  the AbstractBundler
+                 */
+                Bundle(AbstractBundler::Handle hBundler);
+
+            // ----- bundling support -------------------------------------
+
+            public:
+                /**
+                 * Check whether or not any of the specified keys is already
+                 * part of this Bundle for an EntryProcessor equal to the
+                 * specified one.
+                 *
+                 * <b>Note:</b> a call to this method must be externally
+                 * synchronized for this Bundle object.
+                 *
+                 * @param vColKeys  the keys to check
+                 * @param vAgent    the EntryProcessor
+                 *
+                 * @return true if any of the keys is already bundled with
+                 *         the EntryProcessor
+                 */
+                virtual bool containsAny(Collection::View vColKeys,
+                        InvocableMap::EntryProcessor::View vAgent) const;
+
+                /**
+                 * Add the specified collection of keys to the Bundle.
+                 *
+                 * <b>Note:</b> a call to this method must be externally
+                 * synchronized for this Bundle object.
+                 *
+                 * @param vColKeys  the collection of keys to add to this
+                 *                  Bundle
+                 * @param hAgent    the EntryProcessor to use
+                 *
+                 * @return true if this Bundle was empty prior to this call
+                 */
+                virtual bool addAll(Collection::View vColKeys,
+                        InvocableMap::EntryProcessor::Handle hAgent);
+
+                /**
+                 * Process the specified key collection according to this
+                 * Bundle state.
+                 *
+                 * @param fBurst    true if this thread is supposed to perform
+                 *                  an actual bundled operation (burst); false
+                 *                  otherwise
+                 * @param vColKeys  the collection of keys to process
+                 * @param hAgent    the EntryProcessor to use
+                 *
+                 * @return an execution result according to the caller's
+                 *         contract
+                 */
+                virtual Map::View processAll(bool fBurst, Collection::View vColKeys,
+                        InvocableMap::EntryProcessor::Handle hAgent);
+
+                // ----- AbstractBundler::Bundle methods ------------------
+
+                /**
+                 * {@inheritDoc}
+                 */
+                virtual int32_t getBundleSize() const;
+
+                /**
+                 * {@inheritDoc}
+                 */
+                using AbstractBundler::Bundle::ensureResults;
+
+                /**
+                 * {@inheritDoc}
+                 */
+                virtual void ensureResults();
+
+                /**
+                 * {@inheritDoc}
+                 */
+                virtual bool releaseThread();
+
+            // ----- data fields ------------------------------------------
+
+            private:
+                /**
+                 * The bundled keys, a Set of keys keyed by EntryProcessor.
+                 */
+                FinalHandle<Map> f_hMapKeys;
+
+                /**
+                 * The bundled EntryProcessors, keyed by themselves.
+                 */
+                FinalHandle<Map> f_hMapAgents;
+
+                /**
+                 * The result of the bundled processing keyed by
+                 * EntryProcessor; either the Map of results or the
+                 * Exception raised by the bundled invocation.
+                 */
+                FinalHandle<Map> f_hMapResults;
+
+                /**
+                 * The number of keys in this Bundle.
+                 */
+                int32_t m_cKeys;
+            };
+    };
+
+COH_CLOSE_NAMESPACE3
+
+#endif // COH_ABSTRACT_INVOKE_BUNDLER_HPP
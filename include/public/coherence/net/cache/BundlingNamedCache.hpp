@@ -12,10 +12,12 @@
 #include "coherence/net/NamedCache.hpp"
 #include "coherence/net/cache/AbstractBundler.hpp"
 #include "coherence/net/cache/AbstractEntryBundler.hpp"
+#include "coherence/net/cache/AbstractInvokeBundler.hpp"
 #include "coherence/net/cache/AbstractKeyBundler.hpp"
 #include "coherence/net/cache/WrapperNamedCache.hpp"
 #include "coherence/util/Collection.hpp"
 #include "coherence/util/Collections.hpp"
+#include "coherence/util/InvocableMap.hpp"
 #include "coherence/util/Map.hpp"
 
 COH_OPEN_NAMESPACE3(coherence,net,cache)
@@ -23,11 +25,18 @@ COH_OPEN_NAMESPACE3(coherence,net,cache)
 using coherence::net::NamedCache;
 using coherence::util::Collection;
 using coherence::util::Collections;
+using coherence::util::InvocableMap;
 using coherence::util::Map;
 
 /**
  * Bundling NamedCache implementation.
  *
+ * The get/getAll, put/putAll and remove requests are bundled, as are the
+ * key based invoke/invokeAll requests once an "invoke" bundler has been
+ * configured; invoke requests are grouped by EntryProcessor (see
+ * AbstractInvokeBundler). Filter based invokeAll requests are passed
+ * straight to the underlying cache.
+ *
  * @see AbstractBundler
  * @author gg 2007.02.13
  * @author lh 2012.06.05
@@ -99,6 +108,20 @@ class COH_EXPORT BundlingNamedCache
          */
         virtual AbstractBundler::Handle ensureRemoveBundler(int32_t cBundleThreshold);
 
+        /**
+         * Configure the bundler for the key based "invoke" operations. If
+         * the bundler does not exist and bundling is enabled, it will be
+         * instantiated.
+         *
+         * @param cBundleThreshold  the bundle size threshold; pass zero to
+         *                          disable "invoke" operation bundling
+         *
+         * @return the "invoke" bundler or NULL if bundling is disabled
+         *
+         * @since 15.1.1.0.0
+         */
+        virtual AbstractBundler::Handle ensureInvokeBundler(int32_t cBundleThreshold);
+
     // ----- accessors -------------------------------------------------------
 
     public:
@@ -122,6 +145,15 @@ class COH_EXPORT BundlingNamedCache
          * @return the "remove" bundler
          */
         virtual AbstractBundler::Handle getRemoveBundler();
+
+        /**
+         * Obtain the bundler for the "invoke" operations.
+         *
+         * @return the "invoke" bundler
+         *
+         * @since 15.1.1.0.0
+         */
+        virtual AbstractBundler::Handle getInvokeBundler();
         
     // ----- various bundleable NamedCache methods ---------------------------
 
@@ -160,6 +192,19 @@ class COH_EXPORT BundlingNamedCache
         virtual Object::Holder remove(Object::View vKey);
         using Map::remove;
 
+        /**
+         * {@inheritDoc}
+         */
+        virtual Object::Holder invoke(Object::View vKey,
+                InvocableMap::EntryProcessor::Handle hAgent);
+
+        /**
+         * {@inheritDoc}
+         */
+        virtual Map::View invokeAll(Collection::View vCollKeys,
+                InvocableMap::EntryProcessor::Handle hAgent);
+        using WrapperNamedCache::invokeAll;
+
     // ----- NamedCache interface --------------------------------------------
 
         /**
@@ -353,6 +398,69 @@ class COH_EXPORT BundlingNamedCache
                 FinalHandle<BundlingNamedCache> f_hBundlingNamedCache;
             };
 
+        class COH_EXPORT InvokeBundler
+            : public class_spec<InvokeBundler,
+                extends<AbstractInvokeBundler> >
+            {
+            friend class factory<InvokeBundler>;
+
+            // ----- constructors ---------------------------------------
+
+            protected:
+                /**
+                 * @param hBundlingNamedCache  the BundlingNamedCache this
+                 *                             bundler is associated with
+                 */
+                InvokeBundler(BundlingNamedCache::Handle hBundlingNamedCache);
+
+            // ----- bundle operations ----------------------------------
+
+            protected:
+                /**
+                 * A pass through the underlying "invokeAll" operation.
+                 *
+                 * @param vColKeys  the collection of keys to perform the
+                 *                  bundled operation for
+                 * @param hAgent    the EntryProcessor to use
+                 */
+                virtual Map::View bundle(Collection::View vColKeys,
+                        InvocableMap::EntryProcessor::Handle hAgent);
+
+                /**
+                 * A pass through the underlying "invoke" operation.
+                 *
+                 * @param vKey    the entry key
+                 * @param hAgent  the EntryProcessor to use
+                 */
+                virtual Object::Holder unbundle(Object::View vKey,
+                        InvocableMap::EntryProcessor::Handle hAgent);
+
+            // ----- accessors ------------------------------------------
+
+            public:
+                /**
+                 * Obtain the BundlingNamedCache for this bundler.
+                 *
+                 * @return the BundlingNamedCache
+                 */
+                virtual BundlingNamedCache::Handle getBundlingNamedCache();
+
+                /**
+                 * Obtain the BundlingNamedCache for this bundler.
+                 *
+                 * @return the BundlingNamedCache
+                 */
+                virtual BundlingNamedCache::View getBundlingNamedCache() const;
+
+            // ----- data fields ----------------------------------------
+
+            private:
+                /**
+                 * The BundlingNamedCache for this bundler.
+                 */
+                FinalHandle<BundlingNamedCache> f_hBundlingNamedCache;
+            };
+
     // ----- data fields -----------------------------------------------------
 
     private:
@@ -370,6 +478,11 @@ class COH_EXPORT BundlingNamedCache
          * The bundler for remove() operations.
          */
         MemberHandle<RemoveBundler> m_hRemoveBundler;
+
+        /**
+         * The bundler for invoke() operations.
+         */
+        MemberHandle<InvokeBundler> m_hInvokeBundler;
     };
     
 COH_CLOSE_NAMESPACE3
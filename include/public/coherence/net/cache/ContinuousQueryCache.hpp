@@ -249,6 +249,107 @@ class COH_EXPORT ContinuousQueryCache
         */
         virtual void setReconnectInterval(int64_t cReconnectMillis);
 
+        /**
+        * Return the number of entries retrieved per request while populating
+        * the ContinuousQueryCache with values.
+        *
+        * @return the page size; zero or less if the entire query result is
+        *         retrieved at once
+        *
+        * @since 15.1.1.0.0
+        */
+        virtual int32_t getPageSize() const;
+
+        /**
+        * Specify the number of entries retrieved per request while
+        * populating the ContinuousQueryCache with values. Smaller pages
+        * reduce the memory required while the cache is (re)synchronized, at
+        * the expense of additional requests. Paging is off by default; the
+        * initial value is taken from the coherence.cqc.page.size system
+        * property, and is zero if that property is not set.
+        *
+        * @param cPageSize  the page size; zero or less to retrieve the
+        *                   entire query result at once
+        *
+        * @since 15.1.1.0.0
+        */
+        virtual void setPageSize(int32_t cPageSize);
+
+        /**
+        * Return the ValueExtractor used to obtain the version of a cached
+        * value when the ContinuousQueryCache is resynchronized.
+        *
+        * @return the version extractor, or NULL if resynchronization
+        *         reloads every value
+        *
+        * @since 15.1.1.0.0
+        */
+        virtual ValueExtractor::View getVersionExtractor() const;
+
+        /**
+        * Specify a ValueExtractor which obtains the version of a value,
+        * enabling incremental resynchronization.
+        *
+        * When the ContinuousQueryCache resynchronizes a non-empty local
+        * image with the underlying cache, for instance after a reconnect,
+        * it then only queries the versions of the entries matching its
+        * filter, and retrieves the values for the keys which are new or
+        * whose version differs from the one extracted from the locally
+        * cached value. The extractor must therefore produce equal results
+        * when evaluated against the same value by the cluster and locally.
+        * Incremental resynchronization only applies when values are cached
+        * and no transformer is used.
+        *
+        * @param vExtractor  the version extractor, or NULL to reload every
+        *                    value
+        *
+        * @since 15.1.1.0.0
+        */
+        virtual void setVersionExtractor(ValueExtractor::View vExtractor);
+
+        /**
+        * Determine if the internal cache keeps values in their serialized
+        * (Binary) form, deserializing them each time they are accessed.
+        *
+        * Binary storage trades the cost of deserializing values on access
+        * for a much smaller local image of wide objects. Values received
+        * from a remote cache are stored in the form they were received in,
+        * rather than being deserialized and serialized again. The most
+        * recently decoded values may be retained in a small LRU cache whose
+        * size is given by the coherence.cqc.storage.decoded system property
+        * (zero by default); a retained value is only returned for the entry
+        * it was decoded from, even if other entries hold an equal
+        * serialized value. Local queries and indexes operate on the decoded
+        * values.
+        *
+        * Unless changed by setBinaryStorage, values are stored in
+        * serialized form if the coherence.cqc.storage system property was
+        * set to "binary" when the ContinuousQueryCache was created.
+        *
+        * @return true if values are stored in serialized form
+        *
+        * @since 15.1.1.0.0
+        */
+        virtual bool isBinaryStorage() const;
+
+        /**
+        * Specify whether the internal cache keeps values in their
+        * serialized (Binary) form.
+        *
+        * Changing the storage mode rebuilds and reloads the internal cache.
+        * It is therefore only permitted until indexes or listeners, other
+        * than the listener passed at construction, have been added to this
+        * ContinuousQueryCache.
+        *
+        * @param fBinary  true to store values in serialized form
+        *
+        * @throws IllegalStateException if the storage mode changes while
+        *         indexes or listeners have been added
+        *
+        * @since 15.1.1.0.0
+        */
+        virtual void setBinaryStorage(bool fBinary);
+
         /**
         * Return the Supplier used to provide the name of this ContinuousQueryCache.
         *
@@ -710,6 +811,41 @@ class COH_EXPORT ContinuousQueryCache
         */
         virtual void configureSynchronization(bool fReload) const;
 
+        /**
+        * Populate the internal cache with the current query result, removing
+        * any entries which no longer belong to it.
+        *
+        * If values are cached and paging is off, the entire query result is
+        * retrieved in a single request. Otherwise the keys are queried
+        * first, and any values are then retrieved in pages of
+        * getPageSize() entries on the calling thread.
+        *
+        * @param hMapLocal  the internal cache
+        * @param hCache     the underlying cache
+        * @param vFilter    the query filter
+        *
+        * @since 15.1.1.0.0
+        */
+        virtual void populateInternalCache(ObservableMap::Handle hMapLocal,
+                NamedCache::Handle hCache, Filter::View vFilter) const;
+
+        /**
+        * Bring a non-empty internal cache up to date by comparing the
+        * versions of the entries matching the filter against those of the
+        * locally cached values, and retrieving only the values which
+        * changed.
+        *
+        * @param hMapLocal  the internal cache
+        * @param hCache     the underlying cache
+        * @param vFilter    the query filter
+        *
+        * @see setVersionExtractor
+        *
+        * @since 15.1.1.0.0
+        */
+        virtual void resynchronizeInternalCache(ObservableMap::Handle hMapLocal,
+                NamedCache::Handle hCache, Filter::View vFilter) const;
+
         /**
         * Simple helper to create an exception for communicating invalid state transitions.
         *
@@ -1015,6 +1151,45 @@ class COH_EXPORT ContinuousQueryCache
         */
         int64_t m_cReconnectMillis;
 
+        /**
+        * The number of entries retrieved per request while populating the
+        * cache with values.
+        *
+        * @since 15.1.1.0.0
+        */
+        int32_t m_cPageSize;
+
+        /**
+        * The extractor for the versions compared during incremental
+        * resynchronization, or NULL.
+        *
+        * @since 15.1.1.0.0
+        */
+        MemberView<ValueExtractor> m_vExtractorVersion;
+
+        /**
+        * True if the internal cache stores values in serialized form.
+        *
+        * @since 15.1.1.0.0
+        */
+        bool m_fBinaryStorage;
+
+        /**
+        * The maximum number of decoded values retained when values are
+        * stored in serialized form.
+        *
+        * @since 15.1.1.0.0
+        */
+        int32_t m_cDecodedValues;
+
+        /**
+        * True once a listener has been added to this ContinuousQueryCache
+        * after construction.
+        *
+        * @since 15.1.1.0.0
+        */
+        bool m_fListenersAdded;
+
         /**
         * The timestamp when the synchronization was last attempted.
         */
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2000, 2026, Oracle and/or its affiliates.
+ *
+ * Licensed under the Universal Permissive License v 1.0 as shown at
+ * http://oss.oracle.com/licenses/upl.
+ */
+#ifndef COH_BATCH_MAP_LISTENER_HPP
+#define COH_BATCH_MAP_LISTENER_HPP
+
+#include "coherence/lang.ns"
+
+#include "coherence/util/MapListener.hpp"
+
+COH_OPEN_NAMESPACE2(coherence,util)
+
+
+/**
+* A MapListener which may receive the events queued for it on a service's
+* event dispatcher in batches, rather than through one entryInserted,
+* entryUpdated or entryDeleted call per event.
+*
+* Each time the event dispatcher drains its queue, the events waiting for a
+* BatchMapListener are gathered and delivered through a single
+* onMapEvents call, in the order they were received, up to the
+* dispatcher's maximum batch size (see the coherence.events.batch.size
+* system property). Listeners which apply many small updates can thus take
+* their locks once per batch instead of once per event.
+*
+* Events which are not delivered by an event dispatcher, for instance those
+* raised by local caches or sent to synchronous listeners, continue to be
+* delivered through the individual MapListener methods, which must
+* therefore also be implemented.
+*
+* @since 15.1.1.0.0
+*/
+class COH_EXPORT BatchMapListener
+    : public interface_spec<BatchMapListener,
+        implements<MapListener> >
+    {
+    // ----- BatchMapListener interface -------------------------------------
+
+    public:
+        /**
+        * Invoked with a batch of events for this listener.
+        *
+        * @param vaEvent  the MapEvent objects, in the order in which they
+        *                 occurred; never empty
+        */
+        virtual void onMapEvents(ObjectArray::View vaEvent) = 0;
+    };
+
+COH_CLOSE_NAMESPACE2
+
+#endif // COH_BATCH_MAP_LISTENER_HPP
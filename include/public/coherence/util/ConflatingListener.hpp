@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2000, 2026, Oracle and/or its affiliates.
+ *
+ * Licensed under the Universal Permissive License v 1.0 as shown at
+ * http://oss.oracle.com/licenses/upl.
+ */
+#ifndef COH_CONFLATING_LISTENER_HPP
+#define COH_CONFLATING_LISTENER_HPP
+
+#include "coherence/lang.ns"
+
+COH_OPEN_NAMESPACE2(coherence,util)
+
+/**
+* A tag interface indicating that a MapListener implementation only needs
+* the net effect of the changes made to each key, rather than every
+* individual change.
+*
+* While an event for a given key is still waiting to be delivered to a
+* ConflatingListener, subsequent events for the same key are merged into
+* it: an insert followed by an update is delivered as a single insert, an
+* update followed by a delete as a single delete, and an insert followed by
+* a delete is not delivered at all. The old value of the delivered event is
+* that of the first merged event, and the new value that of the last one.
+*
+* Conflation only takes place when the listener falls behind, and applies
+* to each listener registration independently; other listeners registered
+* against the same cache continue to receive every event.
+*
+* @since 15.1.1.0.0
+*/
+class COH_EXPORT ConflatingListener
+    : public interface_spec<ConflatingListener>
+    {
+    };
+
+COH_CLOSE_NAMESPACE2
+
+#endif // COH_CONFLATING_LISTENER_HPP
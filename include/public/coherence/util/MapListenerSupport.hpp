@@ -267,6 +267,18 @@ class COH_EXPORT MapListenerSupport
         */
         static bool isPrimingListener(MapListener::View listener);
 
+        /**
+        * Check if the given listener is a SemiLiteListener or if it wraps
+        * one.
+        *
+        * @param vListener  Map listener to check
+        *
+        * @return true iff the listener is a SemiLiteListener or wraps one
+        *
+        * @since 15.1.1.0.0
+        */
+        static bool isSemiLiteListener(MapListener::View vListener);
+
 
     // ----- helper methods -------------------------------------------------
 
@@ -631,6 +643,29 @@ class COH_EXPORT MapListenerSupport
             };
 
 
+    // ----- inner class: SemiLiteListener ---------------------------------
+
+    public:
+        /**
+        * A tag interface indicating that tagged MapListener implementation
+        * does not use the old value carried by the MapEvent notifications.
+        * <p>
+        * A remote cache registers a standard (not lite) filter-based
+        * SemiLiteListener with a SemiLiteEventTransformer, so that the
+        * proxy omits the old value from the events it sends for it. Key
+        * listeners and lite listeners are registered as usual.
+        *
+        * @see coherence::util::transformer::SemiLiteEventTransformer
+        *
+        * @since 15.1.1.0.0
+        */
+        class COH_EXPORT SemiLiteListener
+            : public interface_spec<SemiLiteListener,
+                implements<MapListener> >
+            {
+            };
+
+
     // ----- inner class: WrapperSynchronousListener ------------------------
 
     public:
@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2000, 2026, Oracle and/or its affiliates.
+ *
+ * Licensed under the Universal Permissive License v 1.0 as shown at
+ * http://oss.oracle.com/licenses/upl.
+ */
+#ifndef COH_SINGLE_CONSUMER_QUEUE_HPP
+#define COH_SINGLE_CONSUMER_QUEUE_HPP
+
+#include "coherence/lang.ns"
+
+#include "coherence/native/NativeAtomic32.hpp"
+#include "coherence/native/NativeAtomic64.hpp"
+#include "coherence/util/AbstractConcurrentQueue.hpp"
+#include "coherence/util/List.hpp"
+
+COH_OPEN_NAMESPACE2(coherence,util)
+
+using coherence::native::NativeAtomic32;
+using coherence::native::NativeAtomic64;
+
+
+/**
+* The SingleConsumerQueue is a lock-free queue optimized for the case of
+* many producer threads and a single consumer thread, such as the queue of
+* a QueueProcessor.
+*
+* Producers append to the tail of a linked list of nodes by atomically
+* swapping the tail pointer, and never block on one another or on the
+* consumer. The consumer unlinks nodes from the head without any
+* synchronization. As with the DualQueue, the notifier is only signaled
+* when the queue transitions from empty to non-empty, and the consumer
+* spins briefly in waitForEntry before parking on the notifier, so that a
+* busy queue is serviced without any monitor traffic at all.
+*
+* Only a single thread at a time may call the removal methods (remove,
+* removeNoWait and peekNoWait); any number of threads may concurrently call
+* add and addHead. The rarely used addHead operation is not lock-free.
+*
+* @since 15.1.1.0.0
+*/
+class COH_EXPORT SingleConsumerQueue
+    : public class_spec<SingleConsumerQueue,
+        extends<AbstractConcurrentQueue> >
+    {
+    friend class factory<SingleConsumerQueue>;
+
+    // ----- constructors ---------------------------------------------------
+
+    protected:
+        /**
+        * Create a new SingleConsumerQueue.
+        *
+        * @return a new SingleConsumerQueue
+        */
+        SingleConsumerQueue();
+
+        /**
+        * Destroy the SingleConsumerQueue, releasing any remaining elements.
+        */
+        virtual ~SingleConsumerQueue();
+
+    private:
+        /**
+        * Blocked copy constructor.
+        */
+        SingleConsumerQueue(const SingleConsumerQueue&);
+
+
+    // ----- SingleConsumerQueue interface ----------------------------------
+
+    public:
+        /**
+        * Return the number of times the consumer checks for a new element
+        * before parking on the notifier in waitForEntry.
+        *
+        * @return the spin count
+        */
+        virtual int32_t getSpinCount() const;
+
+        /**
+        * Set the number of times the consumer checks for a new element
+        * before parking on the notifier in waitForEntry.
+        *
+        * @param cSpin  the spin count; zero disables spinning
+        */
+        virtual void setSpinCount(int32_t cSpin);
+
+
+    // ----- AbstractConcurrentQueue interface ------------------------------
+
+    public:
+        /**
+        * {@inheritDoc}
+        */
+        virtual void waitForEntry(int64_t cMillis);
+
+
+    // ----- Queue interface ------------------------------------------------
+
+    public:
+        /**
+        * {@inheritDoc}
+        */
+        virtual bool add(Object::Holder oh);
+
+        /**
+        * {@inheritDoc}
+        */
+        virtual bool addHead(Object::Holder oh);
+
+        /**
+        * {@inheritDoc}
+        */
+        virtual bool isEmpty() const;
+
+        /**
+        * {@inheritDoc}
+        */
+        virtual Object::Holder peekNoWait();
+
+        /**
+        * {@inheritDoc}
+        */
+        virtual Object::Holder removeNoWait();
+
+
+    // ----- internal helpers -----------------------------------------------
+
+    protected:
+        /**
+        * Node in the linked list; defined in the implementation file.
+        */
+        class Node;
+
+        /**
+        * Return the first node after the head, waiting for a producer which
+        * has swapped the tail but not yet linked its node if necessary.
+        *
+        * May only be called by the consumer, and only when the counters
+        * indicate that the list is not empty.
+        *
+        * @return the first node containing an element
+        */
+        Node* getFirstNode() const;
+
+
+    // ----- data members ---------------------------------------------------
+
+    protected:
+        /**
+        * The stub node preceding the first element, only accessed by the
+        * consumer.
+        */
+        Node* m_pHead;
+
+        /**
+        * The address of the last node in the list, swapped atomically by
+        * producers.
+        */
+        NativeAtomic64 m_lTail;
+
+        /**
+        * Elements added via addHead which have yet to be removed, most
+        * recent first.
+        */
+        FinalHandle<List> f_hListHead;
+
+        /**
+        * The number of elements in f_hListHead, allowing the consumer to
+        * skip synchronizing on it in the common case.
+        */
+        NativeAtomic32 m_cHead;
+
+        /**
+        * The number of times the consumer checks for a new element before
+        * parking.
+        */
+        int32_t m_cSpin;
+    };
+
+COH_CLOSE_NAMESPACE2
+
+#endif // COH_SINGLE_CONSUMER_QUEUE_HPP
@@ -226,6 +226,28 @@ class COH_EXPORT LikeFilter
                 virtual size32_t indexOf(Array<char>::View vach,
                         size32_t ofBegin, size32_t ofEnd) const;
 
+                /**
+                * Find the first index of this match step in the passed
+                * ASCII characters starting at the passed offset and
+                * within the specified number of characters.
+                *
+                * @param ach      the characters within which to find a
+                *                 match
+                * @param ofBegin  the starting offset in <tt>ach</tt> to
+                *                 start looking for a match
+                * @param ofEnd    the first offset in <tt>ach</tt> which is
+                *                 beyond the region that this operation is
+                *                 allowed to search through
+                *
+                * @return the first index at which the match is made,
+                * or Array<char>::npos if the match cannot be made in the
+                * designated range of offsets
+                *
+                * @since 15.1.1.0.0
+                */
+                virtual size32_t indexOf(const char* ach, size32_t ofBegin,
+                        size32_t ofEnd) const;
+
             // ----- accessors ------------------------------------------
 
             public:
@@ -15,7 +15,8 @@ AbstractPofMessage::AbstractPofMessage()
     : f_hChannel(self()),
       m_nDataVersion(0),
       m_nImplVersion(0),
-      f_vBinFuture(self())
+      f_vBinFuture(self()),
+      m_nPriority(priority_normal)
     {
     }
 
@@ -112,4 +113,14 @@ void AbstractPofMessage::setImplVersion(int32_t nVersion)
     m_nImplVersion = nVersion;
     }
 
+int32_t AbstractPofMessage::getPriority() const
+    {
+    return m_nPriority;
+    }
+
+void AbstractPofMessage::setPriority(int32_t nPriority)
+    {
+    m_nPriority = nPriority;
+    }
+
 COH_CLOSE_NAMESPACE4
@@ -34,6 +34,7 @@ AbstractPofRequest::Status::Status()
       m_ldtDefaultTimeoutMillis(0),
       f_ohError(self()),
       m_ldtInitTimeMillis(System::currentTimeMillis()),
+      m_ldtDeadlineMillis(self(), 0),
       f_hRequest(self()),
       f_hResponse(self())
     {
@@ -47,6 +48,10 @@ bool AbstractPofRequest::isIncoming() const
     return NULL == getStatus();
     }
 
+void AbstractPofRequest::onCompleted()
+    {
+    }
+
 
 // ----- Request interface --------------------------------------------------
 
@@ -184,6 +189,19 @@ void AbstractPofRequest::Status::cancel(Exception::Holder ohe)
     if (NULL != hChannel)
         {
         hChannel->onRequestCompleted(this);
+
+        // every Request which misses its deadline ends up here exactly once,
+        // regardless of which thread noticed it
+        if (instanceof<RequestTimeoutException::View>(ohe))
+            {
+            Peer::Handle hManager = hChannel->getConnectionManager();
+            if (NULL != hManager)
+                {
+                hManager->onRequestTimeout();
+                }
+            }
+
+        notifyCompleted();
         }
     }
 
@@ -352,6 +370,16 @@ void AbstractPofRequest::Status::onCompletion()
     notifyAll();
     }
 
+void AbstractPofRequest::Status::notifyCompleted()
+    {
+    AbstractPofRequest::Handle hRequest =
+            cast<AbstractPofRequest::Handle>(getRequest(), false);
+    if (NULL != hRequest)
+        {
+        hRequest->onCompleted();
+        }
+    }
+
 
 // ----- accessors ----------------------------------------------------------
 
@@ -370,6 +398,11 @@ int64_t AbstractPofRequest::Status::getInitTimeMillis() const
     return m_ldtInitTimeMillis;
     }
 
+int64_t AbstractPofRequest::Status::getDeadlineMillis() const
+    {
+    return m_ldtDeadlineMillis;
+    }
+
 PofChannel::Handle AbstractPofRequest::Status::getChannel()
     {
     return f_hChannel;
@@ -417,6 +450,7 @@ void AbstractPofRequest::Status::setResponse(Response::Handle hResponse)
     if (NULL != hChannel)
         {
         hChannel->onRequestCompleted(this);
+        notifyCompleted();
         }
     }
 
@@ -425,4 +459,9 @@ void AbstractPofRequest::Status::setDefaultTimeoutMillis(int64_t cMillis)
     m_ldtDefaultTimeoutMillis = cMillis;
     }
 
+void AbstractPofRequest::Status::setDeadlineMillis(int64_t ldtDeadline)
+    {
+    m_ldtDeadlineMillis = ldtDeadline;
+    }
+
 COH_CLOSE_NAMESPACE4
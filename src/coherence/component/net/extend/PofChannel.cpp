@@ -15,10 +15,13 @@
 #include "coherence/io/pof/PofBufferWriter.hpp"
 
 #include "coherence/net/PriorityTask.hpp"
+#include "coherence/net/RequestTimeoutException.hpp"
 
 #include "coherence/net/messaging/ConnectionException.hpp"
 
+#include "coherence/util/ArrayList.hpp"
 #include "coherence/util/Iterator.hpp"
+#include "coherence/util/List.hpp"
 #include "coherence/util/LongArrayIterator.hpp"
 #include "coherence/util/SafeHashMap.hpp"
 
@@ -52,10 +55,13 @@ using coherence::io::pof::PofBufferReader;
 using coherence::net::messaging::ConnectionException;
 using coherence::net::messaging::Response;
 using coherence::net::PriorityTask;
+using coherence::net::RequestTimeoutException;
 using coherence::security::SecurityHelper;
+using coherence::util::ArrayList;
 using coherence::util::HashArray;
 using coherence::util::HashMap;
 using coherence::util::Iterator;
+using coherence::util::List;
 using coherence::util::LongArrayIterator;
 using coherence::util::SafeHashMap;
 
@@ -445,6 +451,63 @@ void PofChannel::openInternal()
     getConnectionManager()->onChannelOpened(this);
     }
 
+int32_t PofChannel::purgeExpiredRequests(int64_t ldtNow)
+    {
+    // collect the expired requests while holding the lock, but cancel them
+    // outside of it, as cancellation notifies the waiting threads
+    LongArray::Handle hlaRequest  = f_hlaRequest;
+    List::Handle      hlExpired   = NULL;
+    int64_t           ldtEarliest = Integer64::max_value;
+
+    COH_SYNCHRONIZED (hlaRequest)
+        {
+        for (LongArrayIterator::Handle hIter = hlaRequest->iterator();
+                hIter->hasNext(); )
+            {
+            AbstractPofRequest::Status::Handle hStatus =
+                    cast<AbstractPofRequest::Status::Handle>(hIter->next());
+
+            int64_t ldtDeadline = hStatus->getDeadlineMillis();
+            if (ldtDeadline > 0 && ldtNow >= ldtDeadline)
+                {
+                if (NULL == hlExpired)
+                    {
+                    hlExpired = ArrayList::create();
+                    }
+                hlExpired->add(hStatus);
+                hIter->remove();
+                }
+            else if (ldtDeadline > 0 && ldtDeadline < ldtEarliest)
+                {
+                ldtEarliest = ldtDeadline;
+                }
+            }
+        }
+
+    // schedule the next check for the Requests which remain pending
+    Peer::Handle hManager = getConnectionManager();
+    if (ldtEarliest != Integer64::max_value && NULL != hManager)
+        {
+        hManager->onRequestDeadline(ldtEarliest);
+        }
+
+    if (NULL == hlExpired)
+        {
+        return 0;
+        }
+
+    for (Iterator::Handle hIter = hlExpired->iterator(); hIter->hasNext(); )
+        {
+        AbstractPofRequest::Status::Handle hStatus =
+                cast<AbstractPofRequest::Status::Handle>(hIter->next());
+
+        hStatus->cancel(RequestTimeoutException::create(COH_TO_STRING(
+                "request timed out after " << (ldtNow - hStatus->getInitTimeMillis())
+                << " millis")));
+        }
+    return (int32_t) hlExpired->size();
+    }
+
 void PofChannel::receive(Message::Handle hMessage)
     {
     COH_ENSURE_PARAM(hMessage);
@@ -848,6 +911,20 @@ Request::Status::Handle PofChannel::send(Request::Handle hRequest)
     return hStatus;
     }
 
+Request::Status::Handle PofChannel::send(Request::Handle hRequest, int64_t cMillis)
+    {
+    if (NULL == hRequest)
+        {
+        COH_THROW (IllegalArgumentException::create("request cannot be NULL"));
+        }
+
+    Request::Status::Handle hStatus = registerRequest(hRequest);
+    setRequestDeadline(hStatus, cMillis);
+    post(hRequest);
+
+    return hStatus;
+    }
+
 Object::Holder PofChannel::request(Request::Handle hRequest)
     {
     return request(hRequest, -1);
@@ -867,6 +944,10 @@ Object::Holder PofChannel::request(Request::Handle hRequest, int64_t cMillis)
         }
 
     Request::Status::Handle hStatus = registerRequest(hRequest);
+
+    // nothing waits for the Response past the timeout, so the Request may
+    // be dropped if it has not been sent by then
+    setRequestDeadline(hStatus, cMillis);
     post(hRequest);
 
     Response::Handle hResponse = hStatus->waitForResponse(cMillis);
@@ -1142,6 +1223,26 @@ Request::Status::Handle PofChannel::registerRequest(Request::Handle hRequest)
     return hStatus;
     }
 
+void PofChannel::setRequestDeadline(Request::Status::Handle hStatus,
+        int64_t cMillis)
+    {
+    AbstractPofRequest::Status::Handle hPofStatus =
+            cast<AbstractPofRequest::Status::Handle>(hStatus);
+
+    int64_t cTimeout = cMillis == -1 ? hPofStatus->getDefaultTimeoutMillis() : cMillis;
+    if (cTimeout > 0)
+        {
+        int64_t ldtDeadline = System::currentTimeMillis() + cTimeout;
+        hPofStatus->setDeadlineMillis(ldtDeadline);
+
+        Peer::Handle hManager = getConnectionManager();
+        if (NULL != hManager)
+            {
+            hManager->onRequestDeadline(ldtDeadline);
+            }
+        }
+    }
+
 void PofChannel::unregisterRequest(Request::Status::View vStatus)
     {
     COH_ENSURE(NULL != vStatus);
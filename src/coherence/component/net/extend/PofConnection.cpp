@@ -706,6 +706,9 @@ bool PofConnection::ping()
         PingRequest::Handle            hRequest  = cast<PingRequest::Handle>(
                 vFactory->createMessage(PingRequest::type_id));
 
+        // a heartbeat must not wait behind large Messages
+        hRequest->setPriority(AbstractPofMessage::priority_high);
+
         try
             {
             hChannel0->send((Request::Handle) hRequest);
@@ -735,6 +738,11 @@ void PofConnection::resetStats()
     }
 
 void PofConnection::send(WriteBuffer::View vwb)
+    {
+    send(vwb, AbstractPofMessage::priority_normal);
+    }
+
+void PofConnection::send(WriteBuffer::View vwb, int32_t /*nPriority*/)
     {
     assertOpen();
 
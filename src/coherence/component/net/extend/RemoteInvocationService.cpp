@@ -9,10 +9,12 @@
 #include "coherence/net/Member.hpp"
 #include "coherence/util/HashMap.hpp"
 
+#include "private/coherence/component/net/extend/PofChannel.hpp"
 #include "private/coherence/component/net/extend/protocol/invocation/InvocationServiceProtocol.hpp"
 #include "private/coherence/component/net/extend/protocol/invocation/InvocationRequest.hpp"
 #include "private/coherence/net/messaging/ConnectionInitiator.hpp"
 #include "private/coherence/net/messaging/Protocol.hpp"
+#include "private/coherence/net/messaging/Request.hpp"
 #include "private/coherence/security/SecurityHelper.hpp"
 
 COH_OPEN_NAMESPACE4(coherence,component,net,extend)
@@ -22,6 +24,7 @@ using coherence::component::net::extend::protocol::invocation::InvocationRequest
 using coherence::net::Member;
 using coherence::net::messaging::ConnectionInitiator;
 using coherence::net::messaging::Protocol;
+using coherence::net::messaging::Request;
 using coherence::util::HashMap;
 using coherence::security::SecurityHelper;
 
@@ -64,6 +67,51 @@ Map::View RemoteInvocationService::query(Invocable::Handle hTask, Set::View vSet
     return hMap;
     }
 
+void RemoteInvocationService::execute(Invocable::Handle hTask,
+        Set::View vSetMembers, InvocationObserver::Handle hObserver)
+    {
+    if (NULL == hTask)
+        {
+        COH_THROW (IllegalArgumentException::create("task cannot be NULL"));
+        }
+
+    if (NULL != vSetMembers)
+        {
+        COH_THROW (IllegalArgumentException::create("directed execute not supported; "
+                "the specified Member set must be NULL"));
+        }
+
+    Channel::Handle                 hChannel = ensureChannel();
+    Protocol::MessageFactory::View  vFactory = hChannel->getMessageFactory();
+    InvocationRequest::Handle       hRequest = cast<InvocationRequest::Handle>(
+            vFactory->createMessage(InvocationRequest::type_id));
+
+    hRequest->setTask(hTask);
+    if (NULL != hObserver)
+        {
+        hRequest->setObserver(hObserver);
+        hRequest->setMember(getOperationalContext()->getLocalMember());
+        }
+
+    try
+        {
+        // nothing waits for the Response, so the Status is given the
+        // request timeout as a deadline; an expired Status is reported to
+        // the observer as a failure
+        cast<PofChannel::Handle>(hChannel)->send((Request::Handle) hRequest, -1);
+        }
+    catch (Exception::View e)
+        {
+        // once the Status has been closed the failure has already been
+        // reported to the observer
+        Request::Status::View vStatus = hRequest->getStatus();
+        if (NULL == hObserver || NULL == vStatus || !vStatus->isClosed())
+            {
+            COH_THROW (e);
+            }
+        }
+    }
+
 
 // ----- ServiceInfo interface ----------------------------------------------
 
@@ -43,6 +43,9 @@
 
 #include "coherence/util/filter/InKeySetFilter.hpp"
 #include "coherence/util/filter/LimitFilter.hpp"
+#include "coherence/util/filter/MapEventTransformerFilter.hpp"
+
+#include "coherence/util/transformer/SemiLiteEventTransformer.hpp"
 
 #include "private/coherence/component/net/extend/protocol/cache/AggregateAllRequest.hpp"
 #include "private/coherence/component/net/extend/protocol/cache/AggregateFilterRequest.hpp"
@@ -127,6 +130,7 @@ using coherence::util::List;
 using coherence::util::Listeners;
 using coherence::util::logging::Logger;
 using coherence::util::LongArrayIterator;
+using coherence::util::MapEventTransformer;
 using coherence::util::MapTriggerListener;
 using coherence::util::NullImplementation;
 using coherence::util::PagedMuterator;
@@ -139,6 +143,8 @@ using coherence::util::comparator::EntryComparator;
 using coherence::util::comparator::SafeComparator;
 using coherence::util::filter::InKeySetFilter;
 using coherence::util::filter::LimitFilter;
+using coherence::util::filter::MapEventTransformerFilter;
+using coherence::util::transformer::SemiLiteEventTransformer;
 
 
 // ----- constructors -------------------------------------------------------
@@ -2657,12 +2663,30 @@ void RemoteNamedCache::removeKeyListener(MapListener::Handle hListener,
 
 void RemoteNamedCache::addMapListener(MapListener::Handle hListener)
     {
-    getBinaryCache()->addMapListener(instantiateConverterListener(hListener));
+    Filter::View vFilter = getListenerFilter(hListener, NULL, false);
+    if (NULL == vFilter)
+        {
+        getBinaryCache()->addMapListener(instantiateConverterListener(hListener));
+        }
+    else
+        {
+        getBinaryCache()->addFilterListener(
+                instantiateConverterListener(hListener), vFilter, false);
+        }
     }
 
 void RemoteNamedCache::removeMapListener(MapListener::Handle hListener)
     {
-    getBinaryCache()->removeMapListener(instantiateConverterListener(hListener));
+    MapListener::Handle hConvListener = instantiateConverterListener(hListener);
+    Filter::View        vFilter       = getListenerFilter(hListener, NULL, false);
+    if (NULL == vFilter || !isListenerRegistered(hConvListener, vFilter))
+        {
+        getBinaryCache()->removeMapListener(hConvListener);
+        }
+    else
+        {
+        getBinaryCache()->removeFilterListener(hConvListener, vFilter);
+        }
     }
 
 void RemoteNamedCache::addFilterListener(MapListener::Handle hListener,
@@ -2680,7 +2704,7 @@ void RemoteNamedCache::addFilterListener(MapListener::Handle hListener,
             }
 
         getBinaryCache()->addFilterListener(instantiateConverterListener(hListener),
-                vFilter, fLite);
+                getListenerFilter(hListener, vFilter, fLite), fLite);
         }
     }
 
@@ -2698,8 +2722,13 @@ void RemoteNamedCache::removeFilterListener(MapListener::Handle hListener,
             (cast<InKeySetFilter::View>(vFilter))->ensureConverted(getConverterKeyToBinary());
             }
 
-        getBinaryCache()->removeFilterListener(
-                instantiateConverterListener(hListener), vFilter);
+        // a standard SemiLiteListener is registered under the filter
+        // returned by getListenerFilter, a lite one under the filter itself
+        MapListener::Handle hConvListener = instantiateConverterListener(hListener);
+        Filter::View        vFilterSemi   = getListenerFilter(hListener, vFilter, false);
+        getBinaryCache()->removeFilterListener(hConvListener,
+                vFilterSemi != vFilter && isListenerRegistered(hConvListener, vFilterSemi)
+                        ? vFilterSemi : vFilter);
         }
     }
 
@@ -2923,6 +2952,32 @@ MapListener::Handle RemoteNamedCache::instantiateConverterListener(
         }
     }
 
+Filter::View RemoteNamedCache::getListenerFilter(MapListener::View vListener,
+        Filter::View vFilter, bool fLite) const
+    {
+    // lite events carry no values, triggers and priming listeners have their
+    // own registration semantics, and a transformer-filter already decides
+    // the content of its events
+    if (fLite || !MapListenerSupport::isSemiLiteListener(vListener) ||
+            MapListenerSupport::isPrimingListener(vListener) ||
+            instanceof<MapTriggerListener::View>(vListener) ||
+            instanceof<MapEventTransformer::View>(vFilter))
+        {
+        return vFilter;
+        }
+
+    return MapEventTransformerFilter::create(vFilter,
+            SemiLiteEventTransformer::getInstance());
+    }
+
+bool RemoteNamedCache::isListenerRegistered(MapListener::Handle hConvListener,
+        Filter::View vFilter) const
+    {
+    Listeners::View vListeners =
+            getBinaryCache()->getMapListenerSupport()->getListeners(vFilter);
+    return vListeners != NULL && vListeners->contains(hConvListener);
+    }
+
 RemoteNamedCache::BinaryCache::Handle RemoteNamedCache::instantiateBinaryCache()
     {
     return BinaryCache::create(this);
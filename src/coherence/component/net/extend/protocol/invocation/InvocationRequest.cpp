@@ -6,13 +6,101 @@
  */
 #include "private/coherence/component/net/extend/protocol/invocation/InvocationRequest.hpp"
 
+#include "coherence/net/messaging/ConnectionException.hpp"
+
+#include "private/coherence/component/net/extend/AbstractPofRequest.hpp"
+#include "private/coherence/component/net/extend/PofChannel.hpp"
+#include "private/coherence/component/util/Peer.hpp"
+#include "private/coherence/net/messaging/Response.hpp"
+
 COH_OPEN_NAMESPACE6(coherence,component,net,extend,protocol,invocation)
 
+using coherence::component::net::extend::AbstractPofRequest;
+using coherence::component::net::extend::PofChannel;
+using coherence::component::util::Peer;
+using coherence::net::messaging::ConnectionException;
+using coherence::net::messaging::Response;
+
+COH_OPEN_NAMESPACE_ANON(InvocationRequest)
+
+/**
+* Runnable which reports the outcome of a completed InvocationRequest to an
+* InvocationObserver.
+*
+* @since 15.1.1.0.0
+*/
+class InvocationNotification
+        : public class_spec<InvocationNotification,
+          extends<Object>,
+          implements<Runnable> >
+    {
+    friend class factory<InvocationNotification>;
+
+    // ---- constructors ----------------------------------------------------
+
+    protected:
+        /**
+        * Create a new InvocationNotification.
+        *
+        * @param hObserver  the InvocationObserver to notify
+        * @param vMember    the Member which executed the task
+        * @param hStatus    the closed Status of the InvocationRequest
+        */
+        InvocationNotification(InvocationObserver::Handle hObserver,
+                Member::View vMember, AbstractPofRequest::Status::Handle hStatus)
+                : f_hObserver(self(), hObserver),
+                  f_vMember(self(), vMember),
+                  f_hStatus(self(), hStatus)
+            {
+            }
+
+    private:
+        /**
+        * Blocked copy constructor.
+        */
+        InvocationNotification(const InvocationNotification&);
+
+    // ----- Runnable interface ---------------------------------------------
+
+    public:
+        virtual void run()
+            {
+            InvocationObserver::Handle         hObserver = f_hObserver;
+            AbstractPofRequest::Status::Handle hStatus   = f_hStatus;
+            Exception::Holder                  ohe       = hStatus->getError();
+
+            if (NULL == ohe)
+                {
+                hObserver->memberCompleted(f_vMember,
+                        hStatus->getResponse()->getResult());
+                }
+            else if (instanceof<ConnectionException::View>(ohe))
+                {
+                // the Channel to the proxy was closed before it responded
+                hObserver->memberLeft(f_vMember);
+                }
+            else
+                {
+                hObserver->memberFailed(f_vMember, ohe);
+                }
+            hObserver->invocationCompleted();
+            }
+
+    // ----- data members ---------------------------------------------------
+
+    protected:
+        FinalHandle<InvocationObserver>         f_hObserver;
+        FinalView<Member>                       f_vMember;
+        FinalHandle<AbstractPofRequest::Status> f_hStatus;
+    };
+
+COH_CLOSE_NAMESPACE_ANON
+
 
 // ----- constructors -------------------------------------------------------
 
 InvocationRequest::InvocationRequest()
-    : f_vTask(self())
+    : f_vTask(self()), f_hObserver(self()), f_vMember(self())
     {
     }
 
@@ -50,6 +138,33 @@ String::View InvocationRequest::getDescription() const
     }
 
 
+// ----- AbstractPofRequest interface ---------------------------------------
+
+void InvocationRequest::onCompleted()
+    {
+    InvocationObserver::Handle hObserver = getObserver();
+    if (NULL == hObserver)
+        {
+        return;
+        }
+
+    Runnable::Handle hTask = InvocationNotification::create(hObserver,
+            getMember(), cast<AbstractPofRequest::Status::Handle>(getStatus()));
+    try
+        {
+        PofChannel::Handle hChannel = cast<PofChannel::Handle>(getChannel());
+        hChannel->getConnectionManager()->ensureEventDispatcher()
+                ->getQueue()->add(hTask);
+        }
+    catch (Exception::View e)
+        {
+        // the Connection manager is no longer able to dispatch events
+        // (e.g. it is shutting down); notify on the completing thread
+        hTask->run();
+        }
+    }
+
+
 // ----- internal methods ---------------------------------------------------
 
 void InvocationRequest::onRun(AbstractPofResponse::Handle /*hResponse*/)
@@ -70,4 +185,24 @@ void InvocationRequest::setTask(Invocable::View vTask)
     initialize(f_vTask, vTask);
     }
 
+InvocationObserver::Handle InvocationRequest::getObserver()
+    {
+    return f_hObserver;
+    }
+
+void InvocationRequest::setObserver(InvocationObserver::Handle hObserver)
+    {
+    initialize(f_hObserver, hObserver);
+    }
+
+Member::View InvocationRequest::getMember() const
+    {
+    return f_vMember;
+    }
+
+void InvocationRequest::setMember(Member::View vMember)
+    {
+    initialize(f_vMember, vMember);
+    }
+
 COH_CLOSE_NAMESPACE6
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2000, 2026, Oracle and/or its affiliates.
+ *
+ * Licensed under the Universal Permissive License v 1.0 as shown at
+ * http://oss.oracle.com/licenses/upl.
+ */
+#include "private/coherence/component/net/extend/util/PriorityGate.hpp"
+
+#include <algorithm>
+
+COH_OPEN_NAMESPACE5(coherence,component,net,extend,util)
+
+
+// ----- constructors -------------------------------------------------------
+
+PriorityGate::PriorityGate(int32_t cLanes, int32_t cMaxBypass)
+        : f_hacWaiting(self(), Array<int32_t>::create(std::max(cLanes, 1))),
+          m_cBypass(0),
+          m_cMaxBypass(std::max(cMaxBypass, 1)),
+          m_fEntered(false)
+    {
+    }
+
+
+// ----- PriorityGate interface ---------------------------------------------
+
+void PriorityGate::enter(int32_t nLane)
+    {
+    COH_SYNCHRONIZED (this)
+        {
+        Array<int32_t>::Handle hacWaiting = f_hacWaiting;
+        int32_t                cLanes     = (int32_t) hacWaiting->length;
+
+        nLane = std::min(std::max(nLane, 0), cLanes - 1);
+
+        // the wait is uninterruptible, as was the monitor on the
+        // OutputStream which the gate replaces; a writer which gave up its
+        // place would lose its Message
+        bool fInterrupted = false;
+        ++hacWaiting[nLane];
+        while (!isAdmissible(nLane))
+            {
+            try
+                {
+                wait();
+                }
+            catch (InterruptedException::View)
+                {
+                fInterrupted = true;
+                }
+            }
+        --hacWaiting[nLane];
+
+        if (fInterrupted)
+            {
+            Thread::currentThread()->interrupt();
+            }
+        m_fEntered = true;
+
+        // count the admissions which bypass a lower priority lane; once a
+        // lower lane is admitted nothing is left behind
+        bool fBypass = false;
+        for (int32_t i = nLane + 1; i < cLanes && !fBypass; ++i)
+            {
+            fBypass = hacWaiting[i] > 0;
+            }
+        m_cBypass = fBypass ? m_cBypass + 1 : 0;
+        }
+    }
+
+void PriorityGate::exit()
+    {
+    COH_SYNCHRONIZED (this)
+        {
+        m_fEntered = false;
+        notifyAll();
+        }
+    }
+
+int32_t PriorityGate::getWaitingCount(int32_t nLane) const
+    {
+    COH_SYNCHRONIZED (this)
+        {
+        Array<int32_t>::View vacWaiting = f_hacWaiting;
+        return nLane >= 0 && nLane < (int32_t) vacWaiting->length
+                ? vacWaiting[nLane] : 0;
+        }
+    }
+
+
+// ----- helpers ------------------------------------------------------------
+
+bool PriorityGate::isAdmissible(int32_t nLane) const
+    {
+    if (m_fEntered)
+        {
+        return false;
+        }
+
+    Array<int32_t>::View vacWaiting = f_hacWaiting;
+    int32_t              cLanes     = (int32_t) vacWaiting->length;
+
+    if (m_cBypass >= m_cMaxBypass)
+        {
+        // admit the lowest priority waiting lane
+        for (int32_t i = cLanes - 1; i > nLane; --i)
+            {
+            if (vacWaiting[i] > 0)
+                {
+                return false;
+                }
+            }
+        }
+    else
+        {
+        // admit the highest priority waiting lane
+        for (int32_t i = 0; i < nLane; ++i)
+            {
+            if (vacWaiting[i] > 0)
+                {
+                return false;
+                }
+            }
+        }
+    return true;
+    }
+
+COH_CLOSE_NAMESPACE5
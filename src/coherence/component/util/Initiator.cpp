@@ -8,7 +8,9 @@
 
 #include "coherence/net/RequestTimeoutException.hpp"
 #include "coherence/security/auth/Subject.hpp"
+#include "coherence/util/Iterator.hpp"
 
+#include "private/coherence/component/net/extend/PofChannel.hpp"
 #include "private/coherence/component/net/extend/PofConnection.hpp"
 #include "private/coherence/component/net/extend/protocol/InitiatorProtocol.hpp"
 #include "private/coherence/component/net/extend/protocol/OpenConnection.hpp"
@@ -22,6 +24,7 @@
 
 COH_OPEN_NAMESPACE3(coherence,component,util)
 
+using coherence::component::net::extend::PofChannel;
 using coherence::component::net::extend::PofConnection;
 using coherence::component::net::extend::protocol::InitiatorProtocol;
 using coherence::component::net::extend::protocol::OpenConnection;
@@ -31,6 +34,7 @@ using coherence::net::messaging::Protocol;
 using coherence::net::messaging::Request;
 using coherence::security::SecurityHelper;
 using coherence::security::auth::Subject;
+using coherence::util::Iterator;
 
 
 // ----- constructor --------------------------------------------------------
@@ -92,6 +96,19 @@ void Initiator::checkPingTimeouts()
         }
     }
 
+void Initiator::checkRequestTimeouts(int64_t ldtNow)
+    {
+    PofConnection::Handle hConnection = getConnection();
+    if (NULL != hConnection)
+        {
+        for (Iterator::Handle hIter = hConnection->getChannels()->iterator();
+                hIter->hasNext(); )
+            {
+            cast<PofChannel::Handle>(hIter->next())->purgeExpiredRequests(ldtNow);
+            }
+        }
+    }
+
 void Initiator::onConnectionClosed(PofConnection::Handle hConnection)
     {
     if (getConnection() == hConnection)
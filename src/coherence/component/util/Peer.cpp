@@ -19,6 +19,8 @@
 #include "coherence/util/Listeners.hpp"
 #include "coherence/util/Iterator.hpp"
 
+#include "private/coherence/component/net/extend/AbstractPofMessage.hpp"
+#include "private/coherence/component/net/extend/AbstractPofRequest.hpp"
 #include "private/coherence/component/net/extend/PofChannel.hpp"
 #include "private/coherence/component/net/extend/PofCodec.hpp"
 
@@ -36,10 +38,13 @@
 #include "private/coherence/component/net/extend/protocol/PeerProtocol.hpp"
 #include "private/coherence/component/net/extend/protocol/PeerMessageFactory.hpp"
 
+#include "private/coherence/lang/Allocator.hpp"
+
 #include "private/coherence/net/messaging/Request.hpp"
 
 #include "private/coherence/run/xml/XmlHelper.hpp"
 
+#include "private/coherence/util/NarrowStringStream.hpp"
 #include "private/coherence/util/StringHelper.hpp"
 
 #include "private/coherence/util/logging/Logger.hpp"
@@ -49,6 +54,8 @@
 
 COH_OPEN_NAMESPACE3(coherence,component,util)
 
+using coherence::component::net::extend::AbstractPofMessage;
+using coherence::component::net::extend::AbstractPofRequest;
 using coherence::component::net::extend::PofCodec;
 using coherence::component::net::extend::protocol::AcceptChannel;
 using coherence::component::net::extend::protocol::AcceptChannelResponse;
@@ -77,8 +84,19 @@ using coherence::util::ArrayList;
 using coherence::util::HashMap;
 using coherence::util::Iterator;
 using coherence::util::Listeners;
+using coherence::util::NarrowStringStream;
 using coherence::util::StringHelper;
 
+COH_OPEN_NAMESPACE_ANON(Peer)
+
+/**
+* The number of milliseconds between successive checks for expired
+* Requests.
+*/
+const int64_t REQUEST_CHECK_INTERVAL = 1000L;
+
+COH_CLOSE_NAMESPACE_ANON
+
 
 // ----- static initialization ----------------------------------------------
 
@@ -102,12 +120,15 @@ Peer::Peer()
       f_vProtocolVersionMap(self()),
       f_hReceiverMap(self(), HashMap::create()),
       m_cRequestTimeout(30000),
+      m_ldtRequestLastCheckMillis(0),
+      m_ldtRequestDeadlineMillis(Integer64::max_value),
       m_cbMaxIncomingMessageSize(0),
       m_cbMaxOutgoingMessageSize(0),
+      m_cbBulkMessageSize(0),
       m_cStatsBytesReceived(0),
       m_cStatsBytesSent(0),
       m_cStatsSent(0),
-      m_cStatsTimeoutCount(self(), 0),
+      m_cStatsTimeoutCount(0),
       f_hWrapperStreamFactoryList(self()),
       m_wvParentService(self())
     {
@@ -308,6 +329,25 @@ void Peer::onConnectionOpened(PofConnection::Handle hConnection)
     COH_LOG("Opened: " << hConnection, 6);
     }
 
+void Peer::onRequestTimeout()
+    {
+    m_cStatsTimeoutCount.adjust(1);
+    }
+
+void Peer::onRequestDeadline(int64_t ldtDeadline)
+    {
+    int64_t ldtCurrent = m_ldtRequestDeadlineMillis.get();
+    while (ldtDeadline < ldtCurrent)
+        {
+        int64_t ldtActual = m_ldtRequestDeadlineMillis.update(ldtCurrent, ldtDeadline);
+        if (ldtActual == ldtCurrent)
+            {
+            break;
+            }
+        ldtCurrent = ldtActual;
+        }
+    }
+
 PofChannel::Handle Peer::openChannel(PofConnection::Handle hConnection,
         Protocol::View vProtocol, String::View vsName,
         Channel::Receiver::Handle hReceiver, Subject::View vSubject)
@@ -833,6 +873,16 @@ void Peer::onNotify()
         setPingLastMillis(ldtNow);
         }
 
+    // expired requests
+    if (ldtNow >= getRequestNextCheckMillis())
+        {
+        // the deadlines of the Requests which remain pending are reported
+        // again by the check
+        m_ldtRequestDeadlineMillis.set(Integer64::max_value);
+        checkRequestTimeouts(System::currentTimeMillis());
+        setRequestLastCheckMillis(ldtNow);
+        }
+
     setStatsReceived(cMessage);
     setStatsBytesReceived(cbReceive);
     setStatsCpu(getStatsCpu() + (ldtNow - ldtStart));
@@ -872,6 +922,35 @@ void Peer::send(Message::Handle hMessage)
     COH_ENSURE(NULL != hChannel);
     COH_ENSURE(hChannel->isActiveThread());
 
+    // drop a Request which nothing is waiting for anymore, rather than
+    // encoding it and having the peer process it
+    Request::Handle hRequest = cast<Request::Handle>(hMessage, /*fThrow*/ false);
+    if (NULL != hRequest)
+        {
+        AbstractPofRequest::Status::Handle hStatus =
+            cast<AbstractPofRequest::Status::Handle>(hRequest->getStatus(),
+                    /*fThrow*/ false);
+        if (NULL != hStatus)
+            {
+            int64_t ldtDeadline = hStatus->getDeadlineMillis();
+            if (ldtDeadline > 0 && System::currentTimeMillis() >= ldtDeadline)
+                {
+                hStatus->cancel(RequestTimeoutException::create(
+                        "request timed out before it was sent"));
+                return;
+                }
+            if (hStatus->isClosed())
+                {
+                return;
+                }
+            }
+        }
+
+    // the WriteBuffer and the encoding temporaries do not outlive the send,
+    // thus they are bump allocated and reclaimed in bulk (if arena scopes
+    // are enabled)
+    Allocator::ArenaScope scope;
+
     // allocate a WriteBuffer
     WriteBuffer::Handle hWb = allocateWriteBuffer();
 
@@ -888,12 +967,28 @@ void Peer::send(Message::Handle hMessage)
         COH_THROW (ve);
         }
 
+    // determine the priority with which the Message is written
+    int32_t                  nPriority = AbstractPofMessage::priority_normal;
+    AbstractPofMessage::View vMessage  =
+        cast<AbstractPofMessage::View>(hMessage, /*fThrow*/ false);
+    if (NULL != vMessage)
+        {
+        nPriority = vMessage->getPriority();
+        }
+
+    int64_t cbBulk = getBulkMessageSize();
+    if (nPriority == AbstractPofMessage::priority_normal && cbBulk > 0 &&
+            hWb->length() > cbBulk)
+        {
+        nPriority = AbstractPofMessage::priority_bulk;
+        }
+
     // send the Message
     PofConnection::Handle hConnection = cast<PofConnection::Handle>(
             hChannel->getConnection());
     try
         {
-        hConnection->send(hWb);
+        hConnection->send(hWb, nPriority);
         releaseWriteBuffer(hWb, (Exception::View) NULL);
         }
     catch (Exception::View ve)
@@ -1001,6 +1096,10 @@ void Peer::configure(XmlElement::View vXml)
         // <max-outgoing-message-size>
         setMaxOutgoingMessageSize(parseMemorySize(vXmlCat, "max-message-size", 0));
 
+        // larger messages are written behind any waiting smaller ones
+        setBulkMessageSize(StringHelper::parseMemorySize(System::getProperty(
+                "coherence.extend.bulk.message.size", "64k")));
+
         // <incoming-message-handler>
         vXmlCat = vXml->getSafeElement("incoming-message-handler");
 
@@ -1109,7 +1208,7 @@ String::View Peer::formatStats() const
     int64_t cbpsIn  = cTotal == 0L ? 0L : (cbRcvd / cTotal)*1000L;
     int64_t cbpsOut = cTotal == 0L ? 0L : (cbSent / cTotal)*1000L;
 
-    return COH_TO_STRING(super::formatStats()
+    return COH_TO_STACK_STRING(super::formatStats()
            << ", BytesReceived="
            << StringHelper::toMemorySizeString(cbRcvd, false)
            << ", BytesReceived="
@@ -1322,6 +1421,11 @@ int64_t Peer::getMaxOutgoingMessageSize() const
     return m_cbMaxOutgoingMessageSize;
     }
 
+int64_t Peer::getBulkMessageSize() const
+    {
+    return m_cbBulkMessageSize;
+    }
+
 UUID::View Peer::getProcessId()
     {
     static FinalView<UUID> vProcessId(System::common(), UUID::create());
@@ -1359,6 +1463,14 @@ int64_t Peer::getRequestTimeout() const
     return m_cRequestTimeout;
     }
 
+int64_t Peer::getRequestNextCheckMillis() const
+    {
+    int64_t ldtNext = getRequestTimeout() == 0L ? Integer64::max_value
+            : m_ldtRequestLastCheckMillis + REQUEST_CHECK_INTERVAL;
+
+    return std::min(ldtNext, m_ldtRequestDeadlineMillis.get());
+    }
+
 int64_t Peer::getStatsBytesReceived() const
     {
     return m_cStatsBytesReceived;
@@ -1376,17 +1488,18 @@ int64_t Peer::getStatsSent() const
 
 int64_t Peer::getStatsTimeoutCount() const
     {
-    return m_cStatsTimeoutCount;
+    return m_cStatsTimeoutCount.get();
     }
 
 int64_t Peer::getWaitMillis() const
     {
     int64_t cMillis = super::getWaitMillis();
-    if (getPingInterval() > 0L)
+    int64_t ldtNext = std::min(std::min(getPingNextMillis(),
+            getPingNextCheckMillis()), getRequestNextCheckMillis());
+    if (ldtNext != Integer64::max_value)
         {
-        int64_t ldtNow  = System::safeTimeMillis();
-        int64_t ldtNext = std::min(getPingNextMillis(), getPingNextCheckMillis());
-        int64_t cNext   = ldtNext > ldtNow ? ldtNext - ldtNow : -1L;
+        int64_t ldtNow = System::safeTimeMillis();
+        int64_t cNext  = ldtNext > ldtNow ? ldtNext - ldtNow : -1L;
 
         return cMillis == 0L ? cNext : std::min(cNext, cMillis);
         }
@@ -1467,6 +1580,11 @@ void Peer::setRequestTimeout(int64_t cMillis)
     m_cRequestTimeout = cMillis;
     }
 
+void Peer::setRequestLastCheckMillis(int64_t ldt)
+    {
+    m_ldtRequestLastCheckMillis = ldt;
+    }
+
 void Peer::setMaxIncomingMessageSize(int64_t cbMax)
     {
     m_cbMaxIncomingMessageSize = cbMax;
@@ -1477,6 +1595,11 @@ void Peer::setMaxOutgoingMessageSize(int64_t cbMax)
     m_cbMaxOutgoingMessageSize = cbMax;
     }
 
+void Peer::setBulkMessageSize(int64_t cbBulk)
+    {
+    m_cbBulkMessageSize = cbBulk;
+    }
+
 void Peer::setStatsBytesReceived(int64_t cb)
     {
     m_cStatsBytesReceived = cb;
@@ -1494,7 +1617,7 @@ void Peer::setStatsSent(int64_t cStatsSent)
 
 void Peer::setStatsTimeoutCount(int64_t cRequests)
     {
-    m_cStatsTimeoutCount = cRequests;
+    m_cStatsTimeoutCount.set(cRequests);
     }
 
 void Peer::setWrapperStreamFactoryList(List::Handle hList)
@@ -1512,32 +1635,33 @@ void Peer::setProtocolVersionMap(Map::View vMap)
 
 String::View Peer::getDescription() const
     {
-    String::View vs = COH_TO_STRING(super::getDescription() << ", ThreadCount=0");
+    NarrowStringStream ss;
+    ss << super::getDescription() << ", ThreadCount=0";
 
     List::View vList = getWrapperStreamFactoryList();
     if (NULL != vList && !vList->isEmpty())
         {
-        vs = COH_TO_STRING(vs <<", Filters=[");
+        ss << ", Filters=[";
 
         for (Iterator::Handle hIter = vList->iterator(); hIter->hasNext(); )
             {
-            vs = COH_TO_STRING(vs << Class::getClassName(hIter->next()));
+            ss << Class::getClassName(hIter->next());
             if (hIter->hasNext())
                 {
-                vs = COH_TO_STRING(vs << ',');
+                ss << ',';
                 }
             }
 
-        vs = COH_TO_STRING(vs << ']');
+        ss << ']';
         }
 
     Codec::View vCodec = getCodec();
     if (NULL != vCodec)
         {
-        vs = COH_TO_STRING(vs << ", Codec=" << vCodec);
+        ss << ", Codec=" << vCodec;
         }
 
-    return COH_TO_STRING(vs << ", PingInterval="
+    ss << ", PingInterval="
        << getPingInterval()
        << ", PingTimeout="
        << getPingTimeout()
@@ -1546,7 +1670,11 @@ String::View Peer::getDescription() const
        << ", MaxIncomingMessageSize="
        << getMaxIncomingMessageSize()
        << ", MaxOutgoingMessageSize="
-       << getMaxOutgoingMessageSize());
+       << getMaxOutgoingMessageSize()
+       << ", BulkMessageSize="
+       << getBulkMessageSize();
+
+    return ss.toString();
     }
 
 
@@ -7,10 +7,12 @@
 #include "private/coherence/component/util/QueueProcessor.hpp"
 
 #include "coherence/util/DualQueue.hpp"
+#include "coherence/util/SingleConsumerQueue.hpp"
 
 COH_OPEN_NAMESPACE3(coherence,component,util)
 
 using coherence::util::DualQueue;
+using coherence::util::SingleConsumerQueue;
 
 
 // ----- constructor --------------------------------------------------------
@@ -30,6 +32,13 @@ Queue::Handle QueueProcessor::getQueue()
 
 Queue::Handle QueueProcessor::instantiateQueue() const
     {
+    // the queue is only ever drained by the daemon thread, allowing
+    // producers to use the lock-free single consumer queue
+    String::View vsQueue = System::getProperty("coherence.daemon.queue");
+    if (NULL != vsQueue && vsQueue->equals("single-consumer"))
+        {
+        return SingleConsumerQueue::create();
+        }
     return DualQueue::create();
     }
 
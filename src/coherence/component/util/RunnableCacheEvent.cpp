@@ -8,11 +8,29 @@
 
 #include "coherence/net/NamedCache.hpp"
 
+#include "coherence/net/cache/CacheEvent.hpp"
+
+#include "coherence/util/ArrayList.hpp"
+#include "coherence/util/BatchMapListener.hpp"
+#include "coherence/util/ConflatingListener.hpp"
+#include "coherence/util/ConverterCollections.hpp"
+#include "coherence/util/HashMap.hpp"
+#include "coherence/util/Iterator.hpp"
+#include "coherence/util/ObservableMap.hpp"
+
 #include "private/coherence/util/logging/Logger.hpp"
 
 COH_OPEN_NAMESPACE3(coherence,component,util)
 
 using coherence::net::NamedCache;
+using coherence::net::cache::CacheEvent;
+using coherence::util::ArrayList;
+using coherence::util::BatchMapListener;
+using coherence::util::ConflatingListener;
+using coherence::util::ConverterCollections;
+using coherence::util::HashMap;
+using coherence::util::Iterator;
+using coherence::util::ObservableMap;
 using coherence::util::logging::Logger;
 
 
@@ -22,8 +40,12 @@ RunnableCacheEvent::RunnableCacheEvent(MapEvent::Handle hMapEvent,
         Listeners::View vListeners)
         : f_vListeners(self(), vListeners),
           f_hListenerSupport(self()),
-          f_hMapEvent(self(), hMapEvent),
-          f_hMapListener(self())
+          m_hMapEvent(self(), hMapEvent),
+          f_hMapListener(self()),
+          m_hMapPending(self()),
+          m_fCancelled(false),
+          m_fConflating(false),
+          m_fBatching(false)
     {
     COH_ENSURE_PARAM(hMapEvent);
     COH_ENSURE_PARAM(vListeners);
@@ -33,11 +55,33 @@ RunnableCacheEvent::RunnableCacheEvent(MapEvent::Handle hMapEvent,
         MapListener::Handle hListener)
         : f_vListeners(self()),
           f_hListenerSupport(self()),
-          f_hMapEvent(self(), hMapEvent),
-          f_hMapListener(self(), hListener)
+          m_hMapEvent(self(), hMapEvent),
+          f_hMapListener(self(), hListener),
+          m_hMapPending(self()),
+          m_fCancelled(false),
+          m_fConflating(false),
+          m_fBatching(false)
     {
     COH_ENSURE_PARAM(hMapEvent);
     COH_ENSURE_PARAM(hListener);
+
+    // the listener seen here is usually the ConverterMapListener created
+    // on behalf of the application's listener; look through it for the tags
+    MapListener::View vListener = hListener;
+    while (true)
+        {
+        m_fConflating |= instanceof<ConflatingListener::View>(vListener);
+        m_fBatching   |= instanceof<BatchMapListener::View>(vListener);
+
+        ConverterCollections::ConverterMapListener::View vConv =
+                cast<ConverterCollections::ConverterMapListener::View>
+                        (vListener, false);
+        if (NULL == vConv || m_fBatching)
+            {
+            break;
+            }
+        vListener = vConv->getMapListener();
+        }
     }
 
 
@@ -45,8 +89,12 @@ RunnableCacheEvent::RunnableCacheEvent(MapEvent::Handle hMapEvent,
         MapListenerSupport::Handle hListenerSupport)
         : f_vListeners(self()),
           f_hListenerSupport(self(), hListenerSupport),
-          f_hMapEvent(self(), hMapEvent),
-          f_hMapListener(self())
+          m_hMapEvent(self(), hMapEvent),
+          f_hMapListener(self()),
+          m_hMapPending(self()),
+          m_fCancelled(false),
+          m_fConflating(false),
+          m_fBatching(false)
     {
     COH_ENSURE_PARAM(hMapEvent);
     COH_ENSURE_PARAM(hListenerSupport);
@@ -57,7 +105,11 @@ RunnableCacheEvent::RunnableCacheEvent(MapEvent::Handle hMapEvent,
 
 void RunnableCacheEvent::run()
     {
-    MapEvent::Handle hEvent = getMapEvent();
+    MapEvent::Handle hEvent = claimEvent();
+    if (NULL == hEvent)
+        {
+        return;
+        }
 
     if (cast<NamedCache::View>(hEvent->getSource())->isActive())
         {
@@ -127,6 +179,246 @@ void RunnableCacheEvent::dispatchSafe(MapEvent::Handle hEvent,
     }
 
 
+bool RunnableCacheEvent::conflate(RunnableCacheEvent::Handle hTask,
+        Map::Handle hMapPending)
+    {
+    if (!hTask->isConflating())
+        {
+        return false;
+        }
+
+    MapListener::Handle hListener = hTask->getMapListener();
+    MapEvent::Handle    hEvent    = hTask->getMapEvent();
+    Object::View        vKey      = hEvent->getKey();
+
+    COH_SYNCHRONIZED (hMapPending)
+        {
+        Map::Handle hMapKey = cast<Map::Handle>(hMapPending->get(hListener));
+        if (NULL == hMapKey)
+            {
+            hMapKey = HashMap::create();
+            hMapPending->put(hListener, hMapKey);
+            }
+
+        RunnableCacheEvent::Handle hPending = cast<RunnableCacheEvent::Handle>(
+                hMapKey->get(vKey));
+        if (NULL != hPending)
+            {
+            bool             fDrop   = false;
+            MapEvent::Handle hMerged = merge(hPending->getMapEvent(), hEvent,
+                    fDrop);
+            if (fDrop)
+                {
+                // e.g. insert followed by delete; nothing to deliver
+                hPending->m_fCancelled = true;
+                hMapKey->remove(vKey);
+                if (hMapKey->isEmpty())
+                    {
+                    hMapPending->remove(hListener);
+                    }
+                return true;
+                }
+            if (NULL != hMerged)
+                {
+                hPending->m_hMapEvent = hMerged;
+                return true;
+                }
+            }
+
+        // nothing to merge with (or the events are incompatible); the new
+        // task becomes the one subsequent events are merged into
+        hMapKey->put(vKey, hTask);
+        hTask->m_hMapPending = hMapPending;
+        }
+    return false;
+    }
+
+void RunnableCacheEvent::dispatchBatch(List::View vListTask)
+    {
+    if (vListTask->isEmpty())
+        {
+        return;
+        }
+
+    // all tasks in the batch are for the same listener, usually the
+    // ConverterMapListener(s) wrapping the BatchMapListener
+    MapListener::Handle hListener = cast<RunnableCacheEvent::Handle>(
+            vListTask->get(0))->getMapListener();
+    MapListener::Handle hTarget   = hListener;
+    while (!instanceof<BatchMapListener::Handle>(hTarget))
+        {
+        hTarget = cast<ConverterCollections::ConverterMapListener::Handle>(
+                hTarget)->getMapListener();
+        }
+
+    List::Handle hListEvent = ArrayList::create(vListTask->size());
+    for (Iterator::Handle hIter = vListTask->iterator(); hIter->hasNext(); )
+        {
+        MapEvent::Handle hEvent = cast<RunnableCacheEvent::Handle>(
+                hIter->next())->claimEvent();
+        if (NULL == hEvent ||
+                !cast<NamedCache::View>(hEvent->getSource())->isActive())
+            {
+            continue;
+            }
+
+        if (instanceof<CacheEvent::View>(hEvent) &&
+                cast<CacheEvent::View>(hEvent)->isPriming())
+            {
+            // priming events are subject to the listener's own dispatch
+            // rules; deliver them individually, preserving the order
+            if (!hListEvent->isEmpty())
+                {
+                cast<BatchMapListener::Handle>(hTarget)->onMapEvents(
+                        hListEvent->toArray());
+                hListEvent->clear();
+                }
+            hEvent->dispatch(hListener);
+            continue;
+            }
+
+        // apply the conversions the ConverterMapListeners would have made
+        MapEvent::View vEvent = hEvent;
+        for (MapListener::Handle h = hListener; h != hTarget; )
+            {
+            ConverterCollections::ConverterMapListener::Handle hConv =
+                    cast<ConverterCollections::ConverterMapListener::Handle>(h);
+            if (instanceof<CacheEvent::View>(vEvent))
+                {
+                vEvent = ConverterCollections::ConverterCacheEvent::create(
+                        hConv->getObservableMap(), cast<CacheEvent::View>(vEvent),
+                        hConv->getConverterKeyUp(), hConv->getConverterValueUp());
+                }
+            else
+                {
+                vEvent = ConverterCollections::ConverterMapEvent::create(
+                        hConv->getObservableMap(), vEvent,
+                        hConv->getConverterKeyUp(), hConv->getConverterValueUp());
+                }
+            h = hConv->getMapListener();
+            }
+        hListEvent->add(vEvent);
+        }
+
+    if (!hListEvent->isEmpty())
+        {
+        cast<BatchMapListener::Handle>(hTarget)->onMapEvents(
+                hListEvent->toArray());
+        }
+    }
+
+MapEvent::Handle RunnableCacheEvent::merge(MapEvent::View vEvtPending,
+        MapEvent::View vEvtNew, bool& fDrop)
+    {
+    if (vEvtPending->getSource() != vEvtNew->getSource())
+        {
+        return NULL;
+        }
+
+    // only events of the same kind carrying the same attributes are merged
+    CacheEvent::View vCachePending = cast<CacheEvent::View>(vEvtPending, false);
+    CacheEvent::View vCacheNew     = cast<CacheEvent::View>(vEvtNew, false);
+    if ((NULL == vCachePending) != (NULL == vCacheNew))
+        {
+        return NULL;
+        }
+    if (NULL != vCachePending &&
+            (vCachePending->isPriming() || vCacheNew->isPriming() ||
+             vCachePending->isSynthetic()       != vCacheNew->isSynthetic() ||
+             vCachePending->isExpired()         != vCacheNew->isExpired() ||
+             vCachePending->getTransformState() != vCacheNew->getTransformState()))
+        {
+        return NULL;
+        }
+
+    MapListenerSupport::FilterEvent::View vFilterPending =
+            cast<MapListenerSupport::FilterEvent::View>(vEvtPending, false);
+    MapListenerSupport::FilterEvent::View vFilterNew =
+            cast<MapListenerSupport::FilterEvent::View>(vEvtNew, false);
+    if ((NULL == vFilterPending) != (NULL == vFilterNew) ||
+            (NULL != vFilterPending &&
+             !Object::equals(vFilterPending->getFilter(), vFilterNew->getFilter())))
+        {
+        return NULL;
+        }
+
+    int32_t nId;
+    switch (vEvtPending->getId())
+        {
+        case MapEvent::entry_inserted:
+            switch (vEvtNew->getId())
+                {
+                case MapEvent::entry_updated:
+                    nId = MapEvent::entry_inserted;
+                    break;
+
+                case MapEvent::entry_deleted:
+                    fDrop = true;
+                    return NULL;
+
+                default:
+                    return NULL;
+                }
+            break;
+
+        case MapEvent::entry_updated:
+            switch (vEvtNew->getId())
+                {
+                case MapEvent::entry_updated:
+                    nId = MapEvent::entry_updated;
+                    break;
+
+                case MapEvent::entry_deleted:
+                    nId = MapEvent::entry_deleted;
+                    break;
+
+                default:
+                    return NULL;
+                }
+            break;
+
+        case MapEvent::entry_deleted:
+            if (vEvtNew->getId() != MapEvent::entry_inserted)
+                {
+                return NULL;
+                }
+            nId = MapEvent::entry_updated;
+            break;
+
+        default:
+            return NULL;
+        }
+
+    ObservableMap::Handle hMap = vEvtPending->getMap();
+    Object::View          vKey = vEvtPending->getKey();
+    Object::View          vValueOld;
+    Object::View          vValueNew;
+    if (nId != MapEvent::entry_inserted)
+        {
+        vValueOld = vEvtPending->getOldValue();
+        }
+    if (nId != MapEvent::entry_deleted)
+        {
+        vValueNew = vEvtNew->getNewValue();
+        }
+
+    if (NULL != vFilterNew)
+        {
+        return MapListenerSupport::FilterEvent::create(hMap, nId, vKey,
+                vValueOld, vValueNew, vCacheNew->isSynthetic(),
+                vCacheNew->getTransformState(), false,
+                vCacheNew->isExpired(), vFilterNew->getFilter());
+        }
+    if (NULL != vCacheNew)
+        {
+        return CacheEvent::create(hMap, nId, vKey, vValueOld, vValueNew,
+                vCacheNew->isSynthetic(), vCacheNew->getTransformState(),
+                false, vCacheNew->isExpired());
+        }
+    return MapEvent::create(hMap, nId, vKey, vValueOld, vValueNew);
+    }
+
+
 // ----- accessors ----------------------------------------------------------
 
 Listeners::View RunnableCacheEvent::getListeners() const
@@ -146,12 +438,12 @@ MapListenerSupport::View RunnableCacheEvent::getListenerSupport() const
 
 MapEvent::Handle RunnableCacheEvent::getMapEvent()
     {
-    return f_hMapEvent;
+    return m_hMapEvent;
     }
 
 MapEvent::View RunnableCacheEvent::getMapEvent() const
     {
-    return f_hMapEvent;
+    return m_hMapEvent;
     }
 
 MapListener::Handle RunnableCacheEvent::getMapListener()
@@ -164,5 +456,43 @@ MapListener::View RunnableCacheEvent::getMapListener() const
     return f_hMapListener;
     }
 
+bool RunnableCacheEvent::isConflating() const
+    {
+    return m_fConflating;
+    }
+
+bool RunnableCacheEvent::isBatching() const
+    {
+    return m_fBatching;
+    }
+
+MapEvent::Handle RunnableCacheEvent::claimEvent()
+    {
+    Map::Handle hMapPending = m_hMapPending;
+    if (NULL != hMapPending)
+        {
+        // stop accepting conflated events; from here on the event is final
+        COH_SYNCHRONIZED (hMapPending)
+            {
+            Map::Handle hMapKey = cast<Map::Handle>(
+                    hMapPending->get(getMapListener()));
+            if (NULL != hMapKey)
+                {
+                Object::View vKey = getMapEvent()->getKey();
+                if (hMapKey->get(vKey) == this)
+                    {
+                    hMapKey->remove(vKey);
+                    if (hMapKey->isEmpty())
+                        {
+                        hMapPending->remove(getMapListener());
+                        }
+                    }
+                }
+            m_hMapPending = NULL;
+            }
+        }
+    return m_fCancelled ? NULL : getMapEvent();
+    }
+
 COH_CLOSE_NAMESPACE3
 
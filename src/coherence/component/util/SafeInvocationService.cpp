@@ -25,6 +25,13 @@ Map::View SafeInvocationService::query(Invocable::Handle hTask,
             hTask, vSetMembers);
     }
 
+void SafeInvocationService::execute(Invocable::Handle hTask,
+        Set::View vSetMembers, InvocationObserver::Handle hObserver)
+    {
+    ensureRunningInvocationServiceInternal()->execute(
+            hTask, vSetMembers, hObserver);
+    }
+
 
 // ----- SafeInvocationService interface ------------------------------------
 
@@ -8,10 +8,17 @@
 
 #include "coherence/io/ConfigurableSerializerFactory.hpp"
 #include "coherence/io/pof/SystemPofContext.hpp"
+#include "coherence/util/ArrayList.hpp"
+#include "coherence/util/ConverterCollections.hpp"
+#include "coherence/util/IdentityHashMap.hpp"
+#include "coherence/util/MapEvent.hpp"
 #include "coherence/util/ServiceEvent.hpp"
 
+#include "private/coherence/component/util/RunnableCacheEvent.hpp"
+
 #include "private/coherence/run/xml/XmlHelper.hpp"
 #include "private/coherence/util/logging/Logger.hpp"
+#include "private/coherence/util/NarrowStringStream.hpp"
 #include "private/coherence/util/StringHelper.hpp"
 
 COH_OPEN_NAMESPACE3(coherence,component,util)
@@ -21,11 +28,17 @@ using coherence::io::ConfigurableSerializerFactory;
 using coherence::io::pof::SystemPofContext;
 using coherence::run::xml::XmlElement;
 using coherence::run::xml::XmlHelper;
+using coherence::util::ArrayList;
+using coherence::util::ConverterCollections;
 using coherence::util::Event;
 using coherence::util::EventListener;
+using coherence::util::IdentityHashMap;
 using coherence::util::Listeners;
+using coherence::util::MapEvent;
+using coherence::util::MapListener;
 using coherence::util::ServiceEvent;
 using coherence::util::StringHelper;
+using coherence::util::logging::Logger;
 
 
 // ----- constructor --------------------------------------------------------
@@ -104,7 +117,9 @@ String::View Service::DispatchEvent::getDescription() const
 
 Service::EventDispatcher::EventDispatcher(Service::View vService)
     : m_cCloggedCount(1024), m_cCloggedDelay(32),
-      m_fDispatching(self(), false), m_wvService(self(), vService)
+      m_fDispatching(self(), false), m_cWorkers(1), f_haWorker(self()),
+      m_cMaxBatch(256), f_hMapBatch(self(), IdentityHashMap::create()),
+      m_wvService(self(), vService)
     {
     }
 
@@ -150,7 +165,7 @@ void Service::EventDispatcher::drainOverflow()
         int32_t cPauseMillis = getCloggedDelay();
         while (isStarted())
             {
-            size32_t cEvents = getQueue()->size();
+            size32_t cEvents = getQueue()->size() + getWorkerBacklog();
             if (cEvents < cMaxEvents || cMaxEvents <= 0 || !sleep(cPauseMillis))
                 {
                 break;
@@ -167,13 +182,185 @@ void Service::EventDispatcher::drainQueue()
         coherence::util::Queue::View hQueue = getQueue();
 
         // wait for all outstanding tasks to complete
-        while (hQueue->size() > 0 || isDispatching())
+        while (hQueue->size() > 0 || isDispatching() || getWorkerBacklog() > 0)
             {
             Thread::currentThread()->sleep(1);
             }
         }
     }
 
+size32_t Service::EventDispatcher::getWorkerCount() const
+    {
+    return m_cWorkers;
+    }
+
+void Service::EventDispatcher::setWorkerCount(size32_t cWorkers)
+    {
+    m_cWorkers = cWorkers == 0 ? 1 : cWorkers;
+    }
+
+size32_t Service::EventDispatcher::getWorkerQueueDepth(size32_t iWorker) const
+    {
+    ObjectArray::View vaWorker = f_haWorker;
+    return vaWorker == NULL || iWorker >= vaWorker->length
+            ? 0 : cast<EventWorker::Handle>(vaWorker[iWorker])->getQueue()->size();
+    }
+
+float64_t Service::EventDispatcher::getWorkerLatencyMillis(size32_t iWorker) const
+    {
+    ObjectArray::View vaWorker = f_haWorker;
+    return vaWorker == NULL || iWorker >= vaWorker->length
+            ? 0.0 : cast<EventWorker::View>(vaWorker[iWorker])->getLatencyMillis();
+    }
+
+bool Service::EventDispatcher::isWorkerThread(Thread::View vThread) const
+    {
+    ObjectArray::View vaWorker = f_haWorker;
+    if (vaWorker != NULL)
+        {
+        for (size32_t i = 0, c = vaWorker->length; i < c; ++i)
+            {
+            if (vThread == cast<EventWorker::View>(vaWorker[i])->getThread())
+                {
+                return true;
+                }
+            }
+        }
+    return false;
+    }
+
+size32_t Service::EventDispatcher::getMaxBatchSize() const
+    {
+    return m_cMaxBatch;
+    }
+
+void Service::EventDispatcher::setMaxBatchSize(size32_t cMaxBatch)
+    {
+    m_cMaxBatch = cMaxBatch == 0 ? 1 : cMaxBatch;
+    }
+
+size32_t Service::EventDispatcher::getWorkerIndex(Runnable::View vTask) const
+    {
+    ObjectArray::View vaWorker = f_haWorker;
+    if (vaWorker != NULL)
+        {
+        RunnableCacheEvent::View vCacheEvent = cast<RunnableCacheEvent::View>(vTask, false);
+        MapListener::View        vListener   = vCacheEvent == NULL
+                ? (MapListener::View) NULL : vCacheEvent->getMapListener();
+        if (NULL != vListener)
+            {
+            // look through the converters which wrap the application's
+            // listener for each cache, so that all events for a listener
+            // are delivered by the same worker, preserving their order
+            while (instanceof<ConverterCollections::ConverterMapListener::View>(vListener))
+                {
+                vListener = cast<ConverterCollections::ConverterMapListener::View>
+                        (vListener)->getMapListener();
+                }
+            return System::identityHashCode(vListener) % vaWorker->length;
+            }
+        }
+    return ObjectArray::npos;
+    }
+
+size32_t Service::EventDispatcher::getWorkerBacklog() const
+    {
+    ObjectArray::View vaWorker = f_haWorker;
+    size32_t          cTasks   = 0;
+    if (vaWorker != NULL)
+        {
+        for (size32_t i = 0, c = vaWorker->length; i < c; ++i)
+            {
+            EventWorker::Handle hWorker = cast<EventWorker::Handle>(vaWorker[i]);
+            cTasks += hWorker->getQueue()->size();
+            if (hWorker->isBusy())
+                {
+                ++cTasks;
+                }
+            }
+        }
+    return cTasks;
+    }
+
+void Service::EventDispatcher::drainWorkers()
+    {
+    ObjectArray::View vaWorker = f_haWorker;
+    if (vaWorker != NULL)
+        {
+        COH_SYNCHRONIZED (vaWorker)
+            {
+            while (getWorkerBacklog() > 0 && isStarted())
+                {
+                // see onWorkerIdle; the timeout only guards against the
+                // workers having been stopped underneath us
+                vaWorker->wait(1000);
+                }
+            }
+        }
+    }
+
+void Service::EventDispatcher::onWorkerIdle() const
+    {
+    ObjectArray::View vaWorker = f_haWorker;
+    if (vaWorker != NULL)
+        {
+        COH_SYNCHRONIZED (vaWorker)
+            {
+            vaWorker->notifyAll();
+            }
+        }
+    }
+
+void Service::EventDispatcher::addToBatch(Runnable::Handle hTask)
+    {
+    RunnableCacheEvent::Handle hCacheEvent = cast<RunnableCacheEvent::Handle>(hTask);
+    MapListener::Handle        hListener   = hCacheEvent->getMapListener();
+    Map::Handle                hMapBatch   = f_hMapBatch;
+    List::Handle               hList       = cast<List::Handle>(hMapBatch->get(hListener));
+
+    if (NULL == hList)
+        {
+        hList = ArrayList::create();
+        hMapBatch->put(hListener, hList);
+        }
+    hList->add(hCacheEvent);
+
+    if (hList->size() >= getMaxBatchSize())
+        {
+        hMapBatch->remove(hListener);
+        RunnableCacheEvent::dispatchBatch(hList);
+        }
+    }
+
+void Service::EventDispatcher::flushBatches()
+    {
+    Map::Handle hMapBatch = f_hMapBatch;
+    while (!hMapBatch->isEmpty())
+        {
+        // remove each batch before delivering it, so that an exception
+        // thrown by one listener does not cause its events to be redelivered
+        Map::Entry::View vEntry = cast<Map::Entry::View>(
+                hMapBatch->entrySet()->iterator()->next());
+        List::View vList = cast<List::View>(vEntry->getValue());
+        hMapBatch->remove(vEntry->getKey());
+        try
+            {
+            RunnableCacheEvent::dispatchBatch(vList);
+            }
+        catch (Exception::View e)
+            {
+            // carry on with the remaining batches; left in the map they
+            // would wait for the next pass over the queue
+            if (m_wvService->isRunning())
+                {
+                COH_LOG("An exception occurred while dispatching a batch of "
+                    << vList->size() << " events to " << vEntry->getKey(), 1);
+                onException(e);
+                }
+            }
+        }
+    }
+
 Queue::Handle Service::EventDispatcher::instantiateQueue() const
     {
     return EventQueue::create(m_wvService);
@@ -183,10 +370,29 @@ Queue::Handle Service::EventDispatcher::instantiateQueue() const
 
 String::View Service::EventDispatcher::getThreadName() const
     {
-    return COH_TO_STRING(m_wvService->getThreadName() << ":"
+    return COH_TO_STACK_STRING(m_wvService->getThreadName() << ":"
             << QueueProcessor::getThreadName());
     }
 
+void Service::EventDispatcher::onEnter()
+    {
+    super::onEnter();
+
+    size32_t cWorkers = getWorkerCount();
+    if (cWorkers > 1 && f_haWorker == NULL)
+        {
+        ObjectArray::Handle haWorker = ObjectArray::create(cWorkers);
+        for (size32_t i = 0; i < cWorkers; ++i)
+            {
+            EventWorker::Handle hWorker = EventWorker::create(this, i);
+            hWorker->setThreadGroup(getThreadGroup());
+            hWorker->start();
+            haWorker[i] = hWorker;
+            }
+        initialize(f_haWorker, haWorker);
+        }
+    }
+
 int64_t Service::getWaitMillis() const
     {
     /*
@@ -213,6 +419,21 @@ void Service::EventDispatcher::onExit()
     {
     // drain the queue
     onNotify();
+
+    // stop the workers, allowing each to drain its own queue
+    ObjectArray::Handle haWorker = f_haWorker;
+    if (haWorker != NULL)
+        {
+        for (size32_t i = 0, c = haWorker->length; i < c; ++i)
+            {
+            EventWorker::Handle hWorker = cast<EventWorker::Handle>(haWorker[i]);
+            hWorker->stop();
+            if (!hWorker->join(1000L))
+                {
+                COH_LOG("failed to stop " << hWorker << "; abandoning", 2);
+                }
+            }
+        }
     QueueProcessor::onExit();
     }
 
@@ -249,8 +470,30 @@ void Service::EventDispatcher::onNotify()
                 break;
                 }
 
-            hTask->run();
+            if (instanceof<RunnableCacheEvent::Handle>(hTask) &&
+                    cast<RunnableCacheEvent::Handle>(hTask)->isBatching())
+                {
+                // delivered once this pass over the queue is complete
+                addToBatch(hTask);
+                continue;
+                }
+
+            size32_t iWorker = getWorkerIndex(hTask);
+            if (iWorker == ObjectArray::npos)
+                {
+                // unkeyed tasks are ordered with respect to all events
+                flushBatches();
+                drainWorkers();
+                hTask->run();
+                }
+            else
+                {
+                ObjectArray::Handle haWorker = f_haWorker;
+                cast<EventWorker::Handle>(haWorker[iWorker])->getQueue()->add(hTask);
+                }
             }
+        hTask = NULL;
+        flushBatches();
         }
     catch (Exception::View e)
         {
@@ -260,6 +503,9 @@ void Service::EventDispatcher::onNotify()
                 << hTask, 1);
             onException(e);
             }
+
+        // deliver the events batched ahead of the failed task
+        flushBatches();
         }
     }
 
@@ -271,6 +517,8 @@ void Service::EventDispatcher::onInit()
         {
         String::View vsMaxEvents = System::getProperty("coherence.events.limit");
         String::View vsDelay     = System::getProperty("coherence.events.delay");
+        String::View vsWorkers   = System::getProperty("coherence.events.threads");
+        String::View vsBatch     = System::getProperty("coherence.events.batch.size");
 
         if (NULL != vsMaxEvents)
             {
@@ -280,6 +528,23 @@ void Service::EventDispatcher::onInit()
             {
             setCloggedDelay(Integer32::parse(vsDelay));
             }
+        if (NULL != vsWorkers)
+            {
+            int32_t cWorkers = Integer32::parse(vsWorkers);
+            if (cWorkers > 0)
+                {
+                setWorkerCount((size32_t) cWorkers);
+                }
+            else
+                {
+                COH_LOG("Ignoring invalid coherence.events.threads value \""
+                        << vsWorkers << "\"", Logger::level_warning);
+                }
+            }
+        if (NULL != vsBatch)
+            {
+            setMaxBatchSize(Integer32::parse(vsBatch));
+            }
         }
     catch (Exception::View) {}
 
@@ -287,11 +552,97 @@ void Service::EventDispatcher::onInit()
     }
 
 
+// ----- nested class EventWorker -------------------------------------------
+// ----- constructor ----------------------------------------------------
+
+Service::EventDispatcher::EventWorker::EventWorker(
+        EventDispatcher::View vDispatcher, size32_t iWorker)
+    : m_fDispatching(self(), false), m_cTasks(self(), 0),
+      m_cMillisTotal(self(), 0), m_iWorker(iWorker),
+      m_wvDispatcher(self(), vDispatcher)
+    {
+    }
+
+// ----- EventWorker interface ------------------------------------------
+
+bool Service::EventDispatcher::EventWorker::isBusy()
+    {
+    return m_fDispatching || getQueue()->size() > 0;
+    }
+
+float64_t Service::EventDispatcher::EventWorker::getLatencyMillis() const
+    {
+    int64_t cTasks = m_cTasks;
+    return cTasks == 0 ? 0.0 : ((float64_t) m_cMillisTotal) / cTasks;
+    }
+
+// ----- Daemon interface -----------------------------------------------
+
+String::View Service::EventDispatcher::EventWorker::getThreadName() const
+    {
+    EventDispatcher::View vDispatcher = m_wvDispatcher;
+    return COH_TO_STACK_STRING((vDispatcher == NULL ? String::null_string
+            : vDispatcher->getThreadName()) << ":EventWorker:" << m_iWorker);
+    }
+
+void Service::EventDispatcher::EventWorker::onExit()
+    {
+    // drain the queue
+    onNotify();
+    QueueProcessor::onExit();
+    }
+
+void Service::EventDispatcher::EventWorker::onNotify()
+    {
+    QueueProcessor::onNotify();
+
+    coherence::util::Queue::Handle hQueue = getQueue();
+    Runnable::Handle               hTask;
+
+    m_fDispatching = true;
+    while (true)
+        {
+        hTask = cast<Runnable::Handle>(hQueue->removeNoWait());
+        if (NULL == hTask)
+            {
+            break;
+            }
+
+        int64_t ldtStart = System::safeTimeMillis();
+        try
+            {
+            hTask->run();
+            }
+        catch (Exception::View e)
+            {
+            if (!isExiting())
+                {
+                COH_LOG("An exception occurred while dispatching the following event:\n"
+                    << hTask, 1);
+                COH_LOGEX(e, 1);
+                COH_LOG("(The event worker has logged the exception and is continuing.)", 1);
+                }
+            }
+        m_cMillisTotal = m_cMillisTotal + (System::safeTimeMillis() - ldtStart);
+        m_cTasks       = m_cTasks + 1;
+        }
+    m_fDispatching = false;
+
+    // wake the EventDispatcher should it be waiting in drainWorkers
+    EventDispatcher::View vDispatcher = m_wvDispatcher;
+    if (vDispatcher != NULL)
+        {
+        vDispatcher->onWorkerIdle();
+        }
+    }
+
+
 // ----- nested class EventQueue  -------------------------------------------
 // ----- constructor ----------------------------------------------------
 
 Service::EventDispatcher::EventQueue::EventQueue(Service::View vService)
-    : m_wvService(self(), vService)
+    : m_wvService(self(), vService),
+      f_hMapConflate(self(), IdentityHashMap::create())
     {
     }
 
@@ -305,7 +656,18 @@ bool Service::EventDispatcher::EventQueue::add(Object::Holder oh)
         case service_started:
         case service_stopping:
         case service_stopped:
-            return coherence::util::DualQueue::add(cast<Runnable::Handle>(oh));
+            {
+            Runnable::Handle hTask = cast<Runnable::Handle>(oh);
+            if (instanceof<RunnableCacheEvent::Handle>(hTask) &&
+                    RunnableCacheEvent::conflate(
+                            cast<RunnableCacheEvent::Handle>(hTask),
+                            f_hMapConflate))
+                {
+                // merged into an event which is still waiting
+                return true;
+                }
+            return coherence::util::DualQueue::add(hTask);
+            }
 
         default:
             COH_THROW (IllegalStateException::create());
@@ -471,7 +833,8 @@ bool Service::isServiceThread() const
     EventDispatcher::View hDispatcher = getEventDispatcher();
 
     if (hThread == getThread() ||
-        (NULL != hDispatcher && hThread == hDispatcher->getThread()))
+        (NULL != hDispatcher && (hThread == hDispatcher->getThread() ||
+                                 hDispatcher->isWorkerThread(hThread))))
         {
         return true;
         }
@@ -22,6 +22,7 @@
 #include "coherence/util/List.hpp"
 #include "coherence/util/Random.hpp"
 
+#include "private/coherence/component/net/extend/AbstractPofMessage.hpp"
 #include "private/coherence/component/net/extend/protocol/TcpInitiatorProtocol.hpp"
 
 #include "private/coherence/component/net/extend/util/TcpUtil.hpp"
@@ -31,6 +32,7 @@
 
 #include "private/coherence/net/InetAddressHelper.hpp"
 
+#include "private/coherence/util/NarrowStringStream.hpp"
 #include "private/coherence/util/StringHelper.hpp"
 
 #include "private/coherence/util/logging/Logger.hpp"
@@ -38,6 +40,7 @@
 
 COH_OPEN_NAMESPACE3(coherence,component,util)
 
+using coherence::component::net::extend::AbstractPofMessage;
 using coherence::component::net::extend::protocol::TcpInitiatorProtocol;
 using coherence::component::net::extend::util::TcpUtil;
 using coherence::io::BufferedInputStream;
@@ -59,6 +62,212 @@ using coherence::util::StringHelper;
 using coherence::util::logging::Logger;
 
 
+// ----- local class: ConnectRace -------------------------------------------
+
+COH_OPEN_NAMESPACE_ANON(TcpInitiator)
+
+/**
+* Connects a set of Sockets to their candidate addresses concurrently, and
+* keeps the first to connect.
+*/
+class ConnectRace
+    : public class_spec<ConnectRace>
+    {
+    friend class factory<ConnectRace>;
+
+    // ----- nested class: Attempt ------------------------------------------
+
+    public:
+        /**
+        * Runnable which connects one of the race's Sockets.
+        */
+        class Attempt
+            : public class_spec<Attempt,
+                extends<Object>,
+                implements<Runnable> >
+            {
+            friend class factory<Attempt>;
+
+            protected:
+                Attempt(ConnectRace::Handle hRace, size32_t i)
+                    : f_hRace(self(), hRace), m_i(i)
+                    {
+                    }
+
+            public:
+                virtual void run()
+                    {
+                    f_hRace->attempt(m_i);
+                    }
+
+            protected:
+                FinalHandle<ConnectRace> f_hRace;
+                size32_t m_i;
+            };
+
+    // ----- constructors ---------------------------------------------------
+
+    protected:
+        /**
+        * Create a new ConnectRace.
+        *
+        * @param vaAddr     the InetSocketAddress to connect each Socket to
+        * @param vaSubport  the Integer32 subport to write to each Socket, or
+        *                   -1 for none
+        * @param haSocket   the unconnected Sockets
+        * @param cMillis    the connect timeout
+        */
+        ConnectRace(ObjectArray::View vaAddr, ObjectArray::View vaSubport,
+                ObjectArray::Handle haSocket, int32_t cMillis)
+            : f_vaAddr(self(), vaAddr), f_vaSubport(self(), vaSubport),
+              f_haSocket(self(), haSocket),
+              f_haCause(self(), ObjectArray::create(haSocket->length)),
+              m_cMillis(cMillis), m_iWinner(TcpInitiator::npos), m_cDone(0)
+            {
+            }
+
+    // ----- ConnectRace interface ------------------------------------------
+
+    public:
+        /**
+        * Start an attempt for every Socket, and wait for the first to
+        * connect or for all of them to fail. The Sockets still connecting
+        * when a winner is found are interrupted and closed.
+        *
+        * @param haCause  filled with the Exception of each attempt which
+        *                 failed before the race was decided
+        *
+        * @return the index of the connected Socket, or npos if none
+        *         connected
+        */
+        size32_t race(ObjectArray::Handle haCause)
+            {
+            size32_t            c        = f_haSocket->length;
+            ObjectArray::Handle haThread = ObjectArray::create(c);
+            for (size32_t i = 0; i < c; ++i)
+                {
+                Thread::Handle hThread = Thread::create(
+                        Attempt::create(this, i), "TcpInitiator:Connect");
+                haThread[i] = hThread;
+                hThread->start();
+                }
+
+            size32_t iWinner;
+            COH_SYNCHRONIZED (this)
+                {
+                while (m_iWinner == TcpInitiator::npos && m_cDone < c)
+                    {
+                    wait();
+                    }
+                iWinner = m_iWinner;
+
+                ObjectArray::View vaCause = f_haCause;
+                for (size32_t i = 0; i < c; ++i)
+                    {
+                    haCause[i] = vaCause[i];
+                    }
+                }
+
+            for (size32_t i = 0; i < c; ++i)
+                {
+                if (i != iWinner)
+                    {
+                    cast<Thread::Handle>(haThread[i])->interrupt();
+                    }
+                }
+            return iWinner;
+            }
+
+        /**
+        * Connect the Socket at the given index, and record the outcome.
+        *
+        * @param i  the index of the Socket
+        */
+        void attempt(size32_t i)
+            {
+            ObjectArray::Handle haSocket  = f_haSocket;
+            ObjectArray::View   vaAddr    = f_vaAddr;
+            ObjectArray::View   vaSubport = f_vaSubport;
+            Socket::Handle      hSocket   = cast<Socket::Handle>(haSocket[i]);
+            Exception::View     vCause    = NULL;
+            int32_t             nSubport  = cast<Integer32::View>(vaSubport[i])
+                    ->getInt32Value();
+            try
+                {
+                hSocket->connect(cast<InetSocketAddress::View>(vaAddr[i]),
+                        m_cMillis);
+                if (nSubport != -1)
+                    {
+                    TcpUtil::writeSubport(hSocket->getOutputStream(), nSubport);
+                    }
+                }
+            catch (Exception::View e)
+                {
+                vCause = e;
+                }
+
+            bool fKeep = false;
+            COH_SYNCHRONIZED (this)
+                {
+                if (NULL == vCause && m_iWinner == TcpInitiator::npos)
+                    {
+                    m_iWinner = i;
+                    fKeep     = true;
+                    }
+                ObjectArray::Handle haCause = f_haCause;
+                haCause[i] = vCause;
+                ++m_cDone;
+                notifyAll();
+                }
+
+            if (!fKeep)
+                {
+                TcpUtil::close(hSocket);
+                }
+            }
+
+    // ----- data members ---------------------------------------------------
+
+    protected:
+        /**
+        * The address of each candidate.
+        */
+        FinalView<ObjectArray> f_vaAddr;
+
+        /**
+        * The subport of each candidate.
+        */
+        FinalView<ObjectArray> f_vaSubport;
+
+        /**
+        * The Socket of each candidate.
+        */
+        FinalHandle<ObjectArray> f_haSocket;
+
+        /**
+        * The Exception raised by each failed attempt.
+        */
+        FinalHandle<ObjectArray> f_haCause;
+
+        /**
+        * The connect timeout.
+        */
+        int32_t m_cMillis;
+
+        /**
+        * The index of the first Socket to connect, or npos.
+        */
+        size32_t m_iWinner;
+
+        /**
+        * The number of completed attempts.
+        */
+        size32_t m_cDone;
+    };
+
+COH_CLOSE_NAMESPACE_ANON
+
+
 // ----- constructor --------------------------------------------------------
 
 TcpInitiator::TcpInitiator()
@@ -69,7 +278,8 @@ TcpInitiator::TcpInitiator()
       m_lReceiveBufferSize(0),
       m_hRemoteAddressProvider(self()),
       m_lSendBufferSize(0),
-      m_fTcpDelayEnabled(false)
+      m_fTcpDelayEnabled(false),
+      m_cConnectParallelism(1)
     {
     }
 
@@ -191,50 +401,74 @@ PofConnection::Handle TcpInitiator::openConnection()
     // determine the Socket connect timeout
     int32_t cMillis = std::max(0, (int32_t) getConnectTimeout());
 
+    // determine the number of addresses to connect to concurrently
+    size32_t cParallel = (size32_t) std::max(1, getConnectParallelism());
+
     // open a new connection
     List::Handle     hListAddr     = ArrayList::create();
     Iterator::Handle hIterRedirect = NULL;
     Iterator::Handle hIterSubport  = NULL;
     Exception::View  vCause        = NULL;
+    bool             fExhausted    = false;
     for ( ; ; )
         {
         TcpConnection::Handle hConnection = cast<TcpConnection::Handle>(
                 instantiateConnection());
 
-        InetSocketAddress::View vAddr;
-        int32_t                 nSubport;
+        // select the candidate addresses; redirect addresses are never
+        // combined with those of the address provider
+        List::Handle hListCandidate = ArrayList::create();
+        List::Handle hListSubport   = ArrayList::create();
         if (NULL == hIterRedirect || !hIterRedirect->hasNext())
             {
-            vAddr    = hProvider->getNextAddress();
-            nSubport = getSubport();
-
-
             // reset redirection information
             hIterRedirect = NULL;
             hIterSubport  = NULL;
+
+            while (hListCandidate->size() < cParallel)
+                {
+                InetSocketAddress::View vAddr = hProvider->getNextAddress();
+                if (NULL == vAddr)
+                    {
+                    // the provider has completed a full pass over its
+                    // addresses, and has already reset itself
+                    fExhausted = true;
+                    break;
+                    }
+                hListCandidate->add(vAddr);
+                hListSubport->add(Integer32::create(getSubport()));
+                }
             }
         else
             {
-            vAddr    = cast<InetSocketAddress::View>(hIterRedirect->next());
-            nSubport = (cast<Integer32::View>(hIterSubport->next()))->getInt32Value();
+            while (hListCandidate->size() < cParallel && hIterRedirect->hasNext())
+                {
+                hListCandidate->add(hIterRedirect->next());
+                hListSubport->add(hIterSubport->next());
+                }
 
             // update redirection information
             hConnection->setRedirect(true);
             }
 
-        if (NULL == vAddr)
+        size32_t cCandidate = hListCandidate->size();
+        if (cCandidate == 0)
             {
             break;
             }
 
-        String::View vsAddr = TcpUtil::toString(vAddr, nSubport);
-        hListAddr->add(vsAddr);
-
-        // create and configure a new Socket; otherwise, some JVMs
-        // may throw a SocketException when the Socket is reused
-        Socket::Handle hSocket = instantiateSocket();
-        try
+        // create and configure a new Socket for each candidate; otherwise,
+        // some JVMs may throw a SocketException when the Socket is reused
+        ObjectArray::Handle haAddr    = hListCandidate->toArray();
+        ObjectArray::Handle haSubport = hListSubport->toArray();
+        ObjectArray::Handle haSocket  = ObjectArray::create(cCandidate);
+        for (size32_t i = 0; i < cCandidate; ++i)
             {
+            String::View vsAddr = TcpUtil::toString(
+                    cast<InetSocketAddress::View>(haAddr[i]),
+                    cast<Integer32::View>(haSubport[i])->getInt32Value());
+            hListAddr->add(vsAddr);
+
             if (NULL == hIterRedirect)
                 {
                 COH_LOG("Connecting Socket to " << vsAddr, 5);
@@ -243,32 +477,75 @@ PofConnection::Handle TcpInitiator::openConnection()
                 {
                 COH_LOG("Redirecting Socket to " << vsAddr, 5);
                 }
+            haSocket[i] = instantiateSocket();
+            }
 
-            hSocket->connect(vAddr, cMillis);
-            COH_LOG("Connected Socket to " << vsAddr, 3);
-            if (nSubport != -1)
+        size32_t            iWinner  = npos;
+        ObjectArray::Handle haCause  = ObjectArray::create(cCandidate);
+        if (cCandidate == 1)
+            {
+            Socket::Handle hSocket  = cast<Socket::Handle>(haSocket[0]);
+            int32_t        nSubport = cast<Integer32::View>(haSubport[0])
+                    ->getInt32Value();
+            try
                 {
-                // write out subport info
-                TcpUtil::writeSubport(hSocket->getOutputStream(), nSubport);
+                hSocket->connect(cast<InetSocketAddress::View>(haAddr[0]),
+                        cMillis);
+                if (nSubport != -1)
+                    {
+                    // write out subport info
+                    TcpUtil::writeSubport(hSocket->getOutputStream(), nSubport);
+                    }
+                iWinner = 0;
+                }
+            catch (Exception::View e)
+                {
+                haCause[0] = e;
+                TcpUtil::close(hSocket);
                 }
-
-            hConnection->setSocket(hSocket);
             }
-        catch (Exception::View e)
+        else
+            {
+            iWinner = ConnectRace::create(haAddr, haSubport, haSocket,
+                    cMillis)->race(haCause);
+            }
+
+        // report each failed candidate in the order it was handed out; the
+        // winner is reported last, once its handshake has completed, so
+        // that accept() follows every reject() of the same pass
+        for (size32_t i = 0; i < cCandidate; ++i)
             {
-            COH_LOG("Error connecting Socket to " << vsAddr << ": " << e, 3);
-            TcpUtil::close(hSocket);
+            Exception::View e = cast<Exception::View>(haCause[i]);
+            if (NULL != e)
+                {
+                COH_LOG("Error connecting Socket to " << hListAddr->get(
+                        hListAddr->size() - cCandidate + i) << ": " << e, 3);
+
+                // if we aren't current redirecting, or we've tried the last
+                // redirect address, reject the address supplied by the
+                // address provider
+                if (NULL == hIterRedirect || !hIterRedirect->hasNext())
+                    {
+                    hProvider->reject(e);
+                    }
+                }
+            }
 
-            // if we aren't current redirecting, or we've tried the last
-            // redirect address, reject the last address supplied by the
-            // address provider
-            if (NULL == hIterRedirect || !hIterRedirect->hasNext())
+        if (iWinner == npos)
+            {
+            if (fExhausted && (NULL == hIterRedirect || !hIterRedirect->hasNext()))
                 {
-                hProvider->reject(e);
+                // every address has been tried once
+                break;
                 }
             continue;
             }
 
+        String::View vsAddr = cast<String::View>(hListAddr->get(
+                hListAddr->size() - cCandidate + iWinner));
+        COH_LOG("Connected Socket to " << vsAddr, 3);
+        hConnection->setSocket(cast<Socket::Handle>(haSocket[iWinner]));
+
         try
             {
             hConnection->open();
@@ -304,6 +581,10 @@ PofConnection::Handle TcpInitiator::openConnection()
                 if (NULL == hIterRedirect || !hIterRedirect->hasNext())
                     {
                     hProvider->reject(e);
+                    if (fExhausted)
+                        {
+                        break;
+                        }
                     }
                 }
             continue;
@@ -428,6 +709,13 @@ void TcpInitiator::configure(XmlElement::View vXml)
         // <linger-timeout>
         setLingerTimeout(parseTime(vXmlCat, "linger-timeout",
                 getLingerTimeout()));
+
+        String::View vsParallel = System::getProperty(
+                "coherence.tcp.connect.parallel");
+        if (NULL != vsParallel)
+            {
+            setConnectParallelism(Integer32::parse(vsParallel));
+            }
         }
     }
 
@@ -481,6 +769,16 @@ bool TcpInitiator::isTcpDelayEnabled() const
     return m_fTcpDelayEnabled;
     }
 
+int32_t TcpInitiator::getConnectParallelism() const
+    {
+    return m_cConnectParallelism;
+    }
+
+void TcpInitiator::setConnectParallelism(int32_t cParallel)
+    {
+    m_cConnectParallelism = cParallel;
+    }
+
 void TcpInitiator::setKeepAliveEnabled(bool fEnabled)
     {
     m_fKeepAliveEnabled = fEnabled;
@@ -607,6 +905,8 @@ TcpInitiator::TcpConnection::TcpConnection()
     : f_hInput(self()),
       f_hOutput(self()),
       m_hReader(self()),
+      f_hGateWrite(self(), PriorityGate::create(
+              AbstractPofMessage::priority_count, /*cMaxBypass*/ 16)),
       m_fRedirect(false),
       f_vListRedirect(self(), (List::View)NULL)
     {
@@ -627,7 +927,7 @@ String::View TcpInitiator::TcpConnection::TcpReader::getThreadName() const
     {
     TcpInitiator::View vInitiator = cast<TcpInitiator::View>(
             m_whTcpConnection->getConnectionManager());
-    return COH_TO_STRING(vInitiator->getServiceName() << ':' << super::getThreadName());
+    return COH_TO_STACK_STRING(vInitiator->getServiceName() << ':' << super::getThreadName());
     }
 
 void TcpInitiator::TcpConnection::TcpReader::onException(Exception::Holder ohe)
@@ -682,8 +982,15 @@ void TcpInitiator::TcpConnection::TcpReader::onNotify()
                 Array<octet_t>::Handle hab = Array<octet_t>::create(cb);
                 hIn->readFully(hab);
 
+                // release the Handle before dispatching so that the message
+                // buffer is immutable; this allows any Binary decoded from
+                // the Message to reference a slice of the buffer rather
+                // than a copy of it
+                Array<octet_t>::View vab = hab;
+                hab = NULL;
+
                 OctetArrayReadBuffer::View vBuffer = OctetArrayReadBuffer
-                        ::create(hab, 0, cb, false);
+                        ::create(vab, 0, cb, false);
 
                 // update stats
                 hConnection->setStatsBytesReceived(
@@ -779,46 +1086,75 @@ void TcpInitiator::TcpConnection::openInternal()
     setReader(hReader);
     }
 
-void TcpInitiator::TcpConnection::send(WriteBuffer::View vwb)
+void TcpInitiator::TcpConnection::send(WriteBuffer::View vwb,
+        int32_t nPriority)
     {
-    super::send(vwb);
+    super::send(vwb, nPriority);
 
     Array<octet_t>::View vab = vwb->toOctetArray();
     size32_t             cb  = vwb->length();
 
     // write the length-encoded Message to the Socket OutputStream. According
     // to the following post, there is no guarantee that the write operation
-    // is thread safe, so we must synchronize on the OutputStream:
+    // is thread safe, so writers must be serialized:
     //
     // http://forum.java.sun.com/thread.jspa?threadID=792640&tstart=165
     //
-    OutputStream::Handle hOut = getOutputStream();
+    // Writers are admitted by a PriorityGate rather than by synchronizing on
+    // the OutputStream, so that a small, latency critical Message does not
+    // wait behind any number of queued bulk Messages; it can however still
+    // wait for a Message which is already being written, as the frames of a
+    // Connection cannot be interleaved.
+    OutputStream::Handle hOut  = getOutputStream();
+    PriorityGate::Handle hGate = f_hGateWrite;
 
     m_cConcurrentWriters.postAdjust(1, /*fSafe*/ false);
-    COH_SYNCHRONIZED (hOut)
+    try
         {
-        try
+        hGate->enter(nPriority);
+        }
+    catch (Exception::View)
+        {
+        m_cConcurrentWriters.adjust(-1, /*fSafe*/ false);
+        throw;
+        }
+
+    struct ExitFinally
+        {
+        ExitFinally(PriorityGate::Handle hGateWrite)
+            : hGate(hGateWrite)
             {
-            // Message length
-            TcpInitiator::writeMessageLength(hOut, cb);
-            // Message contents
-            hOut->write(vab);
             }
-        catch (IOException::View ve)
+
+        ~ExitFinally()
             {
-            if (m_cConcurrentWriters.adjust(-1, /*fSafe*/ false) == 0)
-                {
-                // only the last of the concurrent writers needs to flush
-                hOut->flush();
-                }
-            COH_THROW (ConnectionException::create(ve->getMessage(), ve, this));
+            hGate->exit();
             }
 
+        PriorityGate::Handle hGate;
+        } finally(hGate);
+
+    try
+        {
+        // Message length
+        TcpInitiator::writeMessageLength(hOut, cb);
+        // Message contents
+        hOut->write(vab);
+        }
+    catch (IOException::View ve)
+        {
         if (m_cConcurrentWriters.adjust(-1, /*fSafe*/ false) == 0)
             {
             // only the last of the concurrent writers needs to flush
             hOut->flush();
             }
+        COH_THROW (ConnectionException::create(ve->getMessage(), ve, this));
+        }
+
+    if (m_cConcurrentWriters.adjust(-1, /*fSafe*/ false) == 0)
+        {
+        // only the last of the concurrent writers needs to flush
+        hOut->flush();
         }
     }
 
@@ -11,11 +11,14 @@
 #include "coherence/lang/OutOfMemoryError.hpp"
 #include "coherence/lang/Thread.hpp"
 
+#include "coherence/native/NativeAtomic32.hpp"
+
 #include "private/coherence/native/NativeThreadLocal.hpp"
 #include "private/coherence/util/logging/Logger.hpp"
 
 #include <climits>
 #include <iostream>
+#include <new>
 #include <stdlib.h>
 
 COH_OPEN_NAMESPACE2(coherence,lang)
@@ -119,6 +122,84 @@ namespace
         }
     COH_STATIC_INIT(getMemoryPoolSlotRefill());
 
+    /**
+    * Return the number of pool size classes.
+    *
+    * Size class i serves blocks of (slot size << i) bytes, allowing medium
+    * sized allocations such as String and Array payloads to be satisfied
+    * from the thread-local pools rather than the system heap.
+    */
+    size_t getMemoryPoolClassCount()
+        {
+        // Note: we can't use System::getProperty() here because that would
+        // involve Object creation, and we'd endlessly recurse, we need to
+        // return a single stable value for the life of the process
+        // COH-12944 requires checking system property prefix for either coherence or tangosol
+        static const char* achClassTmp1 = getenv("coherence.heap.slot.classes");
+        static const char* achClassTmp2 = achClassTmp1 == NULL
+            ? getenv("CoherenceHeapSlotClasses")
+            : achClassTmp1;
+        static const char* achClassTmp3 = achClassTmp2 == NULL
+            ? getenv("tangosol.coherence.heap.slot.classes")
+            : achClassTmp2;
+        static const char* achClass     = achClassTmp3 == NULL
+            ? getenv("TangosolCoherenceHeapSlotClasses")
+            : achClassTmp3;
+        static const unsigned long lClasses = achClass == NULL ? 4 : strtoul(achClass, NULL, 10);
+        // bound the number of classes such that the largest slot size
+        // remains representable
+        static const size_t cClasses = lClasses == 0 ? 1
+            : lClasses < 16 ? (size_t) lClasses : 16;
+        return cClasses;
+        }
+    COH_STATIC_INIT(getMemoryPoolClassCount());
+
+    /**
+    * Return the arena chunk size for the specified requested size.
+    *
+    * @param cb  the requested size, or 0 to disable arena scopes
+    *
+    * @return the chunk size, or 0 if arena scopes are disabled
+    */
+    int32_t toArenaSize(size_t cb)
+        {
+        // a chunk must be large enough to amortize its header and hold
+        // more than a handful of blocks
+        return cb == 0 ? 0
+            : cb < 4096 ? 4096
+            : cb > 0x40000000 ? 0x40000000
+            : (int32_t) cb;
+        }
+
+    /**
+    * Return the size of the arena chunks used within arena scopes, or 0 if
+    * arena scopes are disabled.
+    *
+    * The initial value is taken from the coherence.heap.arena.size
+    * property, and may be changed via Allocator::setArenaSize.
+    */
+    NativeAtomic32& getMemoryArenaSize()
+        {
+        // Note: we can't use System::getProperty() here because that would
+        // involve Object creation, and we'd endlessly recurse
+        // COH-12944 requires checking system property prefix for either coherence or tangosol
+        static const char* achArenaTmp1 = getenv("coherence.heap.arena.size");
+        static const char* achArenaTmp2 = achArenaTmp1 == NULL
+            ? getenv("CoherenceHeapArenaSize")
+            : achArenaTmp1;
+        static const char* achArenaTmp3 = achArenaTmp2 == NULL
+            ? getenv("tangosol.coherence.heap.arena.size")
+            : achArenaTmp2;
+        static const char* achArena     = achArenaTmp3 == NULL
+            ? getenv("TangosolCoherenceHeapArenaSize")
+            : achArenaTmp3;
+        static const unsigned long lbArena = achArena == NULL ? 0 : strtoul(achArena, NULL, 10);
+        static NativeAtomic32 s_atomicArena(
+                lbArena == ULONG_MAX ? 0 : toArenaSize((size_t) lbArena));
+        return s_atomicArena;
+        }
+    COH_STATIC_INIT(getMemoryArenaSize());
+
     /**
     * Return the amount of padding which should be added to the front and
     * back of each allocated object.
@@ -367,6 +448,37 @@ namespace
                 return false;
                 }
 
+            /**
+            * Return the size of the blocks held by this pool.
+            *
+            * @return the slot size
+            */
+            size_t getSlotSize() const
+                {
+                return m_cbSlot;
+                }
+
+            /**
+            * Return the number of allocations satisfied from this pool.
+            *
+            * @return the hit count
+            */
+            size_t getHits() const
+                {
+                return m_cHits;
+                }
+
+            /**
+            * Return the number of allocations which this pool could not
+            * satisfy.
+            *
+            * @return the miss count
+            */
+            size_t getMisses() const
+                {
+                return m_cMisses;
+                }
+
         protected:
             /**
             * The number of slots.
@@ -411,17 +523,377 @@ namespace
         };
 
     /**
-    * Return the system's singleton always empty pool.
+    * The bit set within the encoded size of blocks allocated from an arena.
+    */
+    const size_t ARENA_BLOCK = ~(size_t(-1) >> 1);
+
+    /**
+    * The number of bytes preceding each arena block which hold the address
+    * of its chunk, sized to retain 16 byte alignment.
+    */
+    const size_t ARENA_PREFIX = 16;
+
+    /**
+    * A chunk of memory from which arena blocks are bump allocated.
+    *
+    * The chunk counts the blocks allocated from it which have yet to be
+    * released, plus one reference held by the owning thread while the chunk
+    * is its current chunk. Blocks may be released by any thread, and the
+    * chunk is freed once the count reaches zero.
+    */
+    class ArenaChunk
+        {
+        public:
+            /**
+            * Create a chunk of the specified total size.
+            *
+            * @param cb  the chunk size, including its header
+            *
+            * @return the chunk, referenced by the calling thread
+            */
+            static ArenaChunk* create(size_t cb)
+                {
+                void* ab = ::malloc(cb);
+                OutOfMemoryError::ensure(ab, cb);
+                return new (ab) ArenaChunk(cb);
+                }
+
+            /**
+            * Release a reference to the chunk, freeing it if no references
+            * remain.
+            *
+            * @param pChunk  the chunk
+            */
+            static void release(ArenaChunk* pChunk)
+                {
+                if (pChunk->m_atomicLive.adjust(-1, false) == 0)
+                    {
+                    pChunk->~ArenaChunk();
+                    ::free(pChunk);
+                    }
+                }
+
+            /**
+            * Return the chunk from which the specified block was allocated.
+            *
+            * @param ab  the block, as returned by allocate
+            *
+            * @return the chunk
+            */
+            static ArenaChunk* getChunk(void* ab)
+                {
+                ArenaChunk* pChunk;
+                ::memcpy(&pChunk, ((unsigned char*) ab) - ARENA_PREFIX,
+                        sizeof(ArenaChunk*));
+                return pChunk;
+                }
+
+        private:
+            ArenaChunk(size_t cb)
+                : m_cb(cb), m_of(getHeaderSize()), m_atomicLive(1)
+                {
+                }
+
+        public:
+            /**
+            * Allocate a block from the chunk.
+            *
+            * @param cb  the block size, a multiple of ARENA_PREFIX
+            *
+            * @return the block, or NULL if the chunk is exhausted
+            */
+            void* allocate(size_t cb)
+                {
+                size_t of = m_of;
+                if (cb + ARENA_PREFIX > m_cb - of)
+                    {
+                    return NULL;
+                    }
+                m_of = of + cb + ARENA_PREFIX;
+                m_atomicLive.adjust(1, false);
+
+                unsigned char* ab     = ((unsigned char*) this) + of;
+                ArenaChunk*    pChunk = this;
+                ::memcpy(ab, &pChunk, sizeof(ArenaChunk*));
+                return ab + ARENA_PREFIX;
+                }
+
+            /**
+            * Recycle the chunk's memory, if none of its blocks remain live.
+            *
+            * This may only be called by the owning thread.
+            *
+            * @return true if the chunk was rewound
+            */
+            bool reset()
+                {
+                if (m_of > getHeaderSize() && m_atomicLive.get() == 1)
+                    {
+                    // only the owner's reference remains, and only the owner
+                    // allocates; rewind in bulk
+                    m_of = getHeaderSize();
+                    return true;
+                    }
+                return false;
+                }
+
+        protected:
+            /**
+            * Return the size of the chunk header, rounded to ARENA_PREFIX.
+            */
+            static size_t getHeaderSize()
+                {
+                return (sizeof(ArenaChunk) + ARENA_PREFIX - 1) & ~(ARENA_PREFIX - 1);
+                }
+
+            /**
+            * The total size of the chunk.
+            */
+            size_t m_cb;
+
+            /**
+            * The offset of the next free byte.
+            */
+            size_t m_of;
+
+            /**
+            * The number of live blocks, plus one for the owning thread.
+            */
+            NativeAtomic32 m_atomicLive;
+        };
+
+    /**
+    * Thread local set of memory pools, one per size class.
     */
-    Pool& getSystemPool()
+    class PoolSet
+        {
+        public:
+            PoolSet(size_t cClasses, size_t cSlots, size_t cbSlot,
+                    size_t cRefill, bool fHeapLogging, bool fArena)
+                : m_cPools(0), m_apPool(NULL), m_fArena(fArena),
+                  m_pArena(NULL), m_cArenaScope(0), m_cArenaHits(0),
+                  m_cArenaRewinds(0)
+                {
+                // larger slots are given proportionally fewer entries,
+                // bounding the pool memory of each class to a fraction of
+                // the class below it; classes left without slots are
+                // served by the system heap
+                while (cClasses > 1 && (cSlots >> (2 * (cClasses - 1))) == 0)
+                    {
+                    --cClasses;
+                    }
+
+                if (cClasses > 0)
+                    {
+                    Pool** apPool = (Pool**) ::calloc(cClasses, sizeof(Pool*));
+                    OutOfMemoryError::ensure(apPool, cClasses * sizeof(Pool*));
+                    for (size_t i = 0; i < cClasses; ++i)
+                        {
+                        apPool[i] = new Pool(cSlots >> (2 * i), cbSlot << i,
+                                cRefill, fHeapLogging);
+                        }
+                    m_apPool = apPool;
+                    m_cPools = cClasses;
+                    }
+                }
+
+            ~PoolSet()
+                {
+                Pool** apPool = m_apPool;
+                if (apPool != NULL)
+                    {
+                    for (size_t i = 0, c = m_cPools; i < c; ++i)
+                        {
+                        delete apPool[i];
+                        }
+                    ::free(apPool);
+                    }
+
+                // any live blocks will free the chunk upon their release
+                if (m_pArena != NULL)
+                    {
+                    ArenaChunk::release(m_pArena);
+                    }
+                }
+
+            /**
+            * Return the number of pools in the set.
+            *
+            * @return the pool count
+            */
+            size_t getPoolCount() const
+                {
+                return m_cPools;
+                }
+
+            /**
+            * Return the pool for the specified size class.
+            *
+            * @param iClass  the size class
+            *
+            * @return the pool, or NULL if the class is not pooled
+            */
+            Pool* getPool(size_t iClass)
+                {
+                return iClass < m_cPools ? m_apPool[iClass] : NULL;
+                }
+
+            /**
+            * Enter an arena scope.
+            */
+            void enterArena()
+                {
+                ++m_cArenaScope;
+                }
+
+            /**
+            * Exit an arena scope, recycling the current chunk upon exiting
+            * the outermost scope if none of its blocks remain live.
+            */
+            void exitArena()
+                {
+                if (m_cArenaScope > 0 && --m_cArenaScope == 0 &&
+                    m_pArena != NULL && m_pArena->reset())
+                    {
+                    ++m_cArenaRewinds;
+                    }
+                }
+
+            /**
+            * Allocate a block from the arena.
+            *
+            * @param cb  the block size
+            *
+            * @return the block, or NULL if not within an arena scope or the
+            *         block is too large to be arena allocated
+            */
+            void* allocateArena(size_t cb)
+                {
+                if (m_cArenaScope == 0)
+                    {
+                    return NULL;
+                    }
+
+                size_t cbArena = m_fArena
+                        ? (size_t) getMemoryArenaSize().peek() : 0;
+                if (cb > cbArena / 8)
+                    {
+                    return NULL;
+                    }
+
+                cb = (cb + ARENA_PREFIX - 1) & ~(ARENA_PREFIX - 1);
+
+                ArenaChunk* pArena = m_pArena;
+                void*       ab     = pArena == NULL ? NULL : pArena->allocate(cb);
+                if (ab == NULL)
+                    {
+                    // retire the exhausted chunk, it will be freed once the
+                    // last of its blocks is released
+                    if (pArena != NULL)
+                        {
+                        m_pArena = NULL;
+                        ArenaChunk::release(pArena);
+                        }
+                    m_pArena = pArena = ArenaChunk::create(cbArena);
+                    ab       = pArena->allocate(cb);
+                    }
+                ++m_cArenaHits;
+                return ab;
+                }
+
+            /**
+            * Return the number of allocations satisfied from the arena.
+            *
+            * @return the arena hit count
+            */
+            size_t getArenaHits() const
+                {
+                return m_cArenaHits;
+                }
+
+            /**
+            * Return the number of times the current chunk was recycled in
+            * bulk upon exiting an arena scope.
+            *
+            * @return the arena rewind count
+            */
+            size_t getArenaRewinds() const
+                {
+                return m_cArenaRewinds;
+                }
+
+        protected:
+            /**
+            * The number of pools.
+            */
+            size_t m_cPools;
+
+            /**
+            * The array of pools, indexed by size class.
+            */
+            Pool** m_apPool;
+
+            /**
+            * True if blocks may be allocated from an arena.
+            */
+            bool m_fArena;
+
+            /**
+            * The current arena chunk.
+            */
+            ArenaChunk* m_pArena;
+
+            /**
+            * The arena scope nesting depth.
+            */
+            size_t m_cArenaScope;
+
+            /**
+            * The number of arena allocations.
+            */
+            size_t m_cArenaHits;
+
+            /**
+            * The number of arena chunk rewinds.
+            */
+            size_t m_cArenaRewinds;
+        };
+
+    /**
+    * Return the size class for a block of the specified size, or npos if
+    * the block is larger than the largest slot size.
+    *
+    * @param cb      the block size
+    * @param fExact  true if the block size must match the slot size
+    */
+    size_t getSizeClass(size_t cb, bool fExact)
+        {
+        static const size_t cbSlot   = getMemoryPoolSlotSize();
+        static const size_t cClasses = getMemoryPoolClassCount();
+
+        size_t cbClass = cbSlot;
+        for (size_t i = 0; i < cClasses; ++i, cbClass <<= 1)
+            {
+            if (cb <= cbClass)
+                {
+                return !fExact || cb == cbClass ? i : size_t(-1);
+                }
+            }
+        return size_t(-1);
+        }
+
+    /**
+    * Return the system's singleton always empty pool set.
+    */
+    PoolSet& getSystemPool()
         {
         // the system pool is always empty, so it will redirect to malloc/free
-        static Pool poolSystem(0, 0, 0, isHeapLogging());
+        static PoolSet poolSystem(0, 0, 0, 0, isHeapLogging(), false);
         return poolSystem;
         }
     COH_STATIC_INIT(getSystemPool());
 
-    Pool& getTLSPool(); // forward decl
+    PoolSet& getTLSPool(); // forward decl
 
     /**
     * Helper class for initializing and cleaning up the TLS used to store the
@@ -438,8 +910,8 @@ namespace
             ~TLSManager()
                 {
                 // Free the pool for this thread
-                Pool* pPoolSystem = &(getSystemPool());
-                Pool* pPoolThread = &(getTLSPool());
+                PoolSet* pPoolSystem = &(getSystemPool());
+                PoolSet* pPoolThread = &(getTLSPool());
 
                 if (pPoolSystem != pPoolThread)
                     {
@@ -470,20 +942,22 @@ namespace
     COH_STATIC_INIT(TLSManager::getTLS());
 
     /**
-    * Return the memory pool for the current thread.
+    * Return the memory pools for the current thread.
     */
-    Pool& getTLSPool()
+    PoolSet& getTLSPool()
         {
         NativeThreadLocal* pTLS  = TLSManager::getTLS();
-        Pool*              pPool = pTLS == NULL
+        PoolSet*           pPool = pTLS == NULL
                 ? &(getSystemPool())
-                : (Pool*) pTLS->get();
+                : (PoolSet*) pTLS->get();
 
         if (NULL == pPool)
             {
-            pPool = new Pool(getMemoryPoolSlotCount(),
-                    getMemoryPoolSlotSize(), getMemoryPoolSlotRefill(),
-                    isHeapLogging());
+            pPool = new PoolSet(getMemoryPoolClassCount(),
+                    getMemoryPoolSlotCount(), getMemoryPoolSlotSize(),
+                    getMemoryPoolSlotRefill(), isHeapLogging(),
+                    // arena blocks are identified by their encoded size
+                    getMemoryPadSize(true) > 0);
             pTLS->set(pPool);
             }
         return *pPool;
@@ -492,11 +966,11 @@ namespace
 
 extern "C" void coh_tls_pool_cleanup(void* pPool)
     {
-    Pool* pPoolSystem = &getSystemPool();
+    PoolSet* pPoolSystem = &getSystemPool();
 
     if (pPool != pPoolSystem)
         {
-        delete (Pool*) pPool;
+        delete (PoolSet*) pPool;
 
         // in case there are any more allocs or frees before the thread completely
         // dies we need to redirect all remaining allocations to the system pool
@@ -510,7 +984,6 @@ extern "C" void coh_tls_pool_cleanup(void* pPool)
 
 void* Allocator::allocate(size_t cb)
     {
-    static const size_t cbSlot       = getMemoryPoolSlotSize();
     static const size_t cbPadPre     = getMemoryPadSize(true);
     static const size_t cbPadPost    = getMemoryPadSize(false);
     static const size_t cbPadTotal   = cbPadPre + cbPadPost;
@@ -524,15 +997,18 @@ void* Allocator::allocate(size_t cb)
         }
     size_t cbAlloc = cb + cbPadTotal;
 
-    void* ab = NULL;
-    if (cbAlloc <= cbSlot)
+    PoolSet& pools  = getTLSPool();
+    void*    ab     = pools.allocateArena(cbAlloc);
+    bool     fArena = ab != NULL;
+    Pool*    pPool  = fArena ? NULL : pools.getPool(getSizeClass(cbAlloc, false));
+    if (pPool != NULL)
         {
-        // eligible for pooled allocation
-        // TODO: add support for N pools
-        ab = getTLSPool().allocate();
+        // eligible for pooled allocation from the smallest fitting class
+        ab = pPool->allocate();
 
         if (ab)
             {
+            size_t cbSlot = pPool->getSlotSize();
             cbAlloc = cbSlot;
             cb      = cbSlot - cbPadTotal;
             }
@@ -552,7 +1028,8 @@ void* Allocator::allocate(size_t cb)
         {
         // encode size
         // format: <size> [pre-pattern] [hash] <data> [post-pattern]
-        ::memcpy(ab, &cb, sizeof(size_t));
+        size_t cbEncode = fArena ? (cb | ARENA_BLOCK) : cb;
+        ::memcpy(ab, &cbEncode, sizeof(size_t));
 
         unsigned char* abPad = (unsigned char*) ab;
         if (fValidatePre)
@@ -600,7 +1077,6 @@ void* Allocator::allocate(size_t cb)
 
 void Allocator::release(void* ab)
     {
-    static const size_t cbSlot       = getMemoryPoolSlotSize();
     static const size_t cbPadPre     = getMemoryPadSize(true);
     static const size_t cbPadPost    = getMemoryPadSize(false);
     static const size_t cbPadTotal   = cbPadPre + cbPadPost;
@@ -640,6 +1116,8 @@ void Allocator::release(void* ab)
         // read size
         size_t cb;
         ::memcpy(&cb, abFree, sizeof(size_t));
+        bool   fArena = (cb & ARENA_BLOCK) != 0;
+        cb &= ~ARENA_BLOCK;
         size_t cbFree = cb + cbPadTotal;
 
         if (cbPadPost > 0)
@@ -665,14 +1143,21 @@ void Allocator::release(void* ab)
             ::memset(abFree, 0, cbFree);
             }
 
-        if (cbFree == cbSlot)
+        if (fArena)
             {
-            // eligible for release back into pool
-            if (getTLSPool().release(abFree))
-                {
-                // the pool accepted the block
-                return;
-                }
+            // arena blocks are reclaimed in bulk with their chunk
+            ArenaChunk::release(ArenaChunk::getChunk(abFree));
+            return;
+            }
+
+        // eligible for release back into the pool of the matching size
+        // class; blocks freed by a thread other than the allocating thread
+        // simply replenish the freeing thread's pool
+        Pool* pPool = getTLSPool().getPool(getSizeClass(cbFree, true));
+        if (pPool != NULL && pPool->release(abFree))
+            {
+            // the pool accepted the block
+            return;
             }
         }
     else
@@ -684,4 +1169,63 @@ void Allocator::release(void* ab)
     ::free(abFree);
     }
 
+size_t Allocator::getSizeClassCount()
+    {
+    return getTLSPool().getPoolCount();
+    }
+
+size_t Allocator::getSizeClassSlotSize(size_t iClass)
+    {
+    Pool* pPool = getTLSPool().getPool(iClass);
+    return pPool == NULL ? 0 : pPool->getSlotSize();
+    }
+
+size_t Allocator::getSizeClassHits(size_t iClass)
+    {
+    Pool* pPool = getTLSPool().getPool(iClass);
+    return pPool == NULL ? 0 : pPool->getHits();
+    }
+
+size_t Allocator::getSizeClassMisses(size_t iClass)
+    {
+    Pool* pPool = getTLSPool().getPool(iClass);
+    return pPool == NULL ? 0 : pPool->getMisses();
+    }
+
+void Allocator::enterArena()
+    {
+    getTLSPool().enterArena();
+    }
+
+void Allocator::exitArena()
+    {
+    getTLSPool().exitArena();
+    }
+
+size_t Allocator::getArenaHits()
+    {
+    return getTLSPool().getArenaHits();
+    }
+
+size_t Allocator::getArenaRewinds()
+    {
+    return getTLSPool().getArenaRewinds();
+    }
+
+size_t Allocator::setArenaSize(size_t cb)
+    {
+    NativeAtomic32& atomicArena = getMemoryArenaSize();
+    int32_t         cbNew       = toArenaSize(cb);
+    int32_t         cbOld       = atomicArena.peek();
+    while (true)
+        {
+        int32_t cbActual = atomicArena.update(cbOld, cbNew);
+        if (cbActual == cbOld)
+            {
+            return (size_t) cbOld;
+            }
+        cbOld = cbActual;
+        }
+    }
+
 COH_CLOSE_NAMESPACE2
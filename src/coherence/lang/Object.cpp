@@ -10,6 +10,7 @@
 #include "coherence/lang/CloneNotSupportedException.hpp"
 #include "coherence/lang/HeapAnalyzer.hpp"
 #include "coherence/lang/InterruptedException.hpp"
+#include "coherence/lang/OutOfMemoryError.hpp"
 #include "coherence/lang/String.hpp"
 #include "coherence/lang/System.hpp"
 #include "coherence/lang/SystemClassLoader.hpp"
@@ -28,9 +29,11 @@
 #include "private/coherence/lang/WeakReferenceImpl.hpp"
 #include "private/coherence/native/NativeCondition.hpp"
 #include "private/coherence/native/NativeThread.hpp"
+#include "private/coherence/native/NativeThreadLocal.hpp"
 #include "private/coherence/util/logging/Logger.hpp"
 
 #include <stdlib.h>
+#include <string.h>
 
 COH_OPEN_NAMESPACE2(coherence,lang)
 
@@ -39,6 +42,7 @@ COH_REGISTER_TYPED_CLASS(Object);
 using coherence::native::NativeAtomic32;
 using coherence::native::NativeCondition;
 using coherence::native::NativeThread;
+using coherence::native::NativeThreadLocal;
 
 using coherence::util::IdentityHashMap;
 using coherence::util::Map;
@@ -61,6 +65,13 @@ extern void coh_checkThreadDumpRequest();
 
 // ----- file local helpers -------------------------------------------------
 
+/**
+* Thread cleanup function for the thin monitor owner identity.
+*
+* @param pTag  the calling thread's thin monitor owner identity
+*/
+extern "C" void coh_thin_monitor_owner_cleanup(void* pTag);
+
 namespace
     {
     /**
@@ -84,6 +95,159 @@ namespace
         return cSpin;
         }
     COH_STATIC_INIT(getMaxMemberLockSpin());
+
+    /**
+    * Return the flag indicating if uncontended monitors on escaped Objects
+    * should be held as thin locks within the Object's LifeCycle rather then
+    * by inflating a NativeCondition.
+    */
+    NativeAtomic32& getThinMonitorFlag()
+        {
+        // COH-12944 requires checking system property prefix for either coherence or tangosol
+        static const char* achThinTmp1 = getenv("coherence.monitor.thin");
+        static const char* achThinTmp2 = achThinTmp1 == NULL
+                    ? getenv("CoherenceMonitorThin")
+                    : achThinTmp1;
+        static const char* achThinTmp3 = achThinTmp2 == NULL
+                    ? getenv("tangosol.coherence.monitor.thin")
+                    : achThinTmp2;
+        static const char* achThin     = achThinTmp3 == NULL
+                    ? getenv("TangosolCoherenceMonitorThin")
+                    : achThinTmp3;
+        static NativeAtomic32 s_atomicThin(achThin != NULL &&
+                    strcmp(achThin, "true") == 0 ? 1 : 0);
+        return s_atomicThin;
+        }
+    COH_STATIC_INIT(getThinMonitorFlag());
+
+    /**
+    * Return true if monitors which are not yet held should be entered as
+    * thin monitors.
+    *
+    * Only the acquisition of new thin monitors depends upon this setting,
+    * monitors which are already held thin are released and inflated based
+    * upon their LifeCycle state, thus the setting may change at any time.
+    */
+    bool isThinMonitorEnabled()
+        {
+        return getThinMonitorFlag().peek() != 0;
+        }
+
+    /**
+    * Read the Object's monitor pointer, which identifies the owning thread
+    * while the monitor is thin and may be updated concurrently by the owner.
+    *
+    * The access need not be ordered, as the LifeCycle state transitions
+    * which enter and exit the thin monitor provide the ordering; it only
+    * must not be torn.
+    *
+    * @param pCondition  the monitor pointer
+    *
+    * @return the value of the monitor pointer
+    */
+    inline NativeCondition* peekMonitorPointer(NativeCondition* const& pCondition)
+        {
+#if defined(__ATOMIC_ACQUIRE)
+        return __atomic_load_n(&pCondition, __ATOMIC_RELAXED);
+#else
+        // aligned pointer sized accesses are atomic on the other platforms
+        return *const_cast<NativeCondition* const volatile*>(&pCondition);
+#endif
+        }
+
+    /**
+    * Write the Object's monitor pointer.
+    *
+    * @param pCondition  the monitor pointer
+    * @param pValue      the new value
+    *
+    * @see peekMonitorPointer
+    */
+    inline void pokeMonitorPointer(NativeCondition*& pCondition,
+            NativeCondition* pValue)
+        {
+#if defined(__ATOMIC_ACQUIRE)
+        __atomic_store_n(&pCondition, pValue, __ATOMIC_RELAXED);
+#else
+        *const_cast<NativeCondition* volatile*>(&pCondition) = pValue;
+#endif
+        }
+
+    /**
+    * Return the number of times a thread will retry a thin monitor held by
+    * another thread before requesting that the monitor be inflated.
+    *
+    * The budget adapts to the observed hold times; it grows each time a
+    * retrying thread goes on to acquire the thin monitor, and shrinks each
+    * time the budget is exhausted.
+    */
+    NativeAtomic32& getThinMonitorSpin()
+        {
+        static NativeAtomic32 s_atomicSpin((int32_t) getMaxMemberLockSpin());
+        return s_atomicSpin;
+        }
+    COH_STATIC_INIT(getThinMonitorSpin());
+
+    /**
+    * Return the NativeThreadLocal holding each thread's thin monitor owner
+    * identity.
+    */
+    NativeThreadLocal* getThinMonitorOwnerTLS()
+        {
+        static NativeThreadLocal* s_pTLS =
+                NativeThreadLocal::create(&coh_thin_monitor_owner_cleanup);
+        return s_pTLS;
+        }
+    COH_STATIC_INIT(getThinMonitorOwnerTLS());
+
+    /**
+    * Return an identity for the calling thread which is recorded in place
+    * of the NativeCondition while the calling thread holds a thin monitor.
+    */
+    NativeCondition* getThinMonitorOwner()
+        {
+        NativeThreadLocal* pTLS = getThinMonitorOwnerTLS();
+        void*              pTag = pTLS->get();
+        if (pTag == NULL)
+            {
+            // the allocation only serves as a unique address for the thread
+            pTag = ::malloc(1);
+            OutOfMemoryError::ensure(pTag, 1);
+            pTLS->set(pTag);
+            }
+        return reinterpret_cast<NativeCondition*>(pTag);
+        }
+
+    /**
+    * Return the condition upon which threads park while waiting for a
+    * contended thin monitor to be released.
+    *
+    * A single condition is shared by all thin monitors; it is only used once
+    * a monitor has been marked as contended, and such monitors are inflated
+    * as soon as they are released.
+    */
+    NativeCondition& getThinMonitorParker()
+        {
+        static NativeCondition* s_pCondition = NativeCondition::create();
+        return *s_pCondition;
+        }
+    COH_STATIC_INIT(getThinMonitorParker());
+
+    /**
+    * Wake any threads parked waiting for a contended thin monitor.
+    */
+    void notifyThinMonitorParker()
+        {
+        NativeCondition& parker = getThinMonitorParker();
+        parker.lock();
+        parker.notifyAll();
+        parker.unlock();
+        }
+    }
+
+extern "C" void coh_thin_monitor_owner_cleanup(void* pTag)
+    {
+    ::free(pTag);
     }
 
 /**
@@ -183,7 +347,9 @@ size64_t Object::sizeOf(bool fDeep) const
                     cb += sizeof(WeakReferenceImpl);
                     }
 
-                if (m_pCondition != NULL && _isEscaped())
+                if (m_pCondition != NULL &&
+                    LifeCycle::State(m_atomicLifeCycleState.peek()).value.nMonitor ==
+                        LifeCycle::inflated)
                     {
                     cb += m_pCondition->sizeOf();
                     }
@@ -215,12 +381,141 @@ size64_t Object::sizeOf(bool fDeep) const
 
 void Object::_enterMonitorInternal() const
     {
-    _ensureMonitor().lock();
+    if (!_enterThinMonitor())
+        {
+        _ensureMonitor().lock();
+        }
     }
 
 void Object::_exitMonitorInternal() const
     {
-    _ensureMonitor().unlock();
+    if (!_exitThinMonitor())
+        {
+        _ensureMonitor().unlock();
+        }
+    }
+
+bool Object::_enterThinMonitor() const
+    {
+    if (!isThinMonitorEnabled())
+        {
+        return false;
+        }
+
+    NativeCondition* pOwner     = getThinMonitorOwner();
+    NativeAtomic32&  atomicSpin = getThinMonitorSpin();
+    int32_t          cSpinMax   = (int32_t) getMaxMemberLockSpin();
+    int32_t          cSpin      = (int32_t) atomicSpin.peek();
+    int32_t          cRetry     = 0;
+    LifeCycle::State stateOld, stateAssumed, stateNew;
+
+    stateOld = m_atomicLifeCycleState.peek();
+    while (true)
+        {
+        if (stateOld.value.nMonitor != LifeCycle::flat ||
+            stateOld.value.fMonitorContended)
+            {
+            // inflated, or inflation has been requested
+            return false;
+            }
+
+        stateNew = stateAssumed = stateOld;
+        if (stateOld.value.cMonitorThin == 0)
+            {
+            // unowned; try to take ownership
+            stateNew.value.cMonitorThin = 1;
+            stateOld = m_atomicLifeCycleState.updateAcquire(stateAssumed, stateNew);
+            if (stateOld == stateAssumed)
+                {
+                pokeMonitorPointer(m_pCondition, pOwner);
+                if (cRetry > 0 && cSpin < cSpinMax)
+                    {
+                    // retrying paid off, allow a bit more next time
+                    atomicSpin.poke(cSpin * 2 < cSpinMax ? cSpin * 2 : cSpinMax);
+                    }
+                return true;
+                }
+            }
+        else if (peekMonitorPointer(m_pCondition) == pOwner)
+            {
+            // recursive enter by the owning thread
+            if (stateOld.value.cMonitorThin == LifeCycle::max_thin_monitor)
+                {
+                // _ensureMonitor will inflate on behalf of the owner
+                return false;
+                }
+            ++stateNew.value.cMonitorThin;
+            stateOld = m_atomicLifeCycleState.update(stateAssumed, stateNew);
+            if (stateOld == stateAssumed)
+                {
+                return true;
+                }
+            }
+        else if (++cRetry > cSpin)
+            {
+            // held by another thread for too long; request inflation
+            if (cSpin > 1)
+                {
+                atomicSpin.poke(cSpin / 2);
+                }
+            stateNew.value.fMonitorContended = 1;
+            stateOld = m_atomicLifeCycleState.update(stateAssumed, stateNew);
+            if (stateOld == stateAssumed)
+                {
+                return false;
+                }
+            }
+        else
+            {
+            NativeThread::yield(); // avoid Thread::yield(), COHCPP-331
+            stateOld = m_atomicLifeCycleState.get();
+            }
+        }
+    }
+
+bool Object::_exitThinMonitor() const
+    {
+    LifeCycle::State stateOld, stateAssumed, stateNew;
+
+    stateOld = m_atomicLifeCycleState.peek();
+    if (stateOld.value.nMonitor != LifeCycle::flat)
+        {
+        return false;
+        }
+    else if (stateOld.value.cMonitorThin == 0)
+        {
+        if (!isThinMonitorEnabled())
+            {
+            return false;
+            }
+        coh_throw_illegal_state("Invalid monitor state");
+        }
+    else if (peekMonitorPointer(m_pCondition) != getThinMonitorOwner())
+        {
+        coh_throw_illegal_state("Invalid monitor state");
+        }
+    else if (stateOld.value.cMonitorThin == 1)
+        {
+        // give up ownership before releasing the monitor
+        pokeMonitorPointer(m_pCondition, NULL);
+        }
+
+    // only the owner may change the hold count or inflate, thus the monitor
+    // will remain flat and owned while other state bits change
+    do
+        {
+        stateNew = stateAssumed = stateOld;
+        --stateNew.value.cMonitorThin;
+        stateOld = m_atomicLifeCycleState.updateRelease(stateAssumed, stateNew);
+        }
+    while (stateOld != stateAssumed);
+
+    if (stateNew.value.cMonitorThin == 0 && stateNew.value.fMonitorContended)
+        {
+        // wake the threads waiting to inflate the monitor
+        notifyThinMonitorParker();
+        }
+    return true;
     }
 
 void Object::wait() const
@@ -328,6 +623,14 @@ void Object::notify() const
     LifeCycle::State state = m_atomicLifeCycleState.peek();
     if (state.value.fEscaped || state.value.nMonitor != LifeCycle::flat)
         {
+        if (state.value.nMonitor == LifeCycle::flat &&
+            state.value.cMonitorThin != 0 &&
+            peekMonitorPointer(m_pCondition) == getThinMonitorOwner())
+            {
+            // waiting inflates the monitor, thus a thin monitor has no
+            // waiters to notify
+            return;
+            }
         _ensureMonitor().notify();
         return;
         }
@@ -344,6 +647,14 @@ void Object::notifyAll() const
     LifeCycle::State state = m_atomicLifeCycleState.peek();
     if (state.value.fEscaped || state.value.nMonitor != LifeCycle::flat)
         {
+        if (state.value.nMonitor == LifeCycle::flat &&
+            state.value.cMonitorThin != 0 &&
+            peekMonitorPointer(m_pCondition) == getThinMonitorOwner())
+            {
+            // waiting inflates the monitor, thus a thin monitor has no
+            // waiters to notify
+            return;
+            }
         _ensureMonitor().notifyAll();
         return;
         }
@@ -558,6 +869,15 @@ void Object::onEscape(bool fEscaped) const
 
     // flip the escaped bit
     state.value.fEscaped = fEscaped;
+    if (!fEscaped && state.value.cMonitorThin != 0)
+        {
+        // the capturing thread holds the thin monitor, the monitor pointer
+        // resumes acting as a nested sync count
+        m_pCondition = reinterpret_cast<NativeCondition*>(
+                (size_t) state.value.cMonitorThin);
+        state.value.cMonitorThin      = 0;
+        state.value.fMonitorContended = 0;
+        }
     m_atomicLifeCycleState.poke(state);
 
     if (fEscaped) // escape this object
@@ -798,11 +1118,13 @@ Object* Object::_attachEscaped(bool fEscaped)
             cHandleNew = LifeCycle::max_handles; // attempt to make it immortal
             }
 
-        // handle attachment is allowable
+        // handle attachment is allowable; the attaching thread already
+        // holds a reference and publishes nothing through the count, so
+        // acquire ordering suffices
         refsNew = refsAssumed = refsOld;
         refsNew.value.cHandle = cHandleNew;
 
-        refsOld = m_atomicLifeCycleRefs.update(refsAssumed, refsNew);
+        refsOld = m_atomicLifeCycleRefs.updateAcquire(refsAssumed, refsNew);
         }
     while (refsOld != refsAssumed);
 
@@ -959,11 +1281,12 @@ const Object* Object::_attachEscaped(bool fEscaped) const
             cViewNew = LifeCycle::max_views; // attempt to make it immortal
             }
 
-        // view attachment is allowable
+        // view attachment is allowable; acquire ordering suffices, see
+        // the non-const _attachEscaped
         refsNew = refsAssumed = refsOld;
         refsNew.value.cView   = cViewNew;
 
-        refsOld = m_atomicLifeCycleRefs.update(refsAssumed, refsNew);
+        refsOld = m_atomicLifeCycleRefs.updateAcquire(refsAssumed, refsNew);
         }
     while (refsOld != refsAssumed);
 
@@ -1269,7 +1592,10 @@ void Object::_destroy() const
     // typically be done in a destructor here.  Removing the destructors
     // demonstrated a ~20% performance gain in an object creation/destruction
     // test
-    delete m_pCondition;
+    if (state.value.nMonitor == LifeCycle::inflated)
+        {
+        delete m_pCondition;
+        }
     m_pCondition = NULL;
 
     WeakReference* pWeakThis = m_pWeakThis;
@@ -1351,6 +1677,40 @@ NativeCondition& Object::_ensureMonitor() const
         switch (stateOld.value.nMonitor)
             {
             case LifeCycle::flat:
+                if (stateOld.value.cMonitorThin != 0 &&
+                    peekMonitorPointer(m_pCondition) != getThinMonitorOwner())
+                    {
+                    // thin monitor is held by another thread
+                    if (stateOld.value.fMonitorContended)
+                        {
+                        // wait for it to be released or inflated
+                        NativeCondition& parker = getThinMonitorParker();
+                        parker.lock();
+                        try
+                            {
+                            stateOld = m_atomicLifeCycleState.get();
+                            if (stateOld == stateAssumed)
+                                {
+                                parker.wait((int32_t) System::getInterruptResolution());
+                                stateOld = m_atomicLifeCycleState.get();
+                                }
+                            }
+                        catch (...)
+                            {
+                            parker.unlock();
+                            throw;
+                            }
+                        parker.unlock();
+                        }
+                    else
+                        {
+                        // ask the owner to wake us upon release
+                        stateNew.value.fMonitorContended = 1;
+                        stateOld = m_atomicLifeCycleState.update(stateAssumed, stateNew);
+                        }
+                    break;
+                    }
+
                 // try to acquire allocation right
                 stateNew.value.nMonitor = LifeCycle::inflating;
                 stateOld = m_atomicLifeCycleState.update(stateAssumed, stateNew);
@@ -1361,7 +1721,21 @@ NativeCondition& Object::_ensureMonitor() const
 
                 // this is now the inflating thread
                 fInflator     = true;
-                m_pCondition  = NativeCondition::create();
+                if (stateNew.value.cMonitorThin == 0)
+                    {
+                    pokeMonitorPointer(m_pCondition, NativeCondition::create());
+                    }
+                else
+                    {
+                    // the calling thread holds the thin monitor; transfer
+                    // its holds to the condition
+                    NativeCondition* pCondition = NativeCondition::create();
+                    for (size32_t c = stateNew.value.cMonitorThin; c > 0; --c)
+                        {
+                        pCondition->lock();
+                        }
+                    pokeMonitorPointer(m_pCondition, pCondition);
+                    }
                 stateAssumed = stateNew;
                 // fall through
 
@@ -1369,8 +1743,16 @@ NativeCondition& Object::_ensureMonitor() const
                 if (fInflator)
                     {
                     // this is the inflating thread, move to the inflated state
-                    stateNew.value.nMonitor = LifeCycle::inflated;
+                    stateNew.value.nMonitor          = LifeCycle::inflated;
+                    stateNew.value.cMonitorThin      = 0;
+                    stateNew.value.fMonitorContended = 0;
                     stateOld = m_atomicLifeCycleState.update(stateAssumed, stateNew);
+                    if (stateOld == stateAssumed &&
+                        stateAssumed.value.fMonitorContended)
+                        {
+                        // wake threads waiting on the thin monitor
+                        notifyThinMonitorParker();
+                        }
                     }
                 else
                     {
@@ -1497,6 +1879,22 @@ TypedHandle<const String> Object::toString(Object::View v)
     return String::valueOf(v);
     }
 
+bool Object::_setThinMonitorEnabled(bool fThin)
+    {
+    NativeAtomic32& atomicThin = getThinMonitorFlag();
+    int32_t         nNew       = fThin ? 1 : 0;
+    int32_t         nOld       = atomicThin.peek();
+    while (true)
+        {
+        int32_t nActual = atomicThin.update(nOld, nNew);
+        if (nActual == nOld)
+            {
+            return nOld != 0;
+            }
+        nOld = nActual;
+        }
+    }
+
 // ----- memory management --------------------------------------------------
 
 void* Object::operator new(size_t cb)
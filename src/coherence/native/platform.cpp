@@ -8,8 +8,13 @@
 
 #if defined(COH_OS_DARWIN) && defined(COH_CC_GNU)
     #include "private/coherence/native/gcc/GccABI.hpp"
-    #include "private/coherence/native/gcc/GccAtomic32.hpp"
-    #include "private/coherence/native/gcc/GccAtomic64.hpp"
+    #if defined(__ATOMIC_ACQUIRE) // memory model aware builtins (GCC 4.7+)
+        #include "private/coherence/native/gcc/GccOrderedAtomic32.hpp"
+        #include "private/coherence/native/gcc/GccOrderedAtomic64.hpp"
+    #else
+        #include "private/coherence/native/gcc/GccAtomic32.hpp"
+        #include "private/coherence/native/gcc/GccAtomic64.hpp"
+    #endif
     #include "private/coherence/native/generic/GenericIEEE754Float.hpp"
     #include "private/coherence/native/glibc/GlibcBacktrace.hpp"
     #include "private/coherence/native/posix/PosixCondition.hpp"
@@ -25,8 +30,13 @@
     #include "private/coherence/native/posix/PosixUser.hpp"
 #elif defined(COH_OS_LINUX) && defined(COH_CC_GNU)
     #include "private/coherence/native/gcc/GccABI.hpp"
-    #include "private/coherence/native/gcc/GccAtomic32.hpp"
-    #include "private/coherence/native/gcc/GccAtomic64.hpp"
+    #if defined(__ATOMIC_ACQUIRE) // memory model aware builtins (GCC 4.7+)
+        #include "private/coherence/native/gcc/GccOrderedAtomic32.hpp"
+        #include "private/coherence/native/gcc/GccOrderedAtomic64.hpp"
+    #else
+        #include "private/coherence/native/gcc/GccAtomic32.hpp"
+        #include "private/coherence/native/gcc/GccAtomic64.hpp"
+    #endif
     #include "private/coherence/native/generic/GenericIEEE754Float.hpp"
     #include "private/coherence/native/glibc/GlibcBacktrace.hpp"
     #include "private/coherence/native/posix/PosixCondition.hpp"
@@ -12,6 +12,7 @@
 
 #include "private/coherence/net/Console.hpp"
 #include "private/coherence/run/xml/XmlHelper.hpp"
+#include "private/coherence/util/InvocableMapHelper.hpp"
 #include "private/coherence/util/logging/Logger.hpp"
 
 #include <fstream>
@@ -20,6 +21,7 @@ COH_OPEN_NAMESPACE2(coherence,net)
 
 using coherence::io::IOException;
 using coherence::run::xml::XmlHelper;
+using coherence::util::InvocableMapHelper;
 using coherence::util::logging::Logger;
 
 
@@ -154,7 +156,8 @@ class CacheFactoryImpl
         /**
         * System shutdown.
         *
-        * Shut down the ConfigurableCacheFactory and Logger
+        * Shut down the ConfigurableCacheFactory, the parallel query threads
+        * and the Logger
         */
         virtual void shutdown()
             {
@@ -167,6 +170,7 @@ class CacheFactoryImpl
                     {
                     hFactory->shutdown();
                     }
+                InvocableMapHelper::shutdownParallelQueries();
                 Logger::getLogger()->shutdown();
                 m_hCacheFactory = NULL;
                 }
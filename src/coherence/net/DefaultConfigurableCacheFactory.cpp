@@ -18,6 +18,8 @@
 #include "coherence/net/cache/NearCache.hpp"
 #include "coherence/net/cache/UnitCalculator.hpp"
 
+#include "coherence/util/ArrayList.hpp"
+#include "coherence/util/AtomicCounter.hpp"
 #include "coherence/util/Filter.hpp"
 #include "coherence/util/HashMap.hpp"
 #include "coherence/util/Iterator.hpp"
@@ -33,6 +35,7 @@
 #include "private/coherence/component/util/SafeInvocationService.hpp"
 #include "private/coherence/component/util/SafeService.hpp"
 
+#include "private/coherence/net/internal/CacheConfigIndex.hpp"
 #include "private/coherence/net/internal/ScopedReferenceStore.hpp"
 
 #include "private/coherence/net/cache/LocalNamedCache.hpp"
@@ -40,11 +43,14 @@
 #include "private/coherence/run/xml/SimpleElement.hpp"
 #include "private/coherence/run/xml/XmlHelper.hpp"
 
+#include "coherence/security/RunAsBlock.hpp"
+
 #include "private/coherence/security/SecurityHelper.hpp"
 
 #include "private/coherence/util/StringHelper.hpp"
 #include "private/coherence/util/logging/Logger.hpp"
 
+#include <algorithm>
 #include <fstream>
 
 COH_OPEN_NAMESPACE2(coherence,net)
@@ -61,10 +67,14 @@ using coherence::net::cache::EvictionPolicy;
 using coherence::net::cache::LocalNamedCache;
 using coherence::net::cache::UnitCalculator;
 using coherence::net::cache::NearCache;
+using coherence::net::internal::CacheConfigIndex;
 using coherence::net::internal::ScopedReferenceStore;
 using coherence::run::xml::SimpleElement;
 using coherence::run::xml::XmlHelper;
 using coherence::security::SecurityHelper;
+using coherence::security::auth::Subject;
+using coherence::util::ArrayList;
+using coherence::util::AtomicCounter;
 using coherence::util::Filter;
 using coherence::util::HashMap;
 using coherence::util::Iterator;
@@ -81,6 +91,20 @@ COH_REGISTER_TYPED_CLASS(DefaultConfigurableCacheFactory);
 
 COH_OPEN_NAMESPACE_ANON(DefaultConfigurableCacheFactory)
 
+/**
+* Return the CacheConfigIndex held by a factory.
+*
+* @param vIndex  the factory's f_vConfigIndex
+*
+* @return the CacheConfigIndex
+*
+* @since 15.1.1.0.0
+*/
+CacheConfigIndex::View getConfigIndex(Object::View vIndex)
+    {
+    return cast<CacheConfigIndex::View>(vIndex);
+    }
+
 /**
 * Obtain the name from the back cache currently associated
 * with the associated ContinuousQueryCache.
@@ -191,119 +215,185 @@ class ViewCacheSupplier
         FinalView<XmlElement> f_vXmlBackScheme;
     };
 
-COH_CLOSE_NAMESPACE_ANON
+/**
+* Runnable which configures a shared list of caches on behalf of
+* DefaultConfigurableCacheFactory::ensureCaches. Each thread running the
+* task repeatedly claims the next unprocessed cache until none remain.
+*
+* @since 15.1.1.0.0
+*/
+class EnsureCachesTask
+        : public class_spec<EnsureCachesTask,
+          extends<Object>,
+          implements<Runnable> >
+    {
+    friend class factory<EnsureCachesTask>;
 
-// ----- constructors -------------------------------------------------------
+    // ---- constructors ----------------------------------------------------
 
-DefaultConfigurableCacheFactory::DefaultConfigurableCacheFactory(
-        String::View vsFile)
-        : f_vContext(self()),
-          f_vXmlConfig(self()),
-          f_hStoreCache(self()),
-          f_hStoreService(self()),
-          f_hThreadGroup(self(), ThreadGroup::create(
-                  COH_TO_STRING("coherence - " << vsFile)))
-    {
-    if (NULL != vsFile)
-        {
-        setConfig(XmlHelper::loadFile(vsFile, "cache configuration"));
-        }
-    }
+    protected:
+        /**
+        * Create a new EnsureCachesTask.
+        *
+        * @param hCacheFactory  the factory to configure the caches with
+        * @param vaInfo         the CacheInfo of each cache
+        * @param vaXmlScheme    the resolved scheme of each cache
+        * @param hMapResult     the Map to add each configured cache to
+        * @param vSubject       the Subject to configure the caches as
+        */
+        EnsureCachesTask(DefaultConfigurableCacheFactory::Handle hCacheFactory,
+                ObjectArray::View vaInfo, ObjectArray::View vaXmlScheme,
+                Map::Handle hMapResult, Subject::View vSubject)
+                : f_hCacheFactory(self(), hCacheFactory),
+                  f_vaInfo(self(), vaInfo),
+                  f_vaXmlScheme(self(), vaXmlScheme),
+                  f_hMapResult(self(), hMapResult),
+                  f_hCounterNext(self(), AtomicCounter::create()),
+                  f_vSubject(self(), vSubject),
+                  m_veFailure(self())
+            {
+            }
 
-// ----- DefaultConfigurableCacheFactory interface --------------------------
+    private:
+        /**
+        * Blocked copy constructor.
+        */
+        EnsureCachesTask(const EnsureCachesTask&);
 
-DefaultConfigurableCacheFactory::CacheInfo::View
-    DefaultConfigurableCacheFactory::findSchemeMapping(
-        String::View vsCacheName)
-        {
-        XmlElement::View vXmlDefaultMatch = NULL;
-        XmlElement::View vXmlPrefixMatch  = NULL;
-        XmlElement::View vXmlExactMatch   = NULL;
-        String::View     vsSuffix;
+    // ----- Runnable interface ---------------------------------------------
 
-        for (Iterator::Handle hIter = f_vXmlConfig->getSafeElement
-                ("caching-scheme-mapping")->getElements("cache-mapping");
-                hIter->hasNext();)
+    public:
+        virtual void run()
             {
-            XmlElement::View vXmlMapping = cast<XmlElement::View>(hIter->next());
-
-            String::View vsName = vXmlMapping->getSafeElement("cache-name")->
-                    getString();
-            if (vsName->equals(vsCacheName))
+            // caches are scoped by Subject, so each worker configures them
+            // as the thread which called ensureCaches
+            COH_RUN_AS (f_vSubject)
                 {
-                vXmlExactMatch = vXmlMapping;
-                break;
+                ensureCaches();
                 }
-            else if (vsName->equals("*"))
+            }
+
+    // ----- EnsureCachesTask interface -------------------------------------
+
+    public:
+        /**
+        * Return the first Exception raised while configuring a cache.
+        *
+        * @return the first failure, or NULL if all caches were configured
+        */
+        Exception::View getFailure()
+            {
+            COH_SYNCHRONIZED (this)
                 {
-                vXmlDefaultMatch = vXmlMapping;
+                return m_veFailure;
                 }
-            else
+            }
+
+    protected:
+        /**
+        * Configure caches until none are left.
+        */
+        void ensureCaches()
+            {
+            ObjectArray::View vaInfo      = f_vaInfo;
+            ObjectArray::View vaXmlScheme = f_vaXmlScheme;
+            size32_t          cCaches     = vaInfo->length;
+
+            for (size32_t i = (size32_t) f_hCounterNext->postIncrement(); i < cCaches;
+                    i = (size32_t) f_hCounterNext->postIncrement())
                 {
-                size32_t cchPrefix = vsName->indexOf('*');
-                if (cchPrefix != String::npos)
+                DefaultConfigurableCacheFactory::CacheInfo::View vInfo =
+                    cast<DefaultConfigurableCacheFactory::CacheInfo::View>(vaInfo[i]);
+                try
                     {
-                    String::View vsPrefix = vsName->substring(0, cchPrefix);
-                    if (vsCacheName->startsWith(vsPrefix))
+                    int64_t            ldtStart = System::currentTimeMillis();
+                    NamedCache::Handle hCache   = f_hCacheFactory->
+                        ensureConfiguredCache(vInfo,
+                                cast<XmlElement::View>(vaXmlScheme[i]));
+
+                    f_hMapResult->put(vInfo->getCacheName(), hCache);
+                    COH_LOG("Ensured cache \"" << vInfo->getCacheName()
+                            << "\" in " << (System::currentTimeMillis() - ldtStart)
+                            << "ms", 6);
+                    }
+                catch (Exception::View e)
+                    {
+                    COH_SYNCHRONIZED (this)
                         {
-                        if (cchPrefix != vsName->length() - 1)
+                        if (NULL == m_veFailure)
                             {
-                            COH_THROW_STREAM (IllegalArgumentException,
-                                "Invalid wildcard pattern:\n" << vXmlMapping);
+                            m_veFailure = e;
                             }
-                        vXmlPrefixMatch = vXmlMapping;
-                        vsSuffix        = vsCacheName->substring(cchPrefix);
                         }
                     }
                 }
             }
 
-        XmlElement::View vXmlMatch;
+    // ----- data members ---------------------------------------------------
 
-        if (NULL != vXmlExactMatch)
+    protected:
+        FinalHandle<DefaultConfigurableCacheFactory> f_hCacheFactory;
+        FinalView<ObjectArray> f_vaInfo;
+        FinalView<ObjectArray> f_vaXmlScheme;
+        FinalHandle<Map> f_hMapResult;
+        FinalHandle<AtomicCounter> f_hCounterNext;
+        FinalView<Subject> f_vSubject;
+        MemberView<Exception> m_veFailure;
+    };
+
+/**
+* Return the default number of threads used by ensureCaches(), as specified
+* by the coherence.cachefactory.ensure.parallel system property, or 8 if
+* the property is not set or is not a valid number.
+*/
+int32_t getDefaultEnsureCacheParallelism()
+    {
+    String::View vsThreads = System::getProperty(
+            "coherence.cachefactory.ensure.parallel");
+    if (NULL != vsThreads)
+        {
+        try
             {
-            vXmlMatch = vXmlExactMatch;
-            vsSuffix  = StringHelper::getEmptyString();
+            return Integer32::parse(vsThreads->trim());
             }
-        else if (NULL != vXmlPrefixMatch)
+        catch (Exception::View)
             {
-            vXmlMatch = vXmlPrefixMatch;
-            }
-        else
-            {
-            vXmlMatch = vXmlDefaultMatch;
-            vsSuffix  = vsCacheName;
+            COH_LOG("Ignoring invalid coherence.cachefactory.ensure.parallel value \""
+                    << vsThreads << "\"", Logger::level_warning);
             }
+        }
+    return 8;
+    }
 
-        if (NULL == vXmlMatch)
-            {
-            COH_THROW_STREAM (IllegalArgumentException,
-                    "No scheme for cache: \"" << vsCacheName << '"');
-            }
+COH_CLOSE_NAMESPACE_ANON
 
-        String::View vsScheme = vXmlMatch->getSafeElement("scheme-name")->getString();
-        Map::Handle  hMapAttr = HashMap::create();
-        for (Iterator::Handle hIter = vXmlMatch->getSafeElement("init-params")->
-                getElements("init-param"); hIter->hasNext();)
-            {
-            XmlElement::View vXmlParam = cast<XmlElement::View>(hIter->next());
-            String::View     vsName    = vXmlParam->getSafeElement("param-name" )->getString();
-            String::View     vsValue   = vXmlParam->getSafeElement("param-value")->getString();
+// ----- constructors -------------------------------------------------------
 
-            if (vsName->length() != 0)
-                {
-                size32_t ofReplace = vsValue->indexOf('*');
-                if (ofReplace != String::npos && vsSuffix != NULL)
-                    {
-                    vsValue = COH_TO_STRING(
-                            vsValue->substring(0, ofReplace) <<
-                            vsSuffix << vsValue->substring(ofReplace + 1));
-                    }
-                hMapAttr->put(vsName, vsValue);
-                }
-            }
+DefaultConfigurableCacheFactory::DefaultConfigurableCacheFactory(
+        String::View vsFile)
+        : f_vContext(self()),
+          f_vXmlConfig(self()),
+          f_vConfigIndex(self()),
+          f_hStoreCache(self()),
+          f_hStoreService(self()),
+          f_hThreadGroup(self(), ThreadGroup::create(
+                  COH_TO_STRING("coherence - " << vsFile))),
+          m_cEnsureCacheParallelism(getDefaultEnsureCacheParallelism()),
+          f_hMapPendingCache(self(), SafeHashMap::create())
+    {
+    if (NULL != vsFile)
+        {
+        setConfig(XmlHelper::loadFile(vsFile, "cache configuration"));
+        }
+    }
+
+// ----- DefaultConfigurableCacheFactory interface --------------------------
 
-        return CacheInfo::create(vsCacheName, vsScheme, hMapAttr);
+DefaultConfigurableCacheFactory::CacheInfo::View
+    DefaultConfigurableCacheFactory::findSchemeMapping(
+        String::View vsCacheName)
+        {
+        return getConfigIndex(f_vConfigIndex)->findSchemeMapping(vsCacheName);
         }
 
 XmlElement::View DefaultConfigurableCacheFactory::
@@ -360,6 +450,16 @@ void DefaultConfigurableCacheFactory::setOperationalContext(
     initialize(f_vContext, vContext);
     }
 
+int32_t DefaultConfigurableCacheFactory::getEnsureCacheParallelism() const
+    {
+    return m_cEnsureCacheParallelism;
+    }
+
+void DefaultConfigurableCacheFactory::setEnsureCacheParallelism(int32_t cThreads)
+    {
+    m_cEnsureCacheParallelism = cThreads;
+    }
+
 XmlDocument::Handle DefaultConfigurableCacheFactory::getDefaultCacheConfig()
     {
     // Support the Coherence system property being either "coherence.cacheconfig" or "coherence.cache.config".
@@ -547,15 +647,10 @@ XmlElement::Handle DefaultConfigurableCacheFactory::
     {
     if (NULL != vsSchemeName)
         {
-        for (Iterator::Handle hIter = f_vXmlConfig->getSafeElement("caching-schemes")->
-                getElementList()->iterator(); hIter->hasNext();)
+        XmlElement::View vXml = getConfigIndex(f_vConfigIndex)->findScheme(vsSchemeName);
+        if (NULL != vXml)
             {
-            XmlElement::View vXml = cast<XmlElement::View>(hIter->next());
-
-            if (vXml->getSafeElement("scheme-name")->getString()->equals(vsSchemeName))
-                {
-                return cast<XmlElement::Handle>(vXml->clone());
-                }
+            return cast<XmlElement::Handle>(vXml->clone());
             }
         }
 
@@ -568,15 +663,10 @@ XmlElement::Handle DefaultConfigurableCacheFactory::
     {
     if (NULL != vsServiceName)
         {
-        for (Iterator::Handle hIter = f_vXmlConfig->getSafeElement("caching-schemes")->
-                getElementList()->iterator(); hIter->hasNext();)
+        XmlElement::View vXml = getConfigIndex(f_vConfigIndex)->findServiceScheme(vsServiceName);
+        if (NULL != vXml)
             {
-            XmlElement::View vXml = cast<XmlElement::View>(hIter->next());
-
-            if (vXml->getSafeElement("service-name")->getString()->equals(vsServiceName))
-                {
-                return cast<XmlElement::Handle>(vXml->clone());
-                }
+            return cast<XmlElement::Handle>(vXml->clone());
             }
         }
 
@@ -630,6 +720,156 @@ DefaultConfigurableCacheFactory::configureCache
     return hCache;
     }
 
+Map::View DefaultConfigurableCacheFactory::ensureCaches(
+        Collection::View vColCacheNames)
+    {
+    COH_ENSURE_PARAM(vColCacheNames);
+
+    ScopedReferenceStore::Handle hStoreCache =
+            cast<ScopedReferenceStore::Handle>(ensureStoreCache());
+    Map::Handle                  hMapResult  = SafeHashMap::create();
+    List::Handle                 hListInfo   = ArrayList::create();
+    List::Handle                 hListScheme = ArrayList::create();
+
+    // resolve the schemes of the inactive caches before configuring any
+    for (Iterator::Handle hIter = vColCacheNames->iterator(); hIter->hasNext(); )
+        {
+        String::View vsCacheName = cast<String::View>(hIter->next());
+        COH_ENSURE_PARAM(vsCacheName);
+
+        if (hMapResult->containsKey(vsCacheName))
+            {
+            continue;
+            }
+
+        NamedCache::Handle hCache = hStoreCache->getCache(vsCacheName);
+        if (NULL == hCache || !hCache->isActive())
+            {
+            CacheInfo::View vInfoCache = findSchemeMapping(vsCacheName);
+            hListInfo->add(vInfoCache);
+            hListScheme->add(resolveScheme(vInfoCache));
+            hCache = NULL;
+            }
+        hMapResult->put(vsCacheName, hCache);
+        }
+
+    size32_t cCaches = hListInfo->size();
+    if (cCaches == 0)
+        {
+        return hMapResult;
+        }
+
+    EnsureCachesTask::Handle hTask = EnsureCachesTask::create(this,
+            hListInfo->toArray(), hListScheme->toArray(), hMapResult,
+            SecurityHelper::getCurrentSubject());
+
+    // the calling thread is one of the workers
+    size32_t cThreads = (size32_t) std::max(getEnsureCacheParallelism(), 1);
+    size32_t cHelpers = std::min(cThreads, cCaches) - 1;
+
+    ObjectArray::Handle haThread = ObjectArray::create(cHelpers);
+    for (size32_t i = 0; i < cHelpers; ++i)
+        {
+        Thread::Handle hThread = Thread::create(hTask,
+                "DefaultConfigurableCacheFactory:EnsureCaches");
+        haThread[i] = hThread;
+        hThread->start();
+        }
+
+    hTask->run();
+
+    for (size32_t i = 0; i < cHelpers; ++i)
+        {
+        cast<Thread::Handle>(haThread[i])->join();
+        }
+
+    Exception::View vFailure = hTask->getFailure();
+    if (NULL != vFailure)
+        {
+        COH_THROW (vFailure);
+        }
+    return hMapResult;
+    }
+
+NamedCache::Handle DefaultConfigurableCacheFactory::ensureConfiguredCache(
+        CacheInfo::View vInfo, XmlElement::View vXmlScheme)
+    {
+    String::View                 vsCacheName = vInfo->getCacheName();
+    ScopedReferenceStore::Handle hStoreCache =
+            cast<ScopedReferenceStore::Handle>(ensureStoreCache());
+    Map::Handle                  hMapPending = f_hMapPendingCache;
+
+    while (true)
+        {
+        Object::Handle hPending;
+        bool           fOwner = false;
+        COH_SYNCHRONIZED (hStoreCache)
+            {
+            NamedCache::Handle hCache = hStoreCache->getCache(vsCacheName);
+            if (NULL != hCache && hCache->isActive())
+                {
+                return hCache;
+                }
+
+            hPending = cast<Object::Handle>(hMapPending->get(vsCacheName));
+            if (NULL == hPending)
+                {
+                hPending = Object::create();
+                hMapPending->put(vsCacheName, hPending);
+                fOwner   = true;
+                }
+            }
+
+        if (!fOwner)
+            {
+            // another thread is configuring the cache; wait for it to finish
+            // and then look again, as it may have failed
+            COH_SYNCHRONIZED (hPending)
+                {
+                while (hMapPending->get(vsCacheName) == hPending)
+                    {
+                    hPending->wait();
+                    }
+                }
+            continue;
+            }
+
+        // configure outside of the store's monitor so that the round trips
+        // of callers ensuring different caches overlap; callers ensuring the
+        // same cache wait above, as a cache configured in vain could not be
+        // released without also releasing any back cache it shares with the
+        // registered one
+        NamedCache::Handle hCache;
+        try
+            {
+            hCache = configureCache(vInfo, vXmlScheme);
+            COH_SYNCHRONIZED (hStoreCache)
+                {
+                hStoreCache->putCache(hCache);
+                hMapPending->remove(vsCacheName);
+                }
+            }
+        catch (...)
+            {
+            COH_SYNCHRONIZED (hStoreCache)
+                {
+                hMapPending->remove(vsCacheName);
+                }
+            COH_SYNCHRONIZED (hPending)
+                {
+                hPending->notifyAll();
+                }
+            throw;
+            }
+
+        COH_SYNCHRONIZED (hPending)
+            {
+            hPending->notifyAll();
+            }
+        return hCache;
+        }
+    }
+
 void DefaultConfigurableCacheFactory::releaseCache(NamedCache::Handle hCache,
         bool fDestroy)
     {
@@ -1108,6 +1348,10 @@ BundlingNamedCache::Handle DefaultConfigurableCacheFactory::instantiateBundlingN
             {
             initializeBundler(hCacheBundle->ensureRemoveBundler(cBundle), vXmlBundle);
             }
+        else if (vsOperation->equals("invoke"))
+            {
+            initializeBundler(hCacheBundle->ensureInvokeBundler(cBundle), vXmlBundle);
+            }
         else
             {
             COH_THROW_STREAM(IllegalArgumentException,
@@ -1312,18 +1556,9 @@ DefaultConfigurableCacheFactory::ensureCache(String::View vsCacheName)
 
     if (NULL == hCache || !hCache->isActive())
         {
-        CacheInfo::View  vInfoCache = findSchemeMapping(vsCacheName);
-        XmlElement::View vXmlScheme = resolveScheme(vInfoCache);
+        CacheInfo::View vInfoCache = findSchemeMapping(vsCacheName);
 
-        COH_SYNCHRONIZED (hStoreCache)
-            {
-            hCache = hStoreCache->getCache(vsCacheName);
-            if (NULL == hCache || !hCache->isActive())
-                {
-                hCache = configureCache(vInfoCache, vXmlScheme);
-                hStoreCache->putCache(hCache);
-                }
-            }
+        hCache = ensureConfiguredCache(vInfoCache, resolveScheme(vInfoCache));
         }
     return hCache;
     }
@@ -1414,6 +1649,10 @@ void DefaultConfigurableCacheFactory::setConfig(XmlElement::View vXml)
         }
 
     initialize(f_vXmlConfig, vXml);
+    if (NULL != vXml)
+        {
+        initialize(f_vConfigIndex, CacheConfigIndex::create(vXml));
+        }
     }
 
 // ----- nested class: CacheInfo --------------------------------------------
@@ -8,6 +8,8 @@
 
 #include "coherence/util/Random.hpp"
 
+#include "private/coherence/native/NativeTime.hpp"
+
 #include <algorithm>
 #include <cmath>
 
@@ -15,6 +17,7 @@ COH_OPEN_NAMESPACE3(coherence,net,cache)
 
 using namespace std;
 
+using coherence::native::NativeTime;
 using coherence::util::Random;
 
 AbstractBundler::AbstractBundler()
@@ -22,10 +25,13 @@ AbstractBundler::AbstractBundler()
       m_dPreviousSizeThreshold(0.0),
       f_hListBundle(self(), ArrayList::create()),
       f_hCountThreads(self(), AtomicCounter::create()),
+      f_hCountInFlight(self(), AtomicCounter::create()),
       m_dSizeThreshold(0.0),
       m_cThreadThreshold(0),
       m_fAllowAuto(true),
-      m_lDelayMillis(1L),
+      m_lDelayMicros(1000L),
+      m_fFlushOnIdle(Boolean::parse(System::getProperty(
+              "coherence.bundler.flush.idle", "false"))),
       m_iActiveBundle(self()),
       f_hStats(self(), AbstractBundler::Statistics::create())
     {
@@ -73,7 +79,7 @@ void AbstractBundler::setThreadThreshold(int32_t cThreads)
 
 int64_t AbstractBundler::getDelayMillis() const
     {
-    return m_lDelayMillis;
+    return (m_lDelayMicros + 999L) / 1000L;
     }
 
 void AbstractBundler::setDelayMillis(int64_t lDelay)
@@ -82,7 +88,21 @@ void AbstractBundler::setDelayMillis(int64_t lDelay)
         {
         COH_THROW(IllegalArgumentException::create("Invalid delay value"));
         }
-    m_lDelayMillis = lDelay;
+    m_lDelayMicros = lDelay * 1000L;
+    }
+
+int64_t AbstractBundler::getDelayMicros() const
+    {
+    return m_lDelayMicros;
+    }
+
+void AbstractBundler::setDelayMicros(int64_t lDelay)
+    {
+    if (lDelay <= 0)
+        {
+        COH_THROW(IllegalArgumentException::create("Invalid delay value"));
+        }
+    m_lDelayMicros = lDelay;
     }
 
 bool AbstractBundler::isAllowAutoAdjust() const
@@ -95,6 +115,21 @@ void AbstractBundler::setAllowAutoAdjust(bool fAutoAdjust)
     m_fAllowAuto = fAutoAdjust;
     }
 
+bool AbstractBundler::isFlushOnIdle() const
+    {
+    return m_fFlushOnIdle;
+    }
+
+void AbstractBundler::setFlushOnIdle(bool fFlush)
+    {
+    m_fFlushOnIdle = fFlush;
+    }
+
+int64_t AbstractBundler::getInFlightCount() const
+    {
+    return f_hCountInFlight->getCount();
+    }
+
 // ----- statistics ---------------------------------------------------------
 
 void AbstractBundler::updateStatistics()
@@ -246,8 +281,9 @@ TypedHandle<const String> AbstractBundler::toString() const
     return COH_TO_STRING(Class::getClassName(this)
          << "{SizeThreshold="    << getSizeThreshold()
          << ", ThreadThreshold=" << getThreadThreshold()
-         << ", DelayMillis="     << getDelayMillis()
+         << ", DelayMicros="     << getDelayMicros()
          << ", AutoAdjust="      << (isAllowAutoAdjust() ? "on" : "off")
+         << ", FlushOnIdle="     << (isFlushOnIdle() ? "on" : "off")
          << ", ActiveBundles="   << f_hListBundle->size()
          << ", Statistics="      << f_hStats
          << "}");
@@ -311,6 +347,34 @@ AbstractBundler::Bundle::Handle AbstractBundler::getOpenBundle()
         }
     }
 
+void AbstractBundler::onBurstComplete()
+    {
+    // a whole millisecond delay is honoured by the monitor timer alone
+    if (!isFlushOnIdle() && getDelayMicros() % 1000L == 0)
+        {
+        return;
+        }
+
+    ObjectArray::Handle haBundle;
+    List::Handle        hListBundle = f_hListBundle;
+    COH_SYNCHRONIZED (hListBundle)
+        {
+        haBundle = hListBundle->toArray();
+        }
+
+    for (size32_t i = 0, c = haBundle->length; i < c; i++)
+        {
+        Bundle::Handle hBundle = cast<Bundle::Handle>(haBundle[i]);
+        if (hBundle->isOpen())
+            {
+            COH_SYNCHRONIZED (hBundle)
+                {
+                hBundle->notifyAll();
+                }
+            }
+        }
+    }
+
 // ----- inner class Bundle -------------------------------------------------
 
 AbstractBundler::Bundle::Bundle(AbstractBundler::Handle hBundler)
@@ -321,6 +385,7 @@ AbstractBundler::Bundle::Bundle(AbstractBundler::Handle hBundler)
       m_cTotalBundles(self()),
       m_cTotalSize(self()),
       m_ldtStart(0L),
+      m_ldtDeadlineMicros(0L),
       m_cTotalBurstDuration(self()),
       m_cTotalWaitDuration(self())
     {
@@ -417,26 +482,44 @@ bool AbstractBundler::Bundle::waitForResults(bool fFirst)
     m_cThreads++;
     try
         {
+        AbstractBundler::Handle hBundler = getBundler();
+        NativeTime*             pTime    = NativeTime::instance();
         if (fFirst)
             {
-            m_ldtStart = System::currentTimeMillis();
+            m_ldtStart          = System::currentTimeMillis();
+            m_ldtDeadlineMicros = pTime->currentTimeMicros() + hBundler->getDelayMicros();
             }
 
-        AbstractBundler::Handle hBundler = getBundler();
-        if (getBundleSize() < hBundler->getSizeThreshold())
+        // a thread entering a bundle whose delay has already expired
+        // executes it right away
+        if (getBundleSize() < hBundler->getSizeThreshold() &&
+                (fFirst || pTime->currentTimeMicros() < m_ldtDeadlineMicros))
             {
             if (fFirst)
                 {
-                int64_t lDelay = hBundler->getDelayMillis();
-                do
+                // with flush-on-idle keep collecting only while another
+                // bundle is in flight
+                bool fIdle = hBundler->isFlushOnIdle();
+                while (isOpen() && getBundleSize() < hBundler->getSizeThreshold() &&
+                        !(fIdle && hBundler->getInFlightCount() == 0))
                     {
-                    wait(lDelay);
+                    int64_t cRemain = m_ldtDeadlineMicros - pTime->currentTimeMicros();
+                    if (cRemain <= 0)
+                        {
+                        break;
+                        }
+                    // the monitor timer has a millisecond resolution; a
+                    // shorter remainder is cut short by threads entering the
+                    // bundle and by completing bursts (see onBurstComplete)
+                    wait(std::max((int64_t) 1L, cRemain / 1000L));
+                    }
 
-                    // if someone has already "submitted" the bundle
-                    // need to keep waiting
-                    lDelay = 0L;
+                // if someone has already "submitted" the bundle
+                // need to keep waiting
+                while (isPending())
+                    {
+                    wait();
                     }
-                while (isPending());
                 }
             else
                 {
@@ -503,6 +586,8 @@ bool AbstractBundler::Bundle::ensureResults(bool fBurst)
         {
         // bundle is closed and ready for the actual execution (burst);
         // it must be performed without holding any synchronization
+        AbstractBundler::Handle hBundler = getBundler();
+        hBundler->f_hCountInFlight->increment();
         try
             {
             int64_t ldtStart = System::currentTimeMillis();
@@ -520,8 +605,12 @@ bool AbstractBundler::Bundle::ensureResults(bool fBurst)
         catch (Exception::View vEx)
             {
             setStatus(status_exception);
+            hBundler->f_hCountInFlight->decrement();
+            hBundler->onBurstComplete();
             return false;
             }
+        hBundler->f_hCountInFlight->decrement();
+        hBundler->onBurstComplete();
         }
     else
         {
@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) 2000, 2026, Oracle and/or its affiliates.
+ *
+ * Licensed under the Universal Permissive License v 1.0 as shown at
+ * http://oss.oracle.com/licenses/upl.
+ */
+#include "coherence/net/cache/AbstractInvokeBundler.hpp"
+
+#include "coherence/util/Collections.hpp"
+#include "coherence/util/HashMap.hpp"
+#include "coherence/util/HashSet.hpp"
+#include "coherence/util/Iterator.hpp"
+#include "coherence/util/Set.hpp"
+
+#include <algorithm>
+
+COH_OPEN_NAMESPACE3(coherence,net,cache)
+
+using coherence::util::Collections;
+using coherence::util::HashMap;
+using coherence::util::HashSet;
+using coherence::util::Iterator;
+using coherence::util::Set;
+
+typedef InvocableMap::EntryProcessor EntryProcessor;
+
+COH_OPEN_NAMESPACE_ANON(AbstractInvokeBundler)
+
+/**
+* Perform the un-bundled operation for the given keys, using the single key
+* operation if there is only one key.
+*/
+Map::View invokeDirect(AbstractInvokeBundler::Handle hBundler,
+        Collection::View vColKeys, EntryProcessor::Handle hAgent)
+    {
+    if (vColKeys->size() == 1)
+        {
+        Object::View vKey = vColKeys->iterator()->next();
+        return Collections::singletonMap(vKey, hBundler->unbundle(vKey, hAgent));
+        }
+    return hBundler->bundle(vColKeys, hAgent);
+    }
+
+COH_CLOSE_NAMESPACE_ANON
+
+AbstractInvokeBundler::AbstractInvokeBundler()
+    {
+    }
+
+Object::Holder AbstractInvokeBundler::process(Object::View vKey,
+        EntryProcessor::Handle hAgent)
+    {
+    return processAll(Collections::singleton(vKey), hAgent)->get(vKey);
+    }
+
+Map::View AbstractInvokeBundler::processAll(Collection::View vColKeys,
+        EntryProcessor::Handle hAgent)
+    {
+    int64_t cThreads = f_hCountThreads->increment();
+
+        // Finally block
+        {
+        struct ProcessAllFinally
+            {
+            ProcessAllFinally (Handle h)
+                : hThis(h)
+                {
+                }
+            ~ProcessAllFinally()
+                {
+                hThis->f_hCountThreads->decrement();
+                }
+
+            Handle hThis;
+            } finally(this);
+
+        if (cThreads < getThreadThreshold())
+            {
+            return invokeDirect(this, vColKeys, hAgent);
+            }
+
+        Bundle::Handle hBundle;
+        bool           fBurst  = false;
+        bool           fDirect = false;
+        while (true)
+            {
+            hBundle = cast<Bundle::Handle>(getOpenBundle());
+            COH_SYNCHRONIZED (hBundle)
+                {
+                if (hBundle->isOpen())
+                    {
+                    if (hBundle->containsAny(vColKeys, hAgent))
+                        {
+                        // the EntryProcessor must be executed once per
+                        // request against each entry
+                        fDirect = true;
+                        break;
+                        }
+
+                    bool fFirst = hBundle->addAll(vColKeys, hAgent);
+
+                    fBurst = hBundle->waitForResults(fFirst);
+                    break;
+                    }
+                }
+            }
+
+        return fDirect
+                ? invokeDirect(this, vColKeys, hAgent)
+                : hBundle->processAll(fBurst, vColKeys, hAgent);
+        }
+    }
+
+AbstractBundler::Bundle::Handle AbstractInvokeBundler::instantiateBundle()
+    {
+    return Bundle::create(this);
+    }
+
+
+// ----- inner classes ------------------------------------------------------
+
+AbstractInvokeBundler::Bundle::Bundle(AbstractBundler::Handle hBundler)
+    : super(hBundler),
+      f_hMapKeys(self(), HashMap::create()),
+      f_hMapAgents(self(), HashMap::create()),
+      f_hMapResults(self(), HashMap::create()),
+      m_cKeys(0)
+    {
+    }
+
+// ----- bundling support ---------------------------------------------------
+
+bool AbstractInvokeBundler::Bundle::containsAny(Collection::View vColKeys,
+        EntryProcessor::View vAgent) const
+    {
+    Set::View vSetKeys = cast<Set::View>(f_hMapKeys->get(vAgent));
+    if (vSetKeys != NULL)
+        {
+        for (Iterator::Handle hIter = vColKeys->iterator(); hIter->hasNext(); )
+            {
+            if (vSetKeys->contains(hIter->next()))
+                {
+                return true;
+                }
+            }
+        }
+    return false;
+    }
+
+bool AbstractInvokeBundler::Bundle::addAll(Collection::View vColKeys,
+        EntryProcessor::Handle hAgent)
+    {
+    bool        fFirst   = m_cKeys == 0;
+    Set::Handle hSetKeys = cast<Set::Handle>(f_hMapKeys->get(hAgent));
+    if (hSetKeys == NULL)
+        {
+        hSetKeys = HashSet::create();
+        f_hMapKeys->put(hAgent, hSetKeys);
+        f_hMapAgents->put(hAgent, hAgent);
+        }
+    int32_t cPrev = hSetKeys->size();
+    hSetKeys->addAll(vColKeys);
+    m_cKeys += hSetKeys->size() - cPrev;
+    return fFirst;
+    }
+
+Map::View AbstractInvokeBundler::Bundle::processAll(bool fBurst,
+        Collection::View vColKeys, EntryProcessor::Handle hAgent)
+    {
+    struct ProcessAllFinally
+        {
+        ProcessAllFinally (Handle h)
+            : hThis(h)
+            {
+            }
+        ~ProcessAllFinally()
+            {
+            hThis->releaseThread();
+            }
+
+        Handle hThis;
+        } finally(this);
+
+    if (ensureResults(fBurst))
+        {
+        Object::Holder ohResult = f_hMapResults->get(hAgent);
+        if (instanceof<Exception::View>(ohResult))
+            {
+            COH_THROW (cast<Exception::View>(ohResult));
+            }
+
+        Map::View   vMapResults = cast<Map::View>(ohResult);
+        Map::Handle hMap        = HashMap::create(vColKeys->size());
+        for (Iterator::Handle hIter = vColKeys->iterator(); hIter->hasNext(); )
+            {
+            Object::View vKey = hIter->next();
+            if (vMapResults != NULL && vMapResults->containsKey(vKey))
+                {
+                hMap->put(vKey, vMapResults->get(vKey));
+                }
+            }
+        return hMap;
+        }
+    else
+        {
+        return cast<AbstractInvokeBundler::Handle>(getBundler())->bundle(vColKeys, hAgent);
+        }
+    }
+
+int32_t AbstractInvokeBundler::Bundle::getBundleSize() const
+    {
+    return std::max(super::getBundleSize(), m_cKeys);
+    }
+
+void AbstractInvokeBundler::Bundle::ensureResults()
+    {
+    AbstractInvokeBundler::Handle hBundler =
+            cast<AbstractInvokeBundler::Handle>(getBundler());
+
+    // each group is invoked separately; a failure of one group is reported
+    // to its own requests only
+    for (Iterator::Handle hIter = f_hMapAgents->values()->iterator(); hIter->hasNext(); )
+        {
+        EntryProcessor::Handle hAgent   = cast<EntryProcessor::Handle>(hIter->next());
+        Set::View              vSetKeys = cast<Set::View>(f_hMapKeys->get(hAgent));
+        try
+            {
+            f_hMapResults->put(hAgent, hBundler->bundle(vSetKeys, hAgent));
+            }
+        catch (Exception::View e)
+            {
+            f_hMapResults->put(hAgent, e);
+            }
+        }
+    }
+
+bool AbstractInvokeBundler::Bundle::releaseThread()
+    {
+    COH_SYNCHRONIZED(this)
+        {
+        bool fRelease = super::releaseThread();
+        if (fRelease)
+            {
+            f_hMapKeys->clear();
+            f_hMapAgents->clear();
+            f_hMapResults->clear();
+            m_cKeys = 0;
+            }
+        return fRelease;
+        }
+    }
+
+COH_CLOSE_NAMESPACE3
@@ -10,7 +10,8 @@ COH_OPEN_NAMESPACE3(coherence,net,cache)
 
 BundlingNamedCache::BundlingNamedCache(NamedCache::Handle hCache)
     : super(hCache), m_hGetBundler(self()),
-      m_hPutBundler(self()), m_hRemoveBundler(self())
+      m_hPutBundler(self()), m_hRemoveBundler(self()),
+      m_hInvokeBundler(self())
     {
     }
 
@@ -79,6 +80,27 @@ AbstractBundler::Handle BundlingNamedCache::ensureRemoveBundler(int32_t cBundleT
         }
     }
 
+AbstractBundler::Handle BundlingNamedCache::ensureInvokeBundler(int32_t cBundleThreshold)
+    {
+    COH_SYNCHRONIZED(this)
+        {
+        if (cBundleThreshold > 0)
+            {
+            InvokeBundler::Handle hBundler = m_hInvokeBundler;
+            if (hBundler == NULL)
+                {
+                m_hInvokeBundler = hBundler = InvokeBundler::create(this);
+                }
+            hBundler->setSizeThreshold(cBundleThreshold);
+            return hBundler;
+            }
+        else
+            {
+            return m_hInvokeBundler = NULL;
+            }
+        }
+    }
+
 // ----- accessors ----------------------------------------------------------
 
 AbstractBundler::Handle BundlingNamedCache::getGetBundler()
@@ -96,6 +118,11 @@ AbstractBundler::Handle BundlingNamedCache::getRemoveBundler()
     return m_hRemoveBundler;
     }
 
+AbstractBundler::Handle BundlingNamedCache::getInvokeBundler()
+    {
+    return m_hInvokeBundler;
+    }
+
 // ----- various bundleable NamedCache methods ------------------------------
 
 Object::Holder BundlingNamedCache::get(Object::View vKey)
@@ -153,6 +180,22 @@ Object::Holder BundlingNamedCache::remove(Object::View vKey)
     return NULL;
     }
 
+Object::Holder BundlingNamedCache::invoke(Object::View vKey,
+        InvocableMap::EntryProcessor::Handle hAgent)
+    {
+    InvokeBundler::Handle hBundler = m_hInvokeBundler;
+    return hBundler == NULL ?
+            super::invoke(vKey, hAgent) : hBundler->process(vKey, hAgent);
+    }
+
+Map::View BundlingNamedCache::invokeAll(Collection::View vCollKeys,
+        InvocableMap::EntryProcessor::Handle hAgent)
+    {
+    InvokeBundler::Handle hBundler = m_hInvokeBundler;
+    return hBundler == NULL ?
+            super::invokeAll(vCollKeys, hAgent) : hBundler->processAll(vCollKeys, hAgent);
+    }
+
 // ----- NamedCache interface -----------------------------------------------
 
 void BundlingNamedCache::release()
@@ -161,6 +204,7 @@ void BundlingNamedCache::release()
     m_hGetBundler = NULL;
     m_hPutBundler = NULL;
     m_hRemoveBundler = NULL;
+    m_hInvokeBundler = NULL;
     }
 
 void BundlingNamedCache::destroy()
@@ -169,6 +213,7 @@ void BundlingNamedCache::destroy()
     m_hGetBundler = NULL;
     m_hPutBundler = NULL;
     m_hRemoveBundler = NULL;
+    m_hInvokeBundler = NULL;
     }
 
 // ----- inner classes --------------------------------------------------
@@ -256,4 +301,33 @@ BundlingNamedCache::View BundlingNamedCache::RemoveBundler::getBundlingNamedCach
     return f_hBundlingNamedCache;
     }
 
+BundlingNamedCache::InvokeBundler::InvokeBundler(BundlingNamedCache::Handle hBundlingNamedCache)
+    : f_hBundlingNamedCache(self(), hBundlingNamedCache)
+    {
+    AbstractBundler::Bundle::Handle hBundle = instantiateBundle();
+    init(hBundle);
+    }
+
+Map::View BundlingNamedCache::InvokeBundler::bundle(Collection::View vColKeys,
+        InvocableMap::EntryProcessor::Handle hAgent)
+    {
+    return getBundlingNamedCache()->BundlingNamedCache::super::invokeAll(vColKeys, hAgent);
+    }
+
+Object::Holder BundlingNamedCache::InvokeBundler::unbundle(Object::View vKey,
+        InvocableMap::EntryProcessor::Handle hAgent)
+    {
+    return getBundlingNamedCache()->BundlingNamedCache::super::invoke(vKey, hAgent);
+    }
+
+BundlingNamedCache::Handle BundlingNamedCache::InvokeBundler::getBundlingNamedCache()
+    {
+    return f_hBundlingNamedCache;
+    }
+
+BundlingNamedCache::View BundlingNamedCache::InvokeBundler::getBundlingNamedCache() const
+    {
+    return f_hBundlingNamedCache;
+    }
+
 COH_CLOSE_NAMESPACE3
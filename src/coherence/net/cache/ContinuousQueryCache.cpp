@@ -8,12 +8,22 @@
 
 #include "coherence/internal/net/NamedCacheDeactivationListener.hpp"
 
+#include "coherence/io/Serializer.hpp"
+
+#include "coherence/io/pof/SystemPofContext.hpp"
+
+#include "coherence/net/cache/EvictionPolicy.hpp"
+#include "coherence/net/cache/LocalCache.hpp"
+
 #include "coherence/util/AbstractMapListener.hpp"
 #include "coherence/util/AbstractSet.hpp"
 #include "coherence/util/AbstractStableIterator.hpp"
 #include "coherence/util/ArrayList.hpp"
+#include "coherence/util/Binary.hpp"
 #include "coherence/util/Collections.hpp"
 #include "coherence/util/ConcurrentModificationException.hpp"
+#include "coherence/util/Converter.hpp"
+#include "coherence/util/ConverterCollections.hpp"
 #include "coherence/util/FilterMuterator.hpp"
 #include "coherence/util/HashSet.hpp"
 #include "coherence/util/Iterator.hpp"
@@ -21,8 +31,10 @@
 #include "coherence/util/MapListenerSupport.hpp"
 #include "coherence/util/MapTriggerListener.hpp"
 #include "coherence/util/Muterator.hpp"
+#include "coherence/util/NullImplementation.hpp"
 #include "coherence/util/ReadOnlyArrayList.hpp"
 #include "coherence/util/SafeHashMap.hpp"
+#include "coherence/util/SerializationHelper.hpp"
 #include "coherence/util/SimpleMapIndex.hpp"
 #include "coherence/util/Supplier.hpp"
 
@@ -38,27 +50,37 @@
 #include "coherence/util/transformer/ExtractorEventTransformer.hpp"
 #include "coherence/util/transformer/SemiLiteEventTransformer.hpp"
 
+#include "private/coherence/component/net/extend/RemoteNamedCache.hpp"
 #include "private/coherence/component/util/QueueProcessor.hpp"
 #include "private/coherence/component/util/SafeNamedCache.hpp"
 
 #include "private/coherence/util/InvocableMapHelper.hpp"
 #include "private/coherence/util/ObservableHashMap.hpp"
 #include "private/coherence/util/SimpleMapEntry.hpp"
+#include "private/coherence/util/StringHelper.hpp"
 #include "private/coherence/util/logging/Logger.hpp"
 
+#include <algorithm>
+
 
 
 COH_OPEN_NAMESPACE3(coherence,net,cache)
 
+using coherence::component::net::extend::RemoteNamedCache;
 using coherence::component::util::QueueProcessor;
 using coherence::component::util::SafeNamedCache;
 using coherence::internal::net::NamedCacheDeactivationListener;
+using coherence::io::Serializer;
+using coherence::io::pof::SystemPofContext;
 using coherence::util::AbstractMapListener;
 using coherence::util::AbstractSet;
 using coherence::util::AbstractStableIterator;
 using coherence::util::ArrayList;
+using coherence::util::Binary;
 using coherence::util::Collections;
 using coherence::util::ConcurrentModificationException;
+using coherence::util::Converter;
+using coherence::util::ConverterCollections;
 using coherence::util::FilterMuterator;
 using coherence::util::HashMap;
 using coherence::util::HashSet;
@@ -68,11 +90,14 @@ using coherence::util::MapEventTransformer;
 using coherence::util::MapListenerSupport;
 using coherence::util::MapTriggerListener;
 using coherence::util::Muterator;
+using coherence::util::NullImplementation;
 using coherence::util::ObservableHashMap;
 using coherence::util::ReadOnlyArrayList;
 using coherence::util::SafeHashMap;
+using coherence::util::SerializationHelper;
 using coherence::util::SimpleMapEntry;
 using coherence::util::SimpleMapIndex;
+using coherence::util::StringHelper;
 using coherence::util::Supplier;
 using coherence::util::filter::AlwaysFilter;
 using coherence::util::filter::AndFilter;
@@ -138,6 +163,385 @@ class COH_EXPORT CacheSupplier
         FinalHandle<NamedCache> f_hNamedCache;
     };
 
+/**
+* Return the default number of entries retrieved per request while
+* populating a ContinuousQueryCache, as specified by the
+* coherence.cqc.page.size system property. Paging is disabled unless the
+* property is set to a positive number.
+*/
+int32_t getDefaultPageSize()
+    {
+    return StringHelper::getCountProperty("coherence.cqc.page.size");
+    }
+
+/**
+* Retrieve the values for a range of keys from the underlying cache.
+*
+* @param hCache        the underlying cache
+* @param vTransformer  the transformer to apply to the values, or NULL
+* @param vaoKey        the keys
+* @param of            the offset of the first key to retrieve
+* @param c             the number of keys to retrieve
+*
+* @return a Map of the retrieved keys to their (transformed) values
+*/
+Map::View fetchPage(NamedCache::Handle hCache,
+        ValueExtractor::View vTransformer, ObjectArray::View vaoKey,
+        size32_t of, size32_t c)
+    {
+    Collection::View vColKeys = ReadOnlyArrayList::create(vaoKey, of, c);
+    return vTransformer == NULL
+            ? hCache->getAll(vColKeys)
+            : hCache->invokeAll(vColKeys,
+                    ExtractorProcessor::create(vTransformer));
+    }
+
+/**
+* Converter which serializes the values stored by the internal cache of a
+* ContinuousQueryCache using binary storage.
+*/
+class COH_EXPORT ValueToBinaryConverter
+        : public class_spec<ValueToBinaryConverter,
+          extends<Object>,
+          implements<Converter> >
+    {
+    friend class factory<ValueToBinaryConverter>;
+
+    // ---- constructors ----------------------------------------------------
+
+    protected:
+        /**
+        * Create a new ValueToBinaryConverter.
+        *
+        * @param vSerializer  the Serializer to use
+        */
+        ValueToBinaryConverter(Serializer::View vSerializer)
+                : f_vSerializer(self(), vSerializer)
+            {
+            }
+
+    private:
+        /**
+        * Blocked copy constructor.
+        */
+        ValueToBinaryConverter(const ValueToBinaryConverter&);
+
+    // ----- Converter interface --------------------------------------------
+
+    public:
+        virtual Object::Holder convert(Object::Holder oh) const
+            {
+            return oh == NULL
+                    ? oh
+                    : (Object::Holder) SerializationHelper::toBinary(oh,
+                            f_vSerializer);
+            }
+
+    // ----- ValueToBinaryConverter interface -------------------------------
+
+    public:
+        /**
+        * Return the Serializer used to serialize the values.
+        *
+        * @return the Serializer
+        */
+        Serializer::View getSerializer() const
+            {
+            return f_vSerializer;
+            }
+
+    // ----- data members -----------------------------------------------
+
+    protected:
+        FinalView<Serializer> f_vSerializer;
+    };
+
+/**
+* Key of the decoded values retained by a BinaryToValueConverter, which
+* compares the wrapped Binary by identity rather than by content. The
+* Binary is only weakly referenced, so that a retained value does not keep
+* alive a Binary which the internal cache has since replaced.
+*/
+class COH_EXPORT BinaryIdentity
+        : public class_spec<BinaryIdentity,
+          extends<Object> >
+    {
+    friend class factory<BinaryIdentity>;
+
+    // ---- constructors ----------------------------------------------------
+
+    protected:
+        /**
+        * Create a new BinaryIdentity.
+        *
+        * @param vBin  the Binary
+        */
+        BinaryIdentity(Binary::View vBin)
+                : m_wvBin(self(), vBin),
+                  m_nHash(System::identityHashCode(vBin))
+            {
+            }
+
+    private:
+        /**
+        * Blocked copy constructor.
+        */
+        BinaryIdentity(const BinaryIdentity&);
+
+    // ----- Object interface -----------------------------------------------
+
+    public:
+        virtual bool equals(Object::View v) const
+            {
+            BinaryIdentity::View vThat = cast<BinaryIdentity::View>(v, false);
+            if (vThat == NULL)
+                {
+                return false;
+                }
+
+            // a collected Binary matches nothing, not even itself
+            Binary::View vBin     = m_wvBin;
+            Binary::View vBinThat = vThat->m_wvBin;
+            return vBin != NULL && vBin == vBinThat;
+            }
+
+        virtual size32_t hashCode() const
+            {
+            return m_nHash;
+            }
+
+    // ----- data members -----------------------------------------------
+
+    protected:
+        WeakView<Binary> m_wvBin;
+        size32_t         m_nHash;
+    };
+
+/**
+* Converter which deserializes the values stored by the internal cache of a
+* ContinuousQueryCache using binary storage, optionally retaining the most
+* recently decoded values.
+*/
+class COH_EXPORT BinaryToValueConverter
+        : public class_spec<BinaryToValueConverter,
+          extends<Object>,
+          implements<Converter> >
+    {
+    friend class factory<BinaryToValueConverter>;
+
+    // ---- constructors ----------------------------------------------------
+
+    protected:
+        /**
+        * Create a new BinaryToValueConverter.
+        *
+        * @param vSerializer  the Serializer to use
+        * @param cDecoded     the number of decoded values to retain
+        */
+        BinaryToValueConverter(Serializer::View vSerializer, int32_t cDecoded)
+                : f_vSerializer(self(), vSerializer),
+                  f_hCacheDecoded(self(), cDecoded > 0
+                        ? LocalCache::create(cDecoded)
+                        : (LocalCache::Handle) NULL, /*fMutable*/ true)
+            {
+            LocalCache::Handle hCacheDecoded = f_hCacheDecoded;
+            if (hCacheDecoded != NULL)
+                {
+                hCacheDecoded->setEvictionType(
+                        EvictionPolicy::eviction_policy_lru);
+                }
+            }
+
+    private:
+        /**
+        * Blocked copy constructor.
+        */
+        BinaryToValueConverter(const BinaryToValueConverter&);
+
+    // ----- Converter interface --------------------------------------------
+
+    public:
+        virtual Object::Holder convert(Object::Holder oh) const
+            {
+            Binary::View vBin = cast<Binary::View>(oh, false);
+            if (vBin == NULL)
+                {
+                return oh;
+                }
+
+            LocalCache::Handle hCacheDecoded = f_hCacheDecoded;
+            if (hCacheDecoded == NULL)
+                {
+                return SerializationHelper::fromBinary(vBin, f_vSerializer);
+                }
+
+            // each entry of the internal cache holds its own Binary, which is
+            // replaced whenever the entry changes; keying the decoded values
+            // by identity rather than content keeps entries with equal
+            // serialized values from sharing one (possibly mutable) object
+            Object::View   vKey    = BinaryIdentity::create(vBin);
+            Object::Holder ohValue = hCacheDecoded->get(vKey);
+            if (ohValue == NULL)
+                {
+                ohValue = SerializationHelper::fromBinary(vBin, f_vSerializer);
+                hCacheDecoded->put(vKey, ohValue);
+                }
+            return ohValue;
+            }
+
+    // ----- data members -----------------------------------------------
+
+    protected:
+        FinalView<Serializer>           f_vSerializer;
+        mutable FinalHandle<LocalCache> f_hCacheDecoded;
+    };
+
+/**
+* Return the map of serialized values beneath the specified internal cache,
+* provided it stores values serialized in the form which the specified
+* RemoteNamedCache Converter deserializes.
+*
+* @param hMapLocal  the internal cache
+* @param vConvUp    the Converter the values were received with
+*
+* @return the map of serialized values, or NULL if the values are stored in
+*         another form
+*/
+ObservableMap::Handle getBinaryStorage(ObservableMap::Handle hMapLocal,
+        Converter::View vConvUp)
+    {
+    RemoteNamedCache::ConverterFromBinary::View vConvFrom =
+            cast<RemoteNamedCache::ConverterFromBinary::View>(vConvUp, false);
+    ConverterCollections::ConverterObservableMap::Handle hMapConv =
+            cast<ConverterCollections::ConverterObservableMap::Handle>(
+                    hMapLocal, false);
+    if (vConvFrom != NULL && hMapConv != NULL)
+        {
+        ValueToBinaryConverter::View vConvTo =
+                cast<ValueToBinaryConverter::View>(
+                        hMapConv->getDownConverter()->getValueConverter(), false);
+        if (vConvTo != NULL &&
+                vConvTo->getSerializer() == vConvFrom->getSerializer())
+            {
+            return hMapConv->getObservableMap();
+            }
+        }
+    return NULL;
+    }
+
+/**
+* Determine where the values loaded from the specified cache are put.
+*
+* If the internal cache stores values serialized in the form a remote cache
+* receives them in, the values are retrieved through a view of the remote
+* cache which leaves them serialized, and put directly into the map of
+* serialized values beneath the internal cache, rather than deserialized
+* only to be serialized again.
+*
+* @param hMapLocal  the internal cache
+* @param hCache     the underlying cache; replaced by the view to retrieve
+*                   the serialized values through, if any
+*
+* @return the map to put the loaded values into
+*/
+ObservableMap::Handle selectLoadTarget(ObservableMap::Handle hMapLocal,
+        NamedCache::Handle& hCache)
+    {
+    NamedCache::Handle hCacheRemote = hCache;
+    if (instanceof<SafeNamedCache::Handle>(hCacheRemote))
+        {
+        hCacheRemote = cast<SafeNamedCache::Handle>(hCacheRemote)->
+                getNamedCache();
+        }
+
+    RemoteNamedCache::Handle hRemote =
+            cast<RemoteNamedCache::Handle>(hCacheRemote, false);
+    if (hRemote != NULL)
+        {
+        RemoteNamedCache::ConverterFromBinary::Handle hConvUp =
+                hRemote->getConverterFromBinary();
+        ObservableMap::Handle hMapBinary = getBinaryStorage(hMapLocal, hConvUp);
+        if (hMapBinary != NULL)
+            {
+            Converter::View vConvNull = NullImplementation::getConverter();
+            hCache = ConverterCollections::ConverterNamedCache::create(
+                    (NamedCache::Handle) hRemote->getBinaryCache(),
+                    ConverterCollections::EntryConverter::create(hConvUp,
+                            vConvNull),
+                    ConverterCollections::EntryConverter::create(
+                            hRemote->getConverterKeyToBinary(), vConvNull));
+            return hMapBinary;
+            }
+        }
+    return hMapLocal;
+    }
+
+/**
+* Put the new value of the specified event into the internal cache.
+*
+* A value received from a remote cache is stored in the serialized form it
+* arrived in if the internal cache stores values in that form.
+*
+* @param hMapLocal  the internal cache
+* @param vKey       the key
+* @param vEvent     the event
+*/
+void putEventValue(ObservableMap::Handle hMapLocal, Object::View vKey,
+        MapEvent::View vEvent)
+    {
+    MapEvent::View  vEventRaw = NULL;
+    Converter::View vConvUp   = NULL;
+    if (instanceof<ConverterCollections::ConverterCacheEvent::View>(vEvent))
+        {
+        ConverterCollections::ConverterCacheEvent::View vEventConv =
+                cast<ConverterCollections::ConverterCacheEvent::View>(vEvent);
+        vEventRaw = vEventConv->getCacheEvent();
+        vConvUp   = vEventConv->getConverterValueUp();
+        }
+    else if (instanceof<ConverterCollections::ConverterMapEvent::View>(vEvent))
+        {
+        ConverterCollections::ConverterMapEvent::View vEventConv =
+                cast<ConverterCollections::ConverterMapEvent::View>(vEvent);
+        vEventRaw = vEventConv->getMapEvent();
+        vConvUp   = vEventConv->getConverterValueUp();
+        }
+
+    Object::View vValueRaw = vEventRaw == NULL ? NULL : vEventRaw->getNewValue();
+    if (instanceof<Binary::View>(vValueRaw))
+        {
+        ObservableMap::Handle hMapBinary = getBinaryStorage(hMapLocal, vConvUp);
+        if (hMapBinary != NULL)
+            {
+            hMapBinary->put(vKey, vValueRaw);
+            return;
+            }
+        }
+    hMapLocal->put(vKey, vEvent->getNewValue());
+    }
+
+/**
+* Insert the values for the specified keys into the internal cache, one
+* page at a time.
+*
+* @param hMapLocal     the internal cache
+* @param hCache        the underlying cache
+* @param vTransformer  the transformer to apply, or NULL
+* @param vaoKey        the keys
+* @param cPage         the page size; zero or less for a single page
+*/
+void putPages(ObservableMap::Handle hMapLocal, NamedCache::Handle hCache,
+        ValueExtractor::View vTransformer, ObjectArray::View vaoKey,
+        int32_t cPage)
+    {
+    size32_t cKeys = vaoKey->length;
+    size32_t cStep = cPage <= 0 ? cKeys : (size32_t) cPage;
+    for (size32_t of = 0; of < cKeys; of += cStep)
+        {
+        hMapLocal->putAll(fetchPage(hCache, vTransformer, vaoKey, of,
+                std::min(cStep, cKeys - of)));
+        }
+    }
+
 COH_CLOSE_NAMESPACE_ANON
 
 // TODO REVIEW MF: Evaluate use of so many mutables, it is likely that
@@ -165,6 +569,13 @@ ContinuousQueryCache::ContinuousQueryCache(NamedCache::Handle hCache,
           m_fCacheValues(fCacheValues),
           m_fReadOnly(vTransformer != NULL),
           m_cReconnectMillis(0),
+          m_cPageSize(getDefaultPageSize()),
+          m_vExtractorVersion(self()),
+          m_fBinaryStorage(String::create("binary")->equals(
+                  System::getProperty("coherence.cqc.storage"))),
+          m_cDecodedValues(StringHelper::getCountProperty(
+                  "coherence.cqc.storage.decoded")),
+          m_fListenersAdded(false),
           m_ldtConnectionTimestamp(self(), 0, /*fMutable*/ true),
           m_hMapLocal(self(), (ObservableMap::Handle) NULL, /*fMutable*/ true),
           m_nState(self(), state_disconnected, /*fMutable*/ true),
@@ -196,6 +607,13 @@ ContinuousQueryCache::ContinuousQueryCache(Supplier::View vCacheSupplier,
           m_fCacheValues(fCacheValues),
           m_fReadOnly(vTransformer != NULL),
           m_cReconnectMillis(0),
+          m_cPageSize(getDefaultPageSize()),
+          m_vExtractorVersion(self()),
+          m_fBinaryStorage(String::create("binary")->equals(
+                  System::getProperty("coherence.cqc.storage"))),
+          m_cDecodedValues(StringHelper::getCountProperty(
+                  "coherence.cqc.storage.decoded")),
+          m_fListenersAdded(false),
           m_ldtConnectionTimestamp(self(), 0, /*fMutable*/ true),
           m_hMapLocal(self(), (ObservableMap::Handle) NULL, /*fMutable*/ true),
           m_nState(self(), state_disconnected, /*fMutable*/ true),
@@ -312,6 +730,66 @@ void ContinuousQueryCache::setReconnectInterval(int64_t cReconnectMillis)
     m_cReconnectMillis = cReconnectMillis;
     }
 
+int32_t ContinuousQueryCache::getPageSize() const
+    {
+    return m_cPageSize;
+    }
+
+void ContinuousQueryCache::setPageSize(int32_t cPageSize)
+    {
+    m_cPageSize = cPageSize;
+    }
+
+ValueExtractor::View ContinuousQueryCache::getVersionExtractor() const
+    {
+    return m_vExtractorVersion;
+    }
+
+void ContinuousQueryCache::setVersionExtractor(ValueExtractor::View vExtractor)
+    {
+    m_vExtractorVersion = vExtractor;
+    }
+
+bool ContinuousQueryCache::isBinaryStorage() const
+    {
+    return m_fBinaryStorage;
+    }
+
+void ContinuousQueryCache::setBinaryStorage(bool fBinary)
+    {
+    COH_SYNCHRONIZED(this)
+        {
+        if (fBinary != m_fBinaryStorage)
+            {
+            ObservableMap::Handle hMapLocal = m_hMapLocal;
+            if (hMapLocal != NULL)
+                {
+                // the listeners and indexes registered with the internal
+                // cache would be lost when it is replaced
+                if (m_fListenersAdded || !getIndexMap()->isEmpty())
+                    {
+                    COH_THROW_STREAM(IllegalStateException, getCacheName() <<
+                            " has indexes or listeners; its storage mode can"
+                            " no longer be changed")
+                    }
+                }
+
+            m_fBinaryStorage = fBinary;
+
+            if (hMapLocal != NULL)
+                {
+                // rebuild and reload the internal cache
+                releaseListeners();
+                m_hMapLocal = NULL;
+                m_nState    = state_disconnected;
+
+                ensureInternalCache();
+                ensureSynchronized(false);
+                }
+            }
+        }
+    }
+
 Supplier::View ContinuousQueryCache::getCacheNameSupplier() const
     {
     return m_vCacheNameSupplier;
@@ -324,6 +802,25 @@ void ContinuousQueryCache::setCacheNameSupplier(Supplier::View hCacheNameSupplie
 
 ObservableMap::Handle ContinuousQueryCache::instantiateInternalCache() const
     {
+    if (isBinaryStorage())
+        {
+        CacheService::View vService   = getCacheInternal()->getCacheService();
+        Serializer::View   vSerializer = vService == NULL
+                ? NULL : vService->getSerializer();
+        if (vSerializer == NULL)
+            {
+            vSerializer = SystemPofContext::getInstance();
+            }
+
+        Converter::View vConvKey = NullImplementation::getConverter();
+        return ConverterCollections::ConverterObservableMap::create(
+                (ObservableMap::Handle) ObservableHashMap::create(),
+                ConverterCollections::EntryConverter::create(vConvKey,
+                        BinaryToValueConverter::create(vSerializer,
+                                m_cDecodedValues)),
+                ConverterCollections::EntryConverter::create(vConvKey,
+                        ValueToBinaryConverter::create(vSerializer)));
+        }
     return ObservableHashMap::create();
     }
 
@@ -661,6 +1158,7 @@ void ContinuousQueryCache::addKeyListener(MapListener::Handle hListener,
         }
 
     ensureEventQueue();
+    m_fListenersAdded = true;
     getInternalCache()->addKeyListener(instantiateEventRouter(hListener, fLite),
             vKey, fLite);
     }
@@ -703,6 +1201,7 @@ void ContinuousQueryCache::addFilterListener(MapListener::Handle hListener,
 
     ensureEventQueue();
 
+    m_fListenersAdded = true;
     getInternalCache()->addFilterListener(instantiateEventRouter(hListener, fLite),
             vFilter, fLite);
     }
@@ -1123,53 +1622,7 @@ void ContinuousQueryCache::configureSynchronization(bool fReload) const
                 hMapLocal = ensureInternalCache();
                 if (fFirstTime || fReload)
                     {
-                    // populate the internal cache
-                    if (isCacheValues())
-                        {
-                        Set::View vSet = ((f_vTransformer == NULL)
-                            ? hCache->entrySet(vFilter)
-                            : hCache->invokeAll(vFilter,
-                                ExtractorProcessor::create(
-                                    f_vTransformer))->entrySet());
-            
-                        // first remove anything that is not in the query
-                        if (!hMapLocal->isEmpty())
-                            {
-                            HashSet::Handle hSetQueryKeys = HashSet::create();
-                            for (Iterator::Handle hIter = vSet->iterator();
-                                    hIter->hasNext(); )
-                                {
-                                hSetQueryKeys->add(cast<Map::Entry::View>(
-                                        hIter->next())->getKey());
-                                }
-                            hMapLocal->keySet()->retainAll(hSetQueryKeys);
-                            }
-            
-                        // next, populate the local cache
-                        for (Iterator::Handle hIter = vSet->iterator();
-                                hIter->hasNext(); )
-                            {
-                            Map::Entry::View vEntry = cast<Map::Entry::View>(
-                                    hIter->next());
-                            hMapLocal->put(vEntry->getKey(), vEntry->getValue());
-                            }
-                        }
-                    else
-                        {
-                        // first remove the keys that are not in the query
-                        Set::View vSetQueryKeys = hCache->keySet(vFilter);
-                        if (!hMapLocal->isEmpty())
-                            {
-                            hMapLocal->keySet()->retainAll(vSetQueryKeys);
-                            }
-            
-                        //next, populate the local cache with keys from the query
-                        for (Iterator::Handle hIter = vSetQueryKeys->iterator();
-                                hIter->hasNext(); )
-                            {
-                            hMapLocal->put(hIter->next(), NULL);
-                            }
-                        }
+                    populateInternalCache(hMapLocal, hCache, vFilter);
                     }
                 else
                     {
@@ -1182,8 +1635,11 @@ void ContinuousQueryCache::configureSynchronization(bool fReload) const
                             {
                             haoKey = hMapLocal->keySet()->toArray();
                             }
-                        Map::View vMapValues = hCache->getAll(ReadOnlyArrayList::create(haoKey));
-                        hMapLocal->putAll(vMapValues);
+                        NamedCache::Handle    hCacheLoad = hCache;
+                        ObservableMap::Handle hMapLoad   =
+                                selectLoadTarget(hMapLocal, hCacheLoad);
+                        putPages(hMapLoad, hCacheLoad, (ValueExtractor::View) NULL,
+                                haoKey, getPageSize());
                         }
                     else
                         {
@@ -1273,6 +1729,117 @@ void ContinuousQueryCache::configureSynchronization(bool fReload) const
         }
     }
 
+void ContinuousQueryCache::populateInternalCache(ObservableMap::Handle hMapLocal,
+        NamedCache::Handle hCache, Filter::View vFilter) const
+    {
+    if (isCacheValues() && f_vTransformer == NULL &&
+            getVersionExtractor() != NULL && !hMapLocal->isEmpty())
+        {
+        resynchronizeInternalCache(hMapLocal, hCache, vFilter);
+        return;
+        }
+
+    NamedCache::Handle    hCacheLoad = hCache;
+    ObservableMap::Handle hMapLoad   = f_vTransformer == NULL
+            ? selectLoadTarget(hMapLocal, hCacheLoad) : hMapLocal;
+
+    if (isCacheValues() && getPageSize() <= 0)
+        {
+        // retrieve the entire query result in a single request
+        Set::View vSet = f_vTransformer == NULL
+                ? hCacheLoad->entrySet(vFilter)
+                : hCache->invokeAll(vFilter,
+                        ExtractorProcessor::create(f_vTransformer))->entrySet();
+
+        // first remove anything that is not in the query
+        if (!hMapLocal->isEmpty())
+            {
+            HashSet::Handle hSetQueryKeys = HashSet::create();
+            for (Iterator::Handle hIter = vSet->iterator(); hIter->hasNext(); )
+                {
+                hSetQueryKeys->add(cast<Map::Entry::View>(hIter->next())->getKey());
+                }
+            hMapLocal->keySet()->retainAll(hSetQueryKeys);
+            }
+
+        // next, populate the local cache
+        for (Iterator::Handle hIter = vSet->iterator(); hIter->hasNext(); )
+            {
+            Map::Entry::View vEntry = cast<Map::Entry::View>(hIter->next());
+            hMapLoad->put(vEntry->getKey(), vEntry->getValue());
+            }
+        return;
+        }
+
+    // query the keys only; the values are retrieved in pages below, so that
+    // the entire result set never needs to be held in memory at once
+    Set::View vSetQueryKeys = hCache->keySet(vFilter);
+
+    // first remove anything that is not in the query
+    if (!hMapLocal->isEmpty())
+        {
+        hMapLocal->keySet()->retainAll(vSetQueryKeys);
+        }
+
+    // next, populate the local cache
+    if (isCacheValues())
+        {
+        ObjectArray::View vaoKey = vSetQueryKeys->toArray();
+
+        vSetQueryKeys = NULL;
+        putPages(hMapLoad, hCacheLoad, f_vTransformer, vaoKey, getPageSize());
+        }
+    else
+        {
+        for (Iterator::Handle hIter = vSetQueryKeys->iterator();
+                hIter->hasNext(); )
+            {
+            hMapLocal->put(hIter->next(), NULL);
+            }
+        }
+    }
+
+void ContinuousQueryCache::resynchronizeInternalCache(
+        ObservableMap::Handle hMapLocal, NamedCache::Handle hCache,
+        Filter::View vFilter) const
+    {
+    ValueExtractor::View vExtractor  = getVersionExtractor();
+    Map::View            vMapVersion = hCache->invokeAll(vFilter,
+            ExtractorProcessor::create(vExtractor));
+
+    // first remove anything that is not in the query
+    hMapLocal->keySet()->retainAll(vMapVersion->keySet());
+
+    // next, collect the keys which are new or have changed
+    ObjectArray::Handle haoKey;
+    COH_SYNCHRONIZED (hMapLocal) // COH-1418
+        {
+        ArrayList::Handle hListChanged = ArrayList::create();
+        for (Iterator::Handle hIter = vMapVersion->entrySet()->iterator();
+                hIter->hasNext(); )
+            {
+            Map::Entry::View vEntry = cast<Map::Entry::View>(hIter->next());
+            Object::View     vKey   = vEntry->getKey();
+            Object::Holder   ohValue = hMapLocal->get(vKey);
+
+            // a missing or NULL local value has no version to compare; most
+            // extractors would throw on it, so it is simply fetched again
+            if (ohValue == NULL || !Object::equals(vEntry->getValue(),
+                    vExtractor->extract(ohValue)))
+                {
+                hListChanged->add(vKey);
+                }
+            }
+        haoKey = hListChanged->toArray();
+        }
+
+    // finally, retrieve only the changed values
+    NamedCache::Handle    hCacheLoad = hCache;
+    ObservableMap::Handle hMapLoad   = selectLoadTarget(hMapLocal, hCacheLoad);
+    putPages(hMapLoad, hCacheLoad, (ValueExtractor::View) NULL, haoKey,
+            getPageSize());
+    }
+
 RuntimeException::View ContinuousQueryCache::createUnexpectedStateException(int32_t nExpectedState, int32_t nActualState) const
     {
     return RuntimeException::create(COH_TO_STRING("Unexpected synchronization state.  Expected: "
@@ -1635,11 +2202,17 @@ class COH_EXPORT AddListener
                 // guard against possible NPE; one could theoretically occur
                 // during construction or after release; one occurred during
                 // testing of a deadlock issue (COHCPP-300)
-                Map::Handle hMap = f_vCache->m_hMapLocal;
+                ObservableMap::Handle hMap = f_vCache->m_hMapLocal;
                 if (hMap != NULL)
                     {
-                    hMap->put(vKey, f_vCache->isCacheValues() ?
-                            vEvent->getNewValue() : (Object::View) NULL);
+                    if (f_vCache->isCacheValues())
+                        {
+                        putEventValue(hMap, vKey, vEvent);
+                        }
+                    else
+                        {
+                        hMap->put(vKey, (Object::View) NULL);
+                        }
                     }
                 }
             }
@@ -0,0 +1,373 @@
+/*
+ * Copyright (c) 2000, 2026, Oracle and/or its affiliates.
+ *
+ * Licensed under the Universal Permissive License v 1.0 as shown at
+ * http://oss.oracle.com/licenses/upl.
+ */
+#include "private/coherence/net/internal/CacheConfigIndex.hpp"
+
+#include "coherence/util/ArrayList.hpp"
+#include "coherence/util/HashMap.hpp"
+#include "coherence/util/Iterator.hpp"
+#include "coherence/util/List.hpp"
+
+#include "private/coherence/util/StringHelper.hpp"
+
+COH_OPEN_NAMESPACE3(coherence,net,internal)
+
+using coherence::util::ArrayList;
+using coherence::util::HashMap;
+using coherence::util::Iterator;
+using coherence::util::List;
+using coherence::util::StringHelper;
+
+
+// ----- constructors -------------------------------------------------------
+
+CacheConfigIndex::CacheConfigIndex(XmlElement::View vXmlConfig)
+        : f_hMapExact(self(), HashMap::create()),
+          f_hRoot(self(), Node::create()),
+          f_vMappingDefault(self()),
+          f_hMapScheme(self(), HashMap::create()),
+          f_hMapService(self(), HashMap::create())
+    {
+    Map::Handle   hMapExact = f_hMapExact;
+    Node::Handle  hRoot     = f_hRoot;
+    Mapping::View vDefault;
+    int32_t       nOrder    = 0;
+
+    for (Iterator::Handle hIter = vXmlConfig->getSafeElement
+            ("caching-scheme-mapping")->getElements("cache-mapping");
+            hIter->hasNext(); ++nOrder)
+        {
+        Mapping::View vMapping = Mapping::create(
+                cast<XmlElement::View>(hIter->next()));
+        String::View  vsName   = vMapping->getCacheName();
+
+        if (!hMapExact->containsKey(vsName))
+            {
+            hMapExact->put(vsName, vMapping);
+            }
+
+        size32_t ofWildcard = vMapping->getWildcardIndex();
+        if (vsName->equals("*"))
+            {
+            vDefault = vMapping;
+            }
+        else if (ofWildcard != String::npos)
+            {
+            // walk the octets of the prefix, which precede the "*"
+            const char*  ach   = vsName->getCString();
+            Node::Handle hNode = hRoot;
+            for (const char* pch = ach; *pch != '*'; ++pch)
+                {
+                hNode = hNode->ensureChild((octet_t) *pch);
+                }
+
+            if (vMapping->isInvalid())
+                {
+                if (NULL == hNode->getInvalid())
+                    {
+                    hNode->setInvalid(vMapping);
+                    }
+                }
+            else
+                {
+                hNode->setMapping(vMapping, nOrder);
+                }
+            }
+        }
+    initialize(f_vMappingDefault, vDefault);
+
+    Map::Handle hMapScheme  = f_hMapScheme;
+    Map::Handle hMapService = f_hMapService;
+    for (Iterator::Handle hIter = vXmlConfig->getSafeElement("caching-schemes")->
+            getElementList()->iterator(); hIter->hasNext();)
+        {
+        XmlElement::View vXml = cast<XmlElement::View>(hIter->next());
+
+        String::View vsScheme = vXml->getSafeElement("scheme-name")->getString();
+        if (!hMapScheme->containsKey(vsScheme))
+            {
+            hMapScheme->put(vsScheme, vXml);
+            }
+
+        String::View vsService = vXml->getSafeElement("service-name")->getString();
+        if (!hMapService->containsKey(vsService))
+            {
+            hMapService->put(vsService, vXml);
+            }
+        }
+    }
+
+
+// ----- CacheConfigIndex interface -----------------------------------------
+
+DefaultConfigurableCacheFactory::CacheInfo::View
+    CacheConfigIndex::findSchemeMapping(String::View vsCacheName) const
+    {
+    Mapping::View vMapping = cast<Mapping::View>(f_hMapExact->get(vsCacheName));
+    if (NULL != vMapping)
+        {
+        return vMapping->createCacheInfo(vsCacheName,
+                StringHelper::getEmptyString());
+        }
+
+    // the deepest Node is the longest matching prefix, but the last
+    // matching mapping in document order is the one which applies
+    Mapping::View vMatch;
+    int32_t       nMatch = -1;
+    Node::View    vNode  = f_hRoot;
+    for (const char* pch = vsCacheName->getCString(); NULL != vNode; ++pch)
+        {
+        Mapping::View vInvalid = vNode->getInvalid();
+        if (NULL != vInvalid)
+            {
+            COH_THROW_STREAM (IllegalArgumentException,
+                    "Invalid wildcard pattern:\n" << vInvalid->getXml());
+            }
+
+        Mapping::View vCandidate = vNode->getMapping();
+        if (NULL != vCandidate && vNode->getOrder() > nMatch)
+            {
+            vMatch = vCandidate;
+            nMatch = vNode->getOrder();
+            }
+
+        if (*pch == '\0')
+            {
+            break;
+            }
+        vNode = vNode->getChild((octet_t) *pch);
+        }
+
+    if (NULL != vMatch)
+        {
+        return vMatch->createCacheInfo(vsCacheName,
+                vsCacheName->substring(vMatch->getWildcardIndex()));
+        }
+
+    Mapping::View vDefault = f_vMappingDefault;
+    if (NULL != vDefault)
+        {
+        return vDefault->createCacheInfo(vsCacheName, vsCacheName);
+        }
+
+    COH_THROW_STREAM (IllegalArgumentException,
+            "No scheme for cache: \"" << vsCacheName << '"');
+    }
+
+XmlElement::View CacheConfigIndex::findScheme(String::View vsSchemeName) const
+    {
+    return cast<XmlElement::View>(f_hMapScheme->get(vsSchemeName));
+    }
+
+XmlElement::View CacheConfigIndex::findServiceScheme(
+        String::View vsServiceName) const
+    {
+    return cast<XmlElement::View>(f_hMapService->get(vsServiceName));
+    }
+
+
+// ----- nested class: Mapping ----------------------------------------------
+
+// ----- constructors ---------------------------------------------------
+
+CacheConfigIndex::Mapping::Mapping(XmlElement::View vXml)
+        : f_vXml(self(), vXml),
+          f_vsCacheName(self(), vXml->getSafeElement("cache-name")->getString()),
+          f_vsSchemeName(self(), vXml->getSafeElement("scheme-name")->getString()),
+          f_vaParamName(self()),
+          f_vaParamPrefix(self()),
+          f_vaParamSuffix(self()),
+          f_vMapAttribute(self()),
+          m_ofWildcard(f_vsCacheName->indexOf('*'))
+    {
+    List::Handle hListName   = ArrayList::create();
+    List::Handle hListPrefix = ArrayList::create();
+    List::Handle hListSuffix = ArrayList::create();
+    Map::Handle  hMapAttr    = HashMap::create();
+    bool         fShared     = true;
+
+    for (Iterator::Handle hIter = vXml->getSafeElement("init-params")->
+            getElements("init-param"); hIter->hasNext();)
+        {
+        XmlElement::View vXmlParam = cast<XmlElement::View>(hIter->next());
+        String::View     vsName    = vXmlParam->getSafeElement("param-name" )->getString();
+        String::View     vsValue   = vXmlParam->getSafeElement("param-value")->getString();
+
+        if (vsName->length() != 0)
+            {
+            size32_t ofReplace = vsValue->indexOf('*');
+            if (ofReplace == String::npos)
+                {
+                hListPrefix->add(vsValue);
+                hListSuffix->add(NULL);
+                }
+            else
+                {
+                hListPrefix->add(vsValue->substring(0, ofReplace));
+                hListSuffix->add(vsValue->substring(ofReplace + 1));
+                fShared = false;
+                }
+            hListName->add(vsName);
+            hMapAttr->put(vsName, vsValue);
+            }
+        }
+
+    initialize(f_vaParamName,   hListName->toArray());
+    initialize(f_vaParamPrefix, hListPrefix->toArray());
+    initialize(f_vaParamSuffix, hListSuffix->toArray());
+    if (fShared)
+        {
+        initialize(f_vMapAttribute, hMapAttr);
+        }
+    }
+
+
+// ----- Mapping interface ----------------------------------------------
+
+DefaultConfigurableCacheFactory::CacheInfo::View
+    CacheConfigIndex::Mapping::createCacheInfo(String::View vsCacheName,
+        String::View vsSuffix) const
+    {
+    Map::View vMapAttr = f_vMapAttribute;
+    if (NULL == vMapAttr)
+        {
+        ObjectArray::View vaName   = f_vaParamName;
+        ObjectArray::View vaPrefix = f_vaParamPrefix;
+        ObjectArray::View vaSuffix = f_vaParamSuffix;
+        Map::Handle       hMapAttr = HashMap::create();
+
+        for (size32_t i = 0, c = vaName->length; i < c; ++i)
+            {
+            String::View vsValue = cast<String::View>(vaPrefix[i]);
+            if (NULL != vaSuffix[i])
+                {
+                vsValue = COH_TO_STRING(vsValue << vsSuffix <<
+                        cast<String::View>(vaSuffix[i]));
+                }
+            hMapAttr->put(vaName[i], vsValue);
+            }
+        vMapAttr = hMapAttr;
+        }
+
+    return DefaultConfigurableCacheFactory::CacheInfo::create(vsCacheName,
+            f_vsSchemeName, vMapAttr);
+    }
+
+
+// ----- accessors ------------------------------------------------------
+
+String::View CacheConfigIndex::Mapping::getCacheName() const
+    {
+    return f_vsCacheName;
+    }
+
+size32_t CacheConfigIndex::Mapping::getWildcardIndex() const
+    {
+    return m_ofWildcard;
+    }
+
+bool CacheConfigIndex::Mapping::isInvalid() const
+    {
+    return m_ofWildcard != String::npos &&
+            m_ofWildcard != f_vsCacheName->length() - 1;
+    }
+
+XmlElement::View CacheConfigIndex::Mapping::getXml() const
+    {
+    return f_vXml;
+    }
+
+
+// ----- nested class: Node -------------------------------------------------
+
+// ----- constructors ---------------------------------------------------
+
+CacheConfigIndex::Node::Node()
+        : m_habEdge(self(), Array<octet_t>::create(0)),
+          m_haChild(self(), ObjectArray::create(0)),
+          m_vMapping(self()),
+          m_vInvalid(self()),
+          m_nOrder(-1)
+    {
+    }
+
+
+// ----- Node interface -------------------------------------------------
+
+CacheConfigIndex::Node::View CacheConfigIndex::Node::getChild(octet_t b) const
+    {
+    Array<octet_t>::View vabEdge = m_habEdge;
+    for (size32_t i = 0, c = vabEdge->length; i < c; ++i)
+        {
+        if (vabEdge[i] == b)
+            {
+            ObjectArray::View vaChild = m_haChild;
+            return cast<Node::View>(vaChild[i]);
+            }
+        }
+    return NULL;
+    }
+
+CacheConfigIndex::Node::Handle CacheConfigIndex::Node::ensureChild(octet_t b)
+    {
+    Array<octet_t>::Handle habEdge = m_habEdge;
+    ObjectArray::Handle    haChild = m_haChild;
+    size32_t               c       = habEdge->length;
+    for (size32_t i = 0; i < c; ++i)
+        {
+        if (habEdge[i] == b)
+            {
+            return cast<Node::Handle>(haChild[i]);
+            }
+        }
+
+    // the trie is only modified while it is being built, so it is
+    // sufficient to grow the arrays by one
+    Array<octet_t>::Handle habNew = Array<octet_t>::create(c + 1);
+    ObjectArray::Handle    haNew  = ObjectArray::create(c + 1);
+
+    Array<octet_t>::copy(habEdge, 0, habNew);
+    ObjectArray::copy(haChild, 0, haNew);
+
+    Node::Handle hChild = Node::create();
+    habNew[c] = b;
+    haNew[c]  = hChild;
+
+    m_habEdge = habNew;
+    m_haChild = haNew;
+    return hChild;
+    }
+
+
+// ----- accessors ------------------------------------------------------
+
+CacheConfigIndex::Mapping::View CacheConfigIndex::Node::getMapping() const
+    {
+    return m_vMapping;
+    }
+
+int32_t CacheConfigIndex::Node::getOrder() const
+    {
+    return m_nOrder;
+    }
+
+void CacheConfigIndex::Node::setMapping(Mapping::View vMapping, int32_t nOrder)
+    {
+    m_vMapping = vMapping;
+    m_nOrder   = nOrder;
+    }
+
+CacheConfigIndex::Mapping::View CacheConfigIndex::Node::getInvalid() const
+    {
+    return m_vInvalid;
+    }
+
+void CacheConfigIndex::Node::setInvalid(Mapping::View vMapping)
+    {
+    m_vInvalid = vMapping;
+    }
+
+COH_CLOSE_NAMESPACE3
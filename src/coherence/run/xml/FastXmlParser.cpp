@@ -0,0 +1,537 @@
+/*
+ * Copyright (c) 2000, 2026, Oracle and/or its affiliates.
+ *
+ * Licensed under the Universal Permissive License v 1.0 as shown at
+ * http://oss.oracle.com/licenses/upl.
+ */
+#include "private/coherence/run/xml/FastXmlParser.hpp"
+
+#include "coherence/io/IOException.hpp"
+
+#include "private/coherence/dev/compiler/SyntaxException.hpp"
+#include "private/coherence/run/xml/SimpleDocument.hpp"
+#include "private/coherence/run/xml/XmlHelper.hpp"
+
+#include <cstring>
+#include <iterator>
+#include <string>
+
+COH_OPEN_NAMESPACE3(coherence,run,xml)
+
+using coherence::dev::compiler::SyntaxException;
+using coherence::io::IOException;
+
+COH_OPEN_NAMESPACE_ANON(FastXmlParser)
+
+// the name character rules match those of XmlTokenizer
+
+inline bool isNameStartChar(char ch)
+    {
+    return (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') || '_' == ch
+            || ':' == ch || (ch >= '0' && ch <= '9');
+    }
+
+inline bool isNameChar(char ch)
+    {
+    return (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') || '_' == ch
+            || ':' == ch  || '-' == ch  || '.' == ch
+            || (ch >= '0' && ch <= '9');
+    }
+
+inline bool isSpace(char ch)
+    {
+    // XML 1.0 spec 2nd ed section 2.3:
+    // S ::= (#x20 | #x9 | #xD | #xA)+
+    return 0x20 == ch || 0x09 == ch || 0x0D == ch || 0x0A == ch;
+    }
+
+/**
+* Create a String from the octets in the range [pchBegin, pchEnd), which
+* is not NUL terminated.
+*/
+String::View createString(const char* pchBegin, const char* pchEnd)
+    {
+    return String::create(std::string(pchBegin, pchEnd));
+    }
+
+COH_CLOSE_NAMESPACE_ANON
+
+
+// ----- constructors -------------------------------------------------------
+
+FastXmlParser::FastXmlParser()
+        : m_achStart(NULL), m_pch(NULL), m_pchEnd(NULL)
+    {
+    }
+
+
+// ----- FastXmlParser interface --------------------------------------------
+
+XmlDocument::Handle FastXmlParser::parseXml(String::View vsXml)
+    {
+    const char* ach = vsXml->getCString();
+    return parseXml(ach, size32_t(std::strlen(ach)));
+    }
+
+XmlDocument::Handle FastXmlParser::parseXml(std::istream& stream)
+    {
+    if (stream.fail())
+        {
+        COH_THROW_STREAM (IOException,
+                "Exception occurred during parsing: The stream "
+                << " is in a failed state.");
+        }
+
+    std::string s((std::istreambuf_iterator<char>(stream)),
+            std::istreambuf_iterator<char>());
+    return parseXml(s.data(), size32_t(s.size()));
+    }
+
+XmlDocument::Handle FastXmlParser::parseXml(const char* ach, size32_t cb)
+    {
+    XmlDocument::Handle hXmlDoc = SimpleDocument::create();
+
+    COH_SYNCHRONIZED (this)
+        {
+        m_achStart = ach;
+        m_pch      = ach;
+        m_pchEnd   = ach + cb;
+        try
+            {
+            parseDocument(hXmlDoc);
+            }
+        catch (SyntaxException::View s)
+            {
+            m_achStart = m_pch = m_pchEnd = NULL;
+            COH_THROW (RuntimeException::create(COH_TO_STRING(
+                    "Exception occurred during parsing: " << s->getMessage()),
+                    s));
+            }
+        catch (Exception::View t)
+            {
+            m_achStart = m_pch = m_pchEnd = NULL;
+            COH_THROW (IOException::create(COH_TO_STRING(
+                    "Exception occurred during parsing: " << t->getMessage())));
+            }
+        m_achStart = m_pch = m_pchEnd = NULL;
+        }
+    return hXmlDoc;
+    }
+
+
+// ----- implementation -----------------------------------------------------
+
+void FastXmlParser::parseDocument(XmlDocument::Handle hXml)
+    {
+    skipWhitespace();
+
+    // check for "<?xml"; any other PI is handled by parseMisc
+    if (isAt("<?xml") && m_pch + 5 < m_pchEnd && !isNameChar(m_pch[5]))
+        {
+        m_pch += 5;
+        parseXmlDecl(hXml);
+        }
+
+    // check for comments / other PIs
+    parseMisc(hXml);
+
+    // check for "<!DOCTYPE"
+    if (isAt("<!DOCTYPE"))
+        {
+        m_pch += 9;
+        parseDoctype(hXml);
+        parseMisc(hXml);
+        }
+
+    // root element is required
+    if (!isAt("<") || m_pch + 1 >= m_pchEnd || !isNameStartChar(m_pch[1]))
+        {
+        fail("Invalid root element");
+        }
+    ++m_pch;
+
+    String::View vsName = parseName();
+    if (hXml->getName() == NULL)
+        {
+        hXml->setName(vsName);
+        }
+    else if (!hXml->getName()->equals(vsName))
+        {
+        fail(COH_TO_STRING("looking for " << hXml->getName() << ", found "
+                << vsName));
+        }
+    parseElement(hXml);
+
+    // check for comments / other PIs
+    parseMisc(hXml);
+    }
+
+void FastXmlParser::parseXmlDecl(XmlDocument::Handle hXml)
+    {
+    skipWhitespace();
+    if (!peekName("version"))
+        {
+        fail("The version value is missing from the XML declaration");
+        }
+    // version is assumed to be "1.0"
+    parseLiteral(true);
+
+    skipWhitespace();
+    if (peekName("encoding"))
+        {
+        String::View vsValue = parseLiteral(true);
+        if (!XmlHelper::isEncodingValid(vsValue))
+            {
+            fail(COH_TO_STRING("The encoding value in"
+                    << " the XML declaration is illegal (" << vsValue << ")"));
+            }
+        hXml->setEncoding(vsValue);
+        }
+
+    skipWhitespace();
+    if (peekName("standalone"))
+        {
+        // standalone is discarded
+        String::View vsValue = parseLiteral(true);
+        if (!(vsValue->equals("yes") || vsValue->equals("no")))
+            {
+            fail("The value in the declaration must be 'yes' or 'no'");
+            }
+        }
+
+    skipWhitespace();
+    match("?>");
+    }
+
+void FastXmlParser::parseDoctype(XmlDocument::Handle hXml)
+    {
+    // root element name
+    skipWhitespace();
+    hXml->setName(parseName());
+
+    // ExternalID (optional): public identifier
+    skipWhitespace();
+    bool fPublic = peekName("PUBLIC");
+    if (fPublic)
+        {
+        String::View vsName = XmlHelper::decodeAttribute(parseLiteral(false));
+        if (!XmlHelper::isPublicIdentifierValid(vsName))
+            {
+            fail(COH_TO_STRING("The public identifier in"
+                    << " the XML DOCTYPE is invalid (" << vsName << ")"));
+            }
+        hXml->setDtdName(vsName);
+        }
+
+    // ExternalID (optional): system identifier
+    if (fPublic || peekName("SYSTEM"))
+        {
+        String::View vsUri = XmlHelper::decodeUri(
+                XmlHelper::decodeAttribute(parseLiteral(false)));
+        if (!XmlHelper::isSystemIdentifierValid(vsUri))
+            {
+            fail(COH_TO_STRING("The system identifier in"
+                    << " the XML DOCTYPE is invalid (" << vsUri << ")"));
+            }
+        hXml->setDtdUri(vsUri);
+        }
+
+    // ignore inline markup decl
+    skipWhitespace();
+    if (isAt("["))
+        {
+        m_pch = scan("]") + 1;
+        skipWhitespace();
+        }
+    match(">");
+    }
+
+void FastXmlParser::parseElement(XmlElement::Handle hXml)
+    {
+    // parse attributes
+    while (true)
+        {
+        skipWhitespace();
+        if (m_pch >= m_pchEnd || !isNameStartChar(*m_pch))
+            {
+            break;
+            }
+
+        String::View vsAttr = parseName();
+        if (!XmlHelper::isNameValid(vsAttr))
+            {
+            fail(COH_TO_STRING("Illegal attribute name: " << vsAttr << ")"));
+            }
+        String::View vsValue = XmlHelper::decodeAttribute(parseLiteral(true));
+        hXml->addAttribute(vsAttr)->setString(vsValue);
+        }
+
+    // check if this were an empty element
+    if (isAt("/>"))
+        {
+        m_pch += 2;
+        return;
+        }
+
+    // this element is the "content" type (not empty)
+    match(">");
+
+    std::string sValue;
+    while (true)
+        {
+        // character data - scan up to '<'; whitespace only chunks, which
+        // separate child elements, are skipped without creating a String
+        const char* pchData = m_pch;
+        bool        fSpace  = true;
+        while (m_pch < m_pchEnd && '<' != *m_pch)
+            {
+            fSpace = fSpace && isSpace(*m_pch);
+            ++m_pch;
+            }
+        if (m_pch >= m_pchEnd)
+            {
+            fail(COH_TO_STRING("Unexpected end of document; "
+                    << hXml->getName() << " is missing a closing tag"));
+            }
+        if (!fSpace)
+            {
+            String::View vsChunk = createString(pchData, m_pch);
+            vsChunk = XmlHelper::decodeContent(XmlHelper::trim(vsChunk));
+            if (vsChunk->length() > 0)
+                {
+                sValue += vsChunk->getCString();
+                }
+            }
+
+        if (isAt("</"))
+            {
+            m_pch += 2;
+
+            const char* achName = hXml->getName()->getCString();
+            size_t      cbName  = std::strlen(achName);
+            if (m_pch + cbName > m_pchEnd ||
+                    0 != std::memcmp(m_pch, achName, cbName) ||
+                    (m_pch + cbName < m_pchEnd && isNameChar(m_pch[cbName])))
+                {
+                fail(COH_TO_STRING("looking for " << hXml->getName()
+                        << "... It is possible that " << hXml->getName()
+                        << " is missing a closing tag"));
+                }
+            m_pch += cbName;
+            skipWhitespace();
+            match(">");
+
+            if (!sValue.empty())
+                {
+                hXml->setString(String::create(sValue));
+                }
+            return;
+            }
+        else if (isAt("<!--"))
+            {
+            m_pch += 4;
+            parseComment(hXml, false);
+            }
+        else if (isAt("<![CDATA["))
+            {
+            m_pch += 9;
+            const char* pchEnd = scan("]]>");
+            sValue.append(m_pch, pchEnd - m_pch);
+            m_pch = pchEnd + 3;
+            }
+        else if (isAt("<?"))
+            {
+            m_pch += 2;
+            parsePi();
+            }
+        else
+            {
+            ++m_pch;
+            parseElement(hXml->addElement(parseName()));
+            }
+        }
+    }
+
+void FastXmlParser::parseMisc(XmlDocument::Handle hXml)
+    {
+    while (true)
+        {
+        skipWhitespace();
+        if (isAt("<!--"))
+            {
+            m_pch += 4;
+            parseComment(hXml, true);
+            }
+        else if (isAt("<?"))
+            {
+            m_pch += 2;
+            parsePi();
+            }
+        else
+            {
+            return;
+            }
+        }
+    }
+
+void FastXmlParser::parseComment(XmlElement::Handle hXml, bool fIsDocument)
+    {
+    skipWhitespace();
+
+    const char* pchEnd = scan("-->");
+    if (pchEnd > m_pch)
+        {
+        String::View vsText = createString(m_pch, pchEnd);
+        if (fIsDocument)
+            {
+            XmlDocument::Handle hDoc      = cast<XmlDocument::Handle>(hXml);
+            String::View        vsComment = hDoc->getDocumentComment();
+            if (NULL == vsComment || 0 == vsComment->length())
+                {
+                hDoc->setDocumentComment(vsText);
+                }
+            else
+                {
+                hDoc->setDocumentComment(
+                        COH_TO_STRING(vsComment << "\n" << vsText));
+                }
+            }
+        else
+            {
+            String::View vsComment = hXml->getComment();
+            if (NULL == vsComment || 0 == vsComment->length())
+                {
+                hXml->setComment(vsText);
+                }
+            else
+                {
+                hXml->setComment(COH_TO_STRING(vsComment << "\n" << vsText));
+                }
+            }
+        }
+    m_pch = pchEnd + 3;
+    }
+
+void FastXmlParser::parsePi()
+    {
+    if (parseName()->equals("xml"))
+        {
+        fail("XML declaration can only appear at the beginning of a document");
+        }
+
+    // ignore all other PIs
+    m_pch = scan("?>") + 2;
+    }
+
+
+// ----- parsing helpers ----------------------------------------------------
+
+void FastXmlParser::skipWhitespace()
+    {
+    while (m_pch < m_pchEnd && isSpace(*m_pch))
+        {
+        ++m_pch;
+        }
+    }
+
+bool FastXmlParser::isAt(const char* ach) const
+    {
+    const char* pch = m_pch;
+    for (; *ach != '\0'; ++ach, ++pch)
+        {
+        if (pch >= m_pchEnd || *pch != *ach)
+            {
+            return false;
+            }
+        }
+    return true;
+    }
+
+void FastXmlParser::match(const char* ach)
+    {
+    if (!isAt(ach))
+        {
+        fail(COH_TO_STRING("looking for \"" << ach << '"'));
+        }
+    m_pch += std::strlen(ach);
+    }
+
+bool FastXmlParser::peekName(const char* ach)
+    {
+    size_t cb = std::strlen(ach);
+    if (isAt(ach) && (m_pch + cb >= m_pchEnd || !isNameChar(m_pch[cb])))
+        {
+        m_pch += cb;
+        return true;
+        }
+    return false;
+    }
+
+String::View FastXmlParser::parseName()
+    {
+    const char* pchName = m_pch;
+    if (m_pch >= m_pchEnd || !isNameStartChar(*m_pch))
+        {
+        fail("Invalid Name");
+        }
+    while (++m_pch < m_pchEnd && isNameChar(*m_pch))
+        {
+        }
+    return createString(pchName, m_pch);
+    }
+
+String::View FastXmlParser::parseLiteral(bool fEquals)
+    {
+    if (fEquals)
+        {
+        skipWhitespace();
+        match("=");
+        }
+    skipWhitespace();
+
+    char ch = m_pch < m_pchEnd ? *m_pch : '\0';
+    if ('"' != ch && '\'' != ch)
+        {
+        fail("looking for a quoted literal");
+        }
+
+    const char* pchLit = ++m_pch;
+    while (m_pch < m_pchEnd && ch != *m_pch)
+        {
+        ++m_pch;
+        }
+    if (m_pch >= m_pchEnd)
+        {
+        fail("Unterminated literal");
+        }
+    return createString(pchLit, m_pch++);
+    }
+
+const char* FastXmlParser::scan(const char* ach)
+    {
+    size_t cb = std::strlen(ach);
+    for (const char* pch = m_pch; pch + cb <= m_pchEnd; ++pch)
+        {
+        if (*pch == *ach && 0 == std::memcmp(pch, ach, cb))
+            {
+            return pch;
+            }
+        }
+    fail(COH_TO_STRING("looking for \"" << ach << '"'));
+    return m_pchEnd; // unreachable
+    }
+
+void FastXmlParser::fail(String::View vsMsg) const
+    {
+    size32_t nLine = 1;
+    for (const char* pch = m_achStart; pch < m_pch && pch < m_pchEnd; ++pch)
+        {
+        if ('\n' == *pch)
+            {
+            ++nLine;
+            }
+        }
+    COH_THROW_STREAM (SyntaxException, vsMsg << " (line " << nLine << ')');
+    }
+
+COH_CLOSE_NAMESPACE3
@@ -19,6 +19,7 @@
 #include "coherence/util/Map.hpp"
 #include "coherence/util/Muterator.hpp"
 
+#include "private/coherence/run/xml/FastXmlParser.hpp"
 #include "private/coherence/run/xml/SimpleElement.hpp"
 #include "private/coherence/run/xml/SimpleParser.hpp"
 #include "private/coherence/util/StringHelper.hpp"
@@ -44,17 +45,38 @@ using coherence::util::Muterator;
 using coherence::util::StringHelper;
 using coherence::util::logging::Logger;
 
+COH_OPEN_NAMESPACE_ANON(XmlHelper)
+
+// ----- file local helpers -------------------------------------------------
+
+/**
+* Determine if the FastXmlParser has been selected via the
+* coherence.xml.parser system property; the default is "simple".
+*
+* @return true iff the FastXmlParser should be used
+*/
+bool isFastParser()
+    {
+    return System::getProperty("coherence.xml.parser", "simple")->equals("fast");
+    }
+
+COH_CLOSE_NAMESPACE_ANON
+
 
 // ----- Xml loading helpers ------------------------------------------------
 
 XmlDocument::Handle XmlHelper::loadXml(std::istream& stream)
     {
-    return SimpleParser::create()->parseXml(stream);
+    return isFastParser()
+            ? FastXmlParser::create()->parseXml(stream)
+            : SimpleParser::create()->parseXml(stream);
     }
 
 XmlDocument::Handle XmlHelper::loadXml(String::View vsXml)
     {
-    return SimpleParser::create()->parseXml(vsXml);
+    return isFastParser()
+            ? FastXmlParser::create()->parseXml(vsXml)
+            : SimpleParser::create()->parseXml(vsXml);
     }
 
 XmlDocument::Handle XmlHelper::loadFile(String::View vsName, String::View vsDescr)
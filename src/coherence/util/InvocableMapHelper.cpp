@@ -6,11 +6,13 @@
  */
 #include "private/coherence/util/InvocableMapHelper.hpp"
 
+#include "coherence/native/NativeAtomic32.hpp"
 #include "coherence/util/ArrayList.hpp"
 #include "coherence/util/Arrays.hpp"
 #include "coherence/util/Collections.hpp"
 #include "coherence/util/Comparator.hpp"
 #include "coherence/util/ConcurrentModificationException.hpp"
+#include "coherence/util/DualQueue.hpp"
 #include "coherence/util/Filter.hpp"
 #include "coherence/util/HashSet.hpp"
 #include "coherence/util/Map.hpp"
@@ -33,10 +35,14 @@
 #include "coherence/util/filter/LimitFilter.hpp"
 
 #include "private/coherence/util/SimpleMapEntry.hpp"
+#include "private/coherence/util/StringHelper.hpp"
 #include "private/coherence/util/logging/Logger.hpp"
 
+#include <algorithm>
+
 COH_OPEN_NAMESPACE2(coherence,util)
 
+using coherence::native::NativeAtomic32;
 using coherence::util::comparator::EntryComparator;
 using coherence::util::comparator::SafeComparator;
 using coherence::util::extractor::AbstractExtractor;
@@ -149,6 +155,307 @@ class COH_EXPORT IndexAdapter
         FinalHandle<MapIndex> f_hIndex;
     };
 
+// ------- local class: QueryWorker -------------------------------------
+
+/**
+* Runnable which evaluates a query filter over a range of the candidate
+* keys on behalf of InvocableMapHelper::evaluateParallel.
+*
+* A QueryWorker runs at most once, on whichever thread claims it first:
+* either a QueryPool thread, or the thread which submitted it, should that
+* thread find it still waiting once its own range has been evaluated.
+*/
+class COH_EXPORT QueryWorker
+    : public class_spec<QueryWorker,
+        extends<Object>,
+        implements<Runnable> >
+    {
+    friend class factory<QueryWorker>;
+
+    // ----- constructors ---------------------------------------------------
+
+    protected:
+        QueryWorker(Map::View vMap, Filter::View vFilter, bool fEntries,
+                ObjectArray::Handle haoResult, size32_t iFrom, size32_t iTo)
+            : f_vMap(self(), vMap), f_vFilter(self(), vFilter),
+              m_fEntries(fEntries), f_haoResult(self(), haoResult),
+              m_iFrom(iFrom), m_iTo(iTo), m_cMatches(0),
+              m_vException(self()), m_fClaimed(false), m_fDone(false)
+            {
+            }
+
+    // ----- Runnable interface ---------------------------------------------
+
+    public:
+        virtual void run()
+            {
+            COH_SYNCHRONIZED (this)
+                {
+                if (m_fClaimed)
+                    {
+                    return;
+                    }
+                m_fClaimed = true;
+                }
+
+            size32_t        cMatches = 0;
+            Exception::View vEx;
+            try
+                {
+                cMatches = InvocableMapHelper::evaluateRange(f_vMap,
+                        f_vFilter, m_fEntries, f_haoResult, m_iFrom, m_iTo);
+                }
+            catch (Exception::View e)
+                {
+                vEx = e;
+                }
+
+            COH_SYNCHRONIZED (this)
+                {
+                m_cMatches   = cMatches;
+                m_vException = vEx;
+                m_fDone      = true;
+                notifyAll();
+                }
+            }
+
+    // ----- QueryWorker interface ------------------------------------------
+
+    public:
+        /**
+        * Block until this worker has run.
+        */
+        void await() const
+            {
+            COH_SYNCHRONIZED (this)
+                {
+                while (!m_fDone)
+                    {
+                    wait();
+                    }
+                }
+            }
+
+        size32_t getFrom() const
+            {
+            return m_iFrom;
+            }
+
+        size32_t getMatches() const
+            {
+            return m_cMatches;
+            }
+
+        Exception::View getException() const
+            {
+            return m_vException;
+            }
+
+    // ----- data members ---------------------------------------------------
+
+    protected:
+        FinalView<Map>           f_vMap;
+        FinalView<Filter>        f_vFilter;
+        bool                     m_fEntries;
+        FinalHandle<ObjectArray> f_haoResult;
+        size32_t                 m_iFrom;
+        size32_t                 m_iTo;
+        size32_t                 m_cMatches;
+        MemberView<Exception>    m_vException;
+        bool                     m_fClaimed;
+        bool                     m_fDone;
+    };
+
+// ------- local class: QueryPool ---------------------------------------
+
+/**
+* The threads shared by all parallel query evaluations. Each thread takes
+* the QueryWorkers submitted to the pool from a common queue; the pool
+* grows on demand to the configured number of threads, and its threads
+* exit once the pool is shut down.
+*/
+class COH_EXPORT QueryPool
+    : public class_spec<QueryPool,
+        extends<Object>,
+        implements<Runnable> >
+    {
+    friend class factory<QueryPool>;
+
+    // ----- constructors ---------------------------------------------------
+
+    protected:
+        QueryPool()
+            : f_hQueue(self(), DualQueue::create()),
+              f_hListThread(self(), ArrayList::create()),
+              f_vShutdown(self(), Object::create())
+            {
+            }
+
+    // ----- Runnable interface ---------------------------------------------
+
+    public:
+        virtual void run()
+            {
+            Queue::Handle  hQueue    = f_hQueue;
+            Object::View   vShutdown = f_vShutdown;
+            while (true)
+                {
+                Object::Holder ohTask = hQueue->remove();
+                if (ohTask == vShutdown)
+                    {
+                    return;
+                    }
+                // QueryWorker does not throw
+                cast<Runnable::Handle>(ohTask)->run();
+                }
+            }
+
+    // ----- QueryPool interface --------------------------------------------
+
+    public:
+        /**
+        * Queue the specified worker, first ensuring that the pool has at
+        * least the specified number of threads.
+        *
+        * @param hWorker   the worker
+        * @param cThreads  the number of threads required
+        */
+        void submit(QueryWorker::Handle hWorker, size32_t cThreads)
+            {
+            COH_SYNCHRONIZED (this)
+                {
+                List::Handle hListThread = f_hListThread;
+                for (size32_t c = hListThread->size(); c < cThreads; ++c)
+                    {
+                    Thread::Handle hThread = Thread::create(this,
+                            COH_TO_STRING("QueryWorker:" << c));
+                    hThread->start();
+                    hListThread->add(hThread);
+                    }
+                }
+            f_hQueue->add(hWorker);
+            }
+
+        /**
+        * Stop the threads of this pool and wait for them to exit.
+        *
+        * A worker submitted after this call is still evaluated, by the
+        * thread which submitted it.
+        */
+        void shutdown()
+            {
+            ObjectArray::Handle haThread;
+            COH_SYNCHRONIZED (this)
+                {
+                haThread = f_hListThread->toArray();
+                f_hListThread->clear();
+                for (size32_t i = 0; i < haThread->length; ++i)
+                    {
+                    f_hQueue->add(f_vShutdown);
+                    }
+                }
+
+            for (size32_t i = 0; i < haThread->length; ++i)
+                {
+                cast<Thread::Handle>(haThread[i])->join();
+                }
+            }
+
+        /**
+        * Return the pool shared by all parallel query evaluations,
+        * creating it if it does not exist.
+        *
+        * @return the QueryPool
+        */
+        static QueryPool::Handle ensureInstance()
+            {
+            COH_SYNCHRONIZED (getLock())
+                {
+                MemberHandle<QueryPool>& hPool = getInstanceRef();
+                if (NULL == hPool)
+                    {
+                    hPool = create();
+                    }
+                return hPool;
+                }
+            }
+
+        /**
+        * Shut down the pool shared by all parallel query evaluations, if it
+        * has been created. A later parallel evaluation creates a new pool.
+        */
+        static void shutdownInstance()
+            {
+            QueryPool::Handle hPool;
+            COH_SYNCHRONIZED (getLock())
+                {
+                MemberHandle<QueryPool>& hPoolRef = getInstanceRef();
+                hPool    = hPoolRef;
+                hPoolRef = NULL;
+                }
+
+            if (NULL != hPool)
+                {
+                hPool->shutdown();
+                }
+            }
+
+        /**
+        * Return the monitor which guards the creation and shut down of the
+        * shared pool.
+        *
+        * @return the monitor
+        */
+        static Object::Handle getLock()
+            {
+            static FinalHandle<Object> hLock(System::common(), Object::create());
+            return hLock;
+            }
+
+    protected:
+        /**
+        * Return the reference to the shared pool, which is NULL until a
+        * query is first evaluated in parallel.
+        *
+        * @return the reference to the QueryPool
+        */
+        static MemberHandle<QueryPool>& getInstanceRef()
+            {
+            static MemberHandle<QueryPool> hPool(*getLock());
+            return hPool;
+            }
+
+    // ----- data members ---------------------------------------------------
+
+    protected:
+        FinalHandle<Queue>  f_hQueue;
+        FinalHandle<List>   f_hListThread;
+        FinalView<Object>   f_vShutdown;
+    };
+COH_STATIC_INIT(QueryPool::getLock());
+
+/**
+* The minimum number of candidates evaluated in parallel, or zero.
+*/
+NativeAtomic32& getParallelThreshold()
+    {
+    static NativeAtomic32 s_atomicEntries(StringHelper::getCountProperty(
+            "coherence.query.parallel.threshold", 0));
+    return s_atomicEntries;
+    }
+COH_STATIC_INIT(getParallelThreshold());
+
+/**
+* The number of threads a parallel evaluation is split over.
+*/
+NativeAtomic32& getParallelThreads()
+    {
+    static NativeAtomic32 s_atomicThreads(std::max(1,
+            StringHelper::getCountProperty("coherence.query.parallel.threads", 4)));
+    return s_atomicThreads;
+    }
+COH_STATIC_INIT(getParallelThreads());
+
 COH_CLOSE_NAMESPACE_ANON
 
 // ----- InvocableMapHelper interface ---------------------------------------
@@ -229,21 +536,12 @@ Set::View InvocableMapHelper::query(Map::View vMap, Map::View vMapIndexes,
     else
         {
         // we still have a filter to evaluate or we need an entry set
-        for (size32_t i = 0, c = haoResult->length; i < c; i++)
-            {
-            Object::View   vKey   = haoResult[i];
-            Object::Holder hValue = vMap->get(vKey);
-
-            if (hValue != NULL || vMap->containsKey(vKey))
-                {
-                Map::Entry::View vEntry = SimpleMapEntry::create(vKey, hValue);
-                if (vFilter == NULL || evaluateEntry(vFilter, vEntry))
-                    {
-                    haoResult[cResults++] = fEntries ? (Object::Holder) vEntry :
-                            (Object::Holder) vKey;
-                    }
-                }
-            }
+        size32_t cThreshold = getParallelQueryThreshold();
+        cResults = vFilter != NULL && cThreshold > 0 &&
+                haoResult->length >= cThreshold && getParallelQueryThreads() > 1
+                ? evaluateParallel(vMap, vFilter, fEntries, haoResult)
+                : evaluateRange(vMap, vFilter, fEntries, haoResult, 0,
+                        haoResult->length);
         }
 
     LimitFilter::View vFilterLimit = instanceof<LimitFilter::View>(vFilterOrig) ?
@@ -284,6 +582,32 @@ Set::View InvocableMapHelper::query(Map::View vMap, Map::View vMapIndexes,
     return ReadOnlyArrayList::create(haoResult, 0, cResults)->getSet();
     }
 
+size32_t InvocableMapHelper::getParallelQueryThreshold()
+    {
+    return (size32_t) getParallelThreshold().get();
+    }
+
+void InvocableMapHelper::setParallelQueryThreshold(size32_t cEntries)
+    {
+    getParallelThreshold().set((int32_t) std::min(cEntries, (size32_t) 0x7FFFFFFF));
+    }
+
+size32_t InvocableMapHelper::getParallelQueryThreads()
+    {
+    return (size32_t) getParallelThreads().get();
+    }
+
+void InvocableMapHelper::setParallelQueryThreads(size32_t cThreads)
+    {
+    getParallelThreads().set((int32_t) std::max((size32_t) 1,
+            std::min(cThreads, (size32_t) 1024)));
+    }
+
+void InvocableMapHelper::shutdownParallelQueries()
+    {
+    QueryPool::shutdownInstance();
+    }
+
 void InvocableMapHelper::addIndex(ValueExtractor::View vExtractor,
         bool fOrdered, Comparator::View vComparator,
         ObservableMap::Handle hMap, Map::Handle hMapIndex)
@@ -402,6 +726,81 @@ void InvocableMapHelper::updateEntry(ValueUpdater::View vUpdater,
 
 // ------------- helpers ----------------------------------------------------
 
+size32_t InvocableMapHelper::evaluateRange(Map::View vMap,
+        Filter::View vFilter, bool fEntries, ObjectArray::Handle haoResult,
+        size32_t iFrom, size32_t iTo)
+    {
+    size32_t iMatch = iFrom;
+    for (size32_t i = iFrom; i < iTo; i++)
+        {
+        Object::View   vKey   = haoResult[i];
+        Object::Holder hValue = vMap->get(vKey);
+
+        if (hValue != NULL || vMap->containsKey(vKey))
+            {
+            Map::Entry::View vEntry = SimpleMapEntry::create(vKey, hValue);
+            if (vFilter == NULL || evaluateEntry(vFilter, vEntry))
+                {
+                haoResult[iMatch++] = fEntries ? (Object::Holder) vEntry :
+                        (Object::Holder) vKey;
+                }
+            }
+        }
+    return iMatch - iFrom;
+    }
+
+size32_t InvocableMapHelper::evaluateParallel(Map::View vMap,
+        Filter::View vFilter, bool fEntries, ObjectArray::Handle haoResult)
+    {
+    size32_t cKeys    = haoResult->length;
+    size32_t cThreads = std::min(getParallelQueryThreads(), cKeys);
+    size32_t cSlice   = (cKeys + cThreads - 1) / cThreads;
+
+    // the calling thread evaluates the first slice itself, then any
+    // slice which no pool thread has yet picked up
+    QueryPool::Handle   hPool    = QueryPool::ensureInstance();
+    ObjectArray::Handle haWorker = ObjectArray::create(cThreads);
+    for (size32_t i = 0; i < cThreads; ++i)
+        {
+        size32_t iFrom = std::min(i * cSlice, cKeys);
+        QueryWorker::Handle hWorker = QueryWorker::create(vMap, vFilter,
+                fEntries, haoResult, iFrom, std::min(iFrom + cSlice, cKeys));
+        haWorker[i] = hWorker;
+        if (i > 0)
+            {
+            hPool->submit(hWorker, cThreads - 1);
+            }
+        }
+
+    for (size32_t i = 0; i < cThreads; ++i)
+        {
+        cast<QueryWorker::Handle>(haWorker[i])->run();
+        }
+    for (size32_t i = 1; i < cThreads; ++i)
+        {
+        cast<QueryWorker::View>(haWorker[i])->await();
+        }
+
+    // merge the matches of each slice
+    size32_t cResults = 0;
+    for (size32_t i = 0; i < cThreads; ++i)
+        {
+        QueryWorker::View vWorker = cast<QueryWorker::View>(haWorker[i]);
+        Exception::View   vEx     = vWorker->getException();
+        if (vEx != NULL)
+            {
+            COH_THROW (vEx);
+            }
+
+        for (size32_t j = vWorker->getFrom(), c = j + vWorker->getMatches();
+                j < c; ++j)
+            {
+            haoResult[cResults++] = haoResult[j];
+            }
+        }
+    return cResults;
+    }
+
 MapListener::Handle InvocableMapHelper::ensureListener(MapIndex::Handle hIndex)
     {
     return instanceof<MapListenerSupport::SynchronousListener::Handle>(hIndex)
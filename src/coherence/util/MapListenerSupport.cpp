@@ -553,6 +553,11 @@ bool MapListenerSupport::isPrimingListener(MapListener::View listener)
     return instanceof<MapListenerSupport::PrimingListener::View>(unwrapListener(listener));
     }
 
+bool MapListenerSupport::isSemiLiteListener(MapListener::View vListener)
+    {
+    return instanceof<MapListenerSupport::SemiLiteListener::View>(unwrapListener(vListener));
+    }
+
 // ----- helper methods -----------------------------------------------------
 
 bool MapListenerSupport::evaluateEvent(Filter::View vFilter, MapEvent::View vEvent)
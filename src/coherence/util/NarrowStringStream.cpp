@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2000, 2026, Oracle and/or its affiliates.
+ *
+ * Licensed under the Universal Permissive License v 1.0 as shown at
+ * http://oss.oracle.com/licenses/upl.
+ */
+#include "private/coherence/util/NarrowStringStream.hpp"
+
+#include <cstring>
+
+COH_OPEN_NAMESPACE2(coherence,util)
+
+
+// ----- constructors -------------------------------------------------------
+
+NarrowStringStream::NarrowStringStream()
+    : std::ostream(NULL)
+    {
+    rdbuf(&m_buf);
+    }
+
+
+// ----- nested class: Buffer -----------------------------------------------
+
+NarrowStringStream::Buffer::Buffer()
+    {
+    setp(m_ach, m_ach + buffer_size);
+    }
+
+String::Handle NarrowStringStream::Buffer::toString()
+    {
+    size_t cch = pptr() - pbase();
+    if (m_sOverflow.empty())
+        {
+        // common case; the content never left the fixed buffer
+        return String::create(m_ach, size32_t(cch));
+        }
+
+    spill();
+    return String::create(m_sOverflow);
+    }
+
+NarrowStringStream::Buffer::int_type NarrowStringStream::Buffer::overflow(
+        int_type ch)
+    {
+    spill();
+    if (!traits_type::eq_int_type(ch, traits_type::eof()))
+        {
+        *pptr() = traits_type::to_char_type(ch);
+        pbump(1);
+        }
+    return traits_type::not_eof(ch);
+    }
+
+std::streamsize NarrowStringStream::Buffer::xsputn(const char* ach,
+        std::streamsize cch)
+    {
+    if (cch <= epptr() - pptr())
+        {
+        std::memcpy(pptr(), ach, size_t(cch));
+        pbump(int(cch));
+        }
+    else
+        {
+        spill();
+        m_sOverflow.append(ach, size_t(cch));
+        }
+    return cch;
+    }
+
+void NarrowStringStream::Buffer::spill()
+    {
+    m_sOverflow.append(pbase(), pptr() - pbase());
+    setp(m_ach, m_ach + buffer_size);
+    }
+
+COH_CLOSE_NAMESPACE2
@@ -0,0 +1,289 @@
+/*
+ * Copyright (c) 2000, 2026, Oracle and/or its affiliates.
+ *
+ * Licensed under the Universal Permissive License v 1.0 as shown at
+ * http://oss.oracle.com/licenses/upl.
+ */
+#include "coherence/util/SingleConsumerQueue.hpp"
+
+#include "coherence/util/LinkedList.hpp"
+
+COH_OPEN_NAMESPACE2(coherence,util)
+
+
+// ----- nested class: Node -------------------------------------------------
+
+/**
+* A node in the linked list. Nodes are not Objects; each keeps an escaped
+* attachment to its element from the time it is added by a producer until
+* the consumer removes it.
+*/
+class SingleConsumerQueue::Node
+    {
+    public:
+        Node(Object::Holder oh)
+            : m_lNext(0, /*fAtomic*/ false), m_cpo(NULL), m_fView(true)
+            {
+            if (NULL != oh)
+                {
+                // the element is about to become visible to another thread
+                if (is_handle(oh))
+                    {
+                    m_cpo   = const_cast<Object*>(get_pointer(oh))->_attach(
+                            /*fEscaped*/ true);
+                    m_fView = false;
+                    }
+                if (NULL == m_cpo)
+                    {
+                    m_cpo   = get_pointer(oh)->_attach(/*fEscaped*/ true);
+                    m_fView = true;
+                    }
+                }
+            }
+
+        ~Node()
+            {
+            release();
+            }
+
+        Node* getNext() const
+            {
+            return (Node*) (size_t) m_lNext.getAcquire();
+            }
+
+        void setNext(Node* pNext)
+            {
+            m_lNext.setRelease((int64_t) (size_t) pNext);
+            }
+
+        Object::Holder getElement() const
+            {
+            const Object* cpo = m_cpo;
+            if (NULL == cpo)
+                {
+                return NULL;
+                }
+            if (m_fView)
+                {
+                return Object::View(cpo);
+                }
+            return Object::Handle(const_cast<Object*>(cpo));
+            }
+
+        void release()
+            {
+            const Object* cpo = m_cpo;
+            if (NULL != cpo)
+                {
+                m_cpo = NULL;
+                if (m_fView)
+                    {
+                    cpo->_detach(/*fEscaped*/ true);
+                    }
+                else
+                    {
+                    const_cast<Object*>(cpo)->_detach(/*fEscaped*/ true);
+                    }
+                }
+            }
+
+    private:
+        NativeAtomic64 m_lNext;
+        const Object*  m_cpo;
+        bool           m_fView;
+    };
+
+
+// ----- constructors -------------------------------------------------------
+
+SingleConsumerQueue::SingleConsumerQueue()
+    : m_pHead(new Node(NULL)),
+      m_lTail((int64_t) (size_t) m_pHead),
+      f_hListHead(self(), LinkedList::create()),
+      m_cHead(0),
+      m_cSpin(100)
+    {
+    }
+
+SingleConsumerQueue::~SingleConsumerQueue()
+    {
+    Node* pNode = m_pHead;
+    while (NULL != pNode)
+        {
+        Node* pNext = pNode->getNext();
+        delete pNode;
+        pNode = pNext;
+        }
+    }
+
+
+// ----- SingleConsumerQueue interface --------------------------------------
+
+int32_t SingleConsumerQueue::getSpinCount() const
+    {
+    return m_cSpin;
+    }
+
+void SingleConsumerQueue::setSpinCount(int32_t cSpin)
+    {
+    m_cSpin = cSpin < 0 ? 0 : cSpin;
+    }
+
+
+// ----- AbstractConcurrentQueue interface ----------------------------------
+
+void SingleConsumerQueue::waitForEntry(int64_t cMillis)
+    {
+    // elements tend to arrive in bursts; briefly re-check before paying for
+    // a park and the producer's notification
+    for (int32_t i = 0, c = getSpinCount(); i < c && isEmpty(); ++i)
+        {
+        Thread::yield();
+        }
+    super::waitForEntry(cMillis);
+    }
+
+
+// ----- Queue interface ----------------------------------------------------
+
+bool SingleConsumerQueue::add(Object::Holder oh)
+    {
+    if (NULL == oh)
+        {
+        COH_THROW (IllegalArgumentException::create(
+                "The ConcurrentQueue does not support null values."));
+        }
+
+    Node* pNode = new Node(oh);
+
+    // swap the tail, then link the previous tail to the new node; until it
+    // is linked the consumer will wait in getFirstNode
+    int64_t lNode   = (int64_t) (size_t) pNode;
+    int64_t lActual = m_lTail.peek();
+    int64_t lAssume;
+    do
+        {
+        lAssume = lActual;
+        lActual = m_lTail.update(lAssume, lNode);
+        }
+    while (lAssume != lActual);
+
+    ((Node*) (size_t) lActual)->setNext(pNode);
+
+    onAddElement();
+    return true;
+    }
+
+bool SingleConsumerQueue::addHead(Object::Holder oh)
+    {
+    if (NULL == oh)
+        {
+        COH_THROW (IllegalArgumentException::create(
+                "The ConcurrentQueue does not support null values."));
+        }
+
+    List::Handle hListHead = f_hListHead;
+    COH_SYNCHRONIZED (hListHead)
+        {
+        hListHead->add(0, oh);
+        m_cHead.adjust(1);
+        }
+
+    onAddElement();
+    return true;
+    }
+
+bool SingleConsumerQueue::isEmpty() const
+    {
+    return size() == 0;
+    }
+
+Object::Holder SingleConsumerQueue::peekNoWait()
+    {
+    if (m_nElementCounter.get() == 0)
+        {
+        return NULL;
+        }
+
+    if (m_cHead.get() > 0)
+        {
+        List::Handle hListHead = f_hListHead;
+        COH_SYNCHRONIZED (hListHead)
+            {
+            if (!hListHead->isEmpty())
+                {
+                return hListHead->get(0);
+                }
+            }
+        }
+
+    Node* pFirst = getFirstNode();
+    return NULL == pFirst ? (Object::Holder) NULL : pFirst->getElement();
+    }
+
+Object::Holder SingleConsumerQueue::removeNoWait()
+    {
+    if (m_nElementCounter.get() == 0)
+        {
+        return NULL;
+        }
+
+    Object::Holder ohEntry;
+    if (m_cHead.get() > 0)
+        {
+        List::Handle hListHead = f_hListHead;
+        COH_SYNCHRONIZED (hListHead)
+            {
+            if (!hListHead->isEmpty())
+                {
+                ohEntry = hListHead->remove(0);
+                m_cHead.adjust(-1);
+                }
+            }
+        }
+
+    if (NULL == ohEntry)
+        {
+        Node* pFirst = getFirstNode();
+        if (NULL == pFirst)
+            {
+            return NULL;
+            }
+
+        // the first node becomes the new stub
+        Node* pHead = m_pHead;
+        ohEntry  = pFirst->getElement();
+        pFirst->release();
+        m_pHead  = pFirst;
+        delete pHead;
+        }
+
+    if (m_nElementCounter.adjust(-1) == 0)
+        {
+        onEmpty();
+        }
+
+    return ohEntry;
+    }
+
+
+// ----- internal helpers ---------------------------------------------------
+
+SingleConsumerQueue::Node* SingleConsumerQueue::getFirstNode() const
+    {
+    Node* pHead  = m_pHead;
+    Node* pFirst = pHead->getNext();
+    while (NULL == pFirst)
+        {
+        if (m_nElementCounter.get() - m_cHead.get() <= 0)
+            {
+            return NULL;
+            }
+        // a producer has swapped the tail but not yet linked its node
+        Thread::yield();
+        pFirst = pHead->getNext();
+        }
+    return pFirst;
+    }
+
+COH_CLOSE_NAMESPACE2
@@ -7,6 +7,9 @@
 #include "private/coherence/util/StringHelper.hpp"
 #include "coherence/util/ArrayList.hpp"
 
+#include "private/coherence/util/logging/Logger.hpp"
+
+#include <algorithm>
 #include <sstream>
 #include <iostream>
 
@@ -634,6 +637,24 @@ int64_t StringHelper::parseMemorySize(String::View vS, int32_t nDefaultPower)
     return cb;
     }
 
+int32_t StringHelper::getCountProperty(String::View vsName, int32_t nDefault)
+    {
+    String::View vsValue = System::getProperty(vsName);
+    if (NULL != vsValue)
+        {
+        try
+            {
+            return std::max(0, Integer32::parse(vsValue->trim()));
+            }
+        catch (Exception::View)
+            {
+            COH_LOG("Ignoring invalid " << vsName << " value \""
+                    << vsValue << "\"", logging::Logger::level_warning);
+            }
+        }
+    return nDefault;
+    }
+
 int32_t StringHelper::getMaxDecDigits(int32_t n)
     {
     int32_t cDigits = 0;
@@ -17,6 +17,9 @@
 
 #include "private/coherence/util/StringHelper.hpp"
 
+#include <cctype>
+#include <cstring>
+
 COH_OPEN_NAMESPACE3(coherence,util,filter)
 
 COH_REGISTER_PORTABLE_CLASS(77, LikeFilter);
@@ -155,6 +158,67 @@ namespace
             }
         return hach;
         }
+
+    /**
+    * Compare two runs of ASCII characters, ignoring case.
+    *
+    * @param achA  the first characters
+    * @param achB  the second characters
+    * @param cch   the number of characters to compare
+    *
+    * @return true iff the characters are equal ignoring case
+    */
+    bool regionMatchesASCII(const char* achA, const char* achB, size32_t cch)
+        {
+        for (size32_t i = 0; i < cch; ++i)
+            {
+            char chA = achA[i];
+            char chB = achB[i];
+            if (chA != chB && tolower(chA) != tolower(chB))
+                {
+                return false;
+                }
+            }
+        return true;
+        }
+
+    /**
+    * Find the first occurrence of a literal run of characters, using memchr
+    * to skip to the candidate positions.
+    *
+    * @param ach      the characters to search
+    * @param cch      the number of characters to search
+    * @param achPart  the characters to find
+    * @param cchPart  the number of characters to find; at least one
+    *
+    * @return the index of the first occurrence, or Array<char>::npos
+    */
+    size32_t findLiteral(const char* ach, size32_t cch, const char* achPart,
+            size32_t cchPart)
+        {
+        if (cchPart > cch)
+            {
+            return Array<char>::npos;
+            }
+
+        const char* pch    = ach;
+        const char* pchEnd = ach + (cch - cchPart) + 1; // last start + 1
+        char        chFirst = achPart[0];
+        while (pch < pchEnd)
+            {
+            pch = (const char*) memchr(pch, chFirst, pchEnd - pch);
+            if (NULL == pch)
+                {
+                break;
+                }
+            if (memcmp(pch + 1, achPart + 1, cchPart - 1) == 0)
+                {
+                return (size32_t) (pch - ach);
+                }
+            ++pch;
+            }
+        return Array<char>::npos;
+        }
     }
 
 
@@ -695,51 +759,59 @@ bool LikeFilter::isMatch(String::View vsValue) const
            "Strings must be ASCII"));
         }
 
-    size32_t cchValue = vsValue->length();
+    // both the pattern and the value are ASCII, so the value's octets can
+    // be scanned directly, one per character
+    const char* achValue = vsValue->getCString();
+    size32_t    cchValue = vsValue->length();
     switch (m_nPlan)
         {
         case STARTS_WITH_CHAR:
-            return cchValue >= 1 && vsValue->getOctets()[0] == m_chPart;
+            return cchValue >= 1 && achValue[0] == m_chPart;
 
         case STARTS_WITH_STRING:
-            return vsValue->startsWith(m_vsPart);
+            {
+            String::View vsPrefix  = m_vsPart;
+            size32_t     cchPrefix = vsPrefix->length();
+            return cchPrefix <= cchValue &&
+                    memcmp(achValue, vsPrefix->getCString(), cchPrefix) == 0;
+            }
 
         case STARTS_WITH_INSENS:
             {
             String::View vsPrefix  = m_vsPart;
             size32_t     cchPrefix = vsPrefix->length();
-            if (cchPrefix > cchValue)
-                {
-                return false;
-                }
-            return StringHelper::regionMatches(vsValue, 0,
-                    vsPrefix, 0, cchPrefix, true);
+            return cchPrefix <= cchValue && regionMatchesASCII(achValue,
+                    vsPrefix->getCString(), cchPrefix);
             }
 
         case ENDS_WITH_CHAR:
-            return cchValue >= 1
-                && vsValue->getOctets()[cchValue - 1] == m_chPart;
+            return cchValue >= 1 && achValue[cchValue - 1] == m_chPart;
 
         case ENDS_WITH_STRING:
-            return vsValue->endsWith(m_vsPart);
+            {
+            String::View vsSuffix  = m_vsPart;
+            size32_t     cchSuffix = vsSuffix->length();
+            return cchSuffix <= cchValue && memcmp(achValue + cchValue -
+                    cchSuffix, vsSuffix->getCString(), cchSuffix) == 0;
+            }
 
         case ENDS_WITH_INSENS:
             {
-            String::View vsSuffix   = m_vsPart;
-            size32_t     cchSuffix  = vsSuffix->length();
-            if (cchSuffix > cchValue)
-                {
-                return false;
-                }
-            return StringHelper::regionMatches(vsValue, cchValue - cchSuffix,
-                    vsSuffix, 0, cchSuffix, true);
+            String::View vsSuffix  = m_vsPart;
+            size32_t     cchSuffix = vsSuffix->length();
+            return cchSuffix <= cchValue && regionMatchesASCII(achValue +
+                    cchValue - cchSuffix, vsSuffix->getCString(), cchSuffix);
             }
 
         case CONTAINS_CHAR:
-            return vsValue->indexOf(m_chPart) != String::npos;
+            return cchValue >= 1 && NULL != memchr(achValue, m_chPart, cchValue);
 
         case CONTAINS_STRING:
-            return vsValue->indexOf(m_vsPart) != String::npos;
+            {
+            String::View vsPart = m_vsPart;
+            return findLiteral(achValue, cchValue, vsPart->getCString(),
+                    vsPart->length()) != Array<char>::npos;
+            }
 
         case ALWAYS_TRUE:
             return true;
@@ -751,14 +823,18 @@ bool LikeFilter::isMatch(String::View vsValue) const
             return m_vsPart->equals(vsValue);
 
         case INSENS_MATCH:
-            return StringHelper::compare(m_vsPart, vsValue, false) == 0;
+            {
+            String::View vsPart = m_vsPart;
+            return vsPart->length() == cchValue &&
+                    regionMatchesASCII(achValue, vsPart->getCString(), cchValue);
+            }
         }
 
-    // get the character data and iteratively process the LIKE
-    Array<char>::View vach    = toChar8Array(vsValue);
-    size32_t          cch     = vach->length;
-    size32_t          ofBegin = 0;
-    size32_t          ofEnd   = cch;
+    // iteratively process the LIKE over the value's characters
+    const char* ach     = achValue;
+    size32_t    cch     = cchValue;
+    size32_t    ofBegin = 0;
+    size32_t    ofEnd   = cch;
 
     // start by checking the front
     LikeFilter::MatchStep::View vMatchStep = m_vStepFront;
@@ -766,7 +842,7 @@ bool LikeFilter::isMatch(String::View vsValue) const
         {
         size32_t cchStep = vMatchStep->getLength();
         if (cchStep > cch ||
-                vMatchStep->indexOf(vach, ofBegin, cchStep)
+                vMatchStep->indexOf(ach, ofBegin, cchStep)
                     == Array<char>::npos)
             {
             return false;
@@ -783,8 +859,8 @@ bool LikeFilter::isMatch(String::View vsValue) const
         {
         size32_t cchStep = vMatchStep->getLength();
         size32_t ofStep  = cch - cchStep;
-        if (ofStep < ofBegin ||
-                vMatchStep->indexOf(vach, ofStep, ofEnd)
+        if (cchStep > cch || ofStep < ofBegin ||
+                vMatchStep->indexOf(ach, ofStep, ofEnd)
                     == Array<char>::npos)
             {
             return false;
@@ -802,7 +878,7 @@ bool LikeFilter::isMatch(String::View vsValue) const
         for (size32_t i = 0, c = vaMatchStep->length; i < c; ++i)
             {
             vMatchStep = cast<MatchStep::View>(vaMatchStep[i]);
-            size32_t of = vMatchStep->indexOf(vach, ofBegin, ofEnd);
+            size32_t of = vMatchStep->indexOf(ach, ofBegin, ofEnd);
             if (of == Array<char>::npos)
                 {
                 return false;
@@ -914,7 +990,14 @@ LikeFilter::MatchStep::MatchStep(String::View vsMatch, HashSet::View hBitset,
 size32_t LikeFilter::MatchStep::indexOf(Array<char>::View vach,
         size32_t ofBegin, size32_t ofEnd) const
     {
+    return indexOf((const char*) vach->raw, ofBegin, ofEnd);
+    }
+
+size32_t LikeFilter::MatchStep::indexOf(const char* ach, size32_t ofBegin,
+        size32_t ofEnd) const
+    {
     Array<char>::View vachMatch = m_vachMatch;
+    const char*       achMatch  = vachMatch->raw;
     size32_t          cchMatch  = vachMatch->length;
     size32_t          cch       = ofEnd - ofBegin;
 
@@ -941,108 +1024,77 @@ size32_t LikeFilter::MatchStep::indexOf(Array<char>::View vach,
     ofEnd    -= cchMatch;      // determine last offset that allows it to fit
     cchMatch -= m_cchSkipBack; // don't bother matching trailing wilds
 
-    bool              fMiddleWilds = m_fMiddleWilds;
-    Array<bool>::View vafAny       = m_vafAny;
+    Array<bool>::View vafAny = m_vafAny;
+    const bool*       afAny  = m_fMiddleWilds ? (const bool*) vafAny->raw : NULL;
 
     if (m_fIsIgnoreCase)
         {
         // processed in an equivalent way to String.equalsIngoreCase()
-        Array<char>::View vachLower     = m_vachLower;
-        char              chFirstUpper  = vachMatch[cchSkipFront];
-        char              chFirstLower  = vachLower[cchSkipFront];
-        NextChar: for ( ; ofBegin <= ofEnd; ++ofBegin)
+        const char* achLower     = m_vachLower->raw;
+        char        chFirstUpper = achMatch[cchSkipFront];
+        char        chFirstLower = achLower[cchSkipFront];
+        for ( ; ofBegin <= ofEnd; ++ofBegin)
             {
-            char ch = vach[ofBegin];
+            char ch = ach[ofBegin];
             if (ch == chFirstUpper || ch == chFirstLower)
                 {
-                if (fMiddleWilds)
+                size32_t ofMatch = cchSkipFront + 1;
+                size32_t ofCur   = ofBegin + 1;
+                for ( ; ofMatch < cchMatch; ++ofMatch, ++ofCur)
                     {
-                    for (size32_t ofMatch = cchSkipFront + 1,
-                            ofCur = ofBegin + 1;
-                            ofMatch < cchMatch; ++ofMatch, ++ofCur)
+                    if (NULL == afAny || !afAny[ofMatch])
                         {
-                        if (!vafAny[ofMatch])
+                        ch = ach[ofCur];
+                        if (ch != achMatch[ofMatch] && ch != achLower[ofMatch])
                             {
-                            ch = vach[ofCur];
-                            if (ch != vachMatch[ofMatch]
-                                               && ch != vachLower[ofMatch])
-                                {
-                                // c++ does not have continue NextChar so
-                                // we must increment ofBegin
-                                ++ofBegin;
-                                goto NextChar;
-                                }
+                            break;
                             }
                         }
                     }
-                else
+
+                if (ofMatch == cchMatch)
                     {
-                    for (size32_t ofMatch = cchSkipFront + 1,
-                            ofCur = ofBegin + 1;
-                            ofMatch < cchMatch; ++ofMatch, ++ofCur)
-                        {
-                        ch = vach[ofCur];
-                        if (ch != vachMatch[ofMatch]
-                                           && ch != vachLower[ofMatch])
-                            {
-                            // c++ does not have continue NextChar so
-                            // we must increment ofBegin
-                            ++ofBegin;
-                            goto NextChar;
-                            }
-                        }
+                    // found it; adjust for the leading wilds that
+                    // we skipped matching
+                    return ofBegin - cchSkipFront;
                     }
-
-                // found it; adjust for the leading wilds that
-                // we skipped matching
-                return ofBegin - cchSkipFront;
                 }
             }
         }
     else
         {
-        // scan for a match
-        char chFirst = vachMatch[cchSkipFront];
-        NextChar2: for ( ; ofBegin <= ofEnd; ++ofBegin)
+        // let memchr find each candidate for the first literal character
+        char        chFirst = achMatch[cchSkipFront];
+        const char* pch     = ach + ofBegin;
+        const char* pchEnd  = ach + ofEnd + 1;
+        while (pch < pchEnd &&
+                NULL != (pch = (const char*) memchr(pch, chFirst, pchEnd - pch)))
             {
-             if (vach[ofBegin] == chFirst)
+            size32_t ofCur = (size32_t) (pch - ach);
+            if (NULL == afAny)
                 {
-                if (fMiddleWilds)
+                if (memcmp(pch + 1, achMatch + cchSkipFront + 1,
+                        cchMatch - cchSkipFront - 1) == 0)
                     {
-                    for (size32_t ofMatch = cchSkipFront + 1,
-                            ofCur = ofBegin + 1;
-                            ofMatch < cchMatch; ++ofMatch, ++ofCur)
-                        {
-                        if (!vafAny[ofMatch]
-                                   && vachMatch[ofMatch] != vach[ofCur])
-                            {
-                            // c++ does not have continue NextChar so
-                            // we must increment ofBegin
-                            ++ofBegin;
-                            goto NextChar2;
-                            }
-                        }
+                    return ofCur - cchSkipFront;
                     }
-                else
+                }
+            else
+                {
+                size32_t ofMatch = cchSkipFront + 1;
+                for (++ofCur; ofMatch < cchMatch; ++ofMatch, ++ofCur)
                     {
-                    for (size32_t ofMatch = cchSkipFront + 1,
-                            ofCur = ofBegin + 1;
-                            ofMatch < cchMatch; ++ofMatch, ++ofCur)
+                    if (!afAny[ofMatch] && achMatch[ofMatch] != ach[ofCur])
                         {
-                         if (vachMatch[ofMatch] != vach[ofCur])
-                            {
-                            // c++ does not have continue NextChar so
-                            // we must increment ofBegin
-                            ++ofBegin;
-                            goto NextChar2;
-                            }
+                        break;
                         }
                     }
-
-                // found it; adjust for the leading wilds that
-                // we skipped matching
-                return ofBegin - cchSkipFront;
+                if (ofMatch == cchMatch)
+                    {
+                    return (size32_t) (pch - ach) - cchSkipFront;
+                    }
                 }
+            ++pch;
             }
         }
 
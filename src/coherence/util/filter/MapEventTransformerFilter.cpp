@@ -75,7 +75,7 @@ bool MapEventTransformerFilter::equals(Object::View v) const
         cast<MapEventTransformerFilter::View>(v,false);
     if (NULL != that)
         {
-        return f_vFilter->equals(that->f_vFilter)
+        return Object::equals(f_vFilter, that->f_vFilter)
               && f_vTransformer->equals(that->f_vTransformer);
         }
     return false;
@@ -6,6 +6,8 @@
  */
 #include "private/coherence/util/logging/Logger.hpp"
 
+#include "coherence/util/SingleConsumerQueue.hpp"
+
 #include "private/coherence/util/Date.hpp"
 #include "private/coherence/run/xml/SimpleElement.hpp"
 #include "private/coherence/util/logging/LogOutput.hpp"
@@ -19,6 +21,7 @@ COH_OPEN_NAMESPACE3(coherence,util,logging)
 
 using coherence::run::xml::SimpleElement;
 using coherence::util::Date;
+using coherence::util::SingleConsumerQueue;
 using coherence::util::StringHelper;
 
 
@@ -251,7 +254,10 @@ Logger::Logger()
       m_vasParameters(self(), getDefaultParameters()),
       m_vsProduct(self(), String::create(COH_SYMB_TO_STRING(COH_PRODUCT))),
       m_vsVersion(self(), String::create(COH_SYMB_TO_STRING(COH_VERSION))),
-      m_vsEdition(self(), "n/a")
+      m_vsEdition(self(), "n/a"),
+      m_cQueueLimit(getDefaultQueueLimit()),
+      f_hCountDropped(self(), AtomicCounter::create()),
+      m_cDroppedReported(0)
     {
     }
 
@@ -296,6 +302,12 @@ int32_t Logger::getDefaultLimit()
             System::getProperty("coherence.log.limit", "1048576"));
     }
 
+int32_t Logger::getDefaultQueueLimit()
+    {
+    return Integer32::parse(
+            System::getProperty("coherence.log.queue.limit", "0"));
+    }
+
 namespace
     {
     ObjectArray::View _createDefaultParameters()
@@ -359,6 +371,21 @@ void Logger::setLimit(int32_t iLimit)
     m_cCharLimit = iLimit;
     }
 
+int32_t Logger::getQueueLimit() const
+    {
+    return m_cQueueLimit;
+    }
+
+void Logger::setQueueLimit(int32_t cMessages)
+    {
+    m_cQueueLimit = cMessages;
+    }
+
+int64_t Logger::getDroppedCount() const
+    {
+    return f_hCountDropped->getCount();
+    }
+
 ObjectArray::View Logger::getParameters() const
     {
     return m_vasParameters;
@@ -513,10 +540,16 @@ void Logger::log(int32_t nLevel, Exception::View vEx, String::View vsMessage,
 
     if (nLevel <= m_nLogLevel)
         {
-        ObjectArray::Handle hoaMsg =
-                createMessage(nLevel, vEx, vsMessage, vaoParams);
+        Queue::Handle hQueue = getQueue();
+        int32_t       cLimit = m_cQueueLimit;
+        if (cLimit > 0 && hQueue->size() >= (size32_t) cLimit)
+            {
+            // the logger thread is falling behind; drop rather than queue
+            f_hCountDropped->increment();
+            return;
+            }
 
-        getQueue()->add(hoaMsg);
+        hQueue->add(createMessage(nLevel, vEx, vsMessage, vaoParams));
         }
     }
 
@@ -691,6 +724,14 @@ void Logger::onLog()
     {
     }
 
+
+// ----- QueueProcessor interface -------------------------------------------
+
+Queue::Handle Logger::instantiateQueue() const
+    {
+    return SingleConsumerQueue::create();
+    }
+
 void Logger::onNotify()
     {
     const int32_t MAX_TOTAL      = getLimit();
@@ -725,6 +766,21 @@ void Logger::onNotify()
                         cchTruncate << ")");
                 fDone = true;
                 }
+            else if (f_hCountDropped->getCount() > m_cDroppedReported)
+                {
+                int64_t cDropped = f_hCountDropped->getCount();
+                haoMessage = ObjectArray::create(6);
+                haoMessage[0] = Date::create();
+                haoMessage[1] = Integer64::create(System::upTimeMillis());
+                haoMessage[2] = boxLogLevel(level_warning);
+                haoMessage[3] = Thread::currentThread();
+                haoMessage[4] = NULL;
+                haoMessage[5] = COH_TO_STRING(
+                        "Asynchronous logging queue limit exceeded; " <<
+                        "dropped " << (cDropped - m_cDroppedReported) <<
+                        " log messages (limit=" << getQueueLimit() << ")");
+                m_cDroppedReported = cDropped;
+                }
             else
                 {
                 // Queue is empty, exit loop.
@@ -17,6 +17,7 @@
 #include "coherence/io/pof/PofReader.hpp"
 #include "coherence/io/pof/PofWriter.hpp"
 #include "coherence/net/Invocable.hpp"
+#include "coherence/net/InvocationObserver.hpp"
 #include "coherence/net/InvocationService.hpp"
 #include "coherence/net/MemberEvent.hpp"
 #include "coherence/net/MemberListener.hpp"
@@ -79,6 +80,7 @@ using coherence::io::pof::PofReader;
 using coherence::io::pof::PofWriter;
 using coherence::net::CacheService;
 using coherence::net::Invocable;
+using coherence::net::InvocationObserver;
 using coherence::net::InvocationService;
 using coherence::net::MemberEvent;
 using coherence::net::MemberListener;
@@ -2219,6 +2221,15 @@ class MockSafeCacheService
                         getObjectReturn());
                 }
 
+            virtual void execute(Invocable::Handle hTask, Set::View vSetMembers,
+                    InvocationObserver::Handle hObserver)
+                {
+                setExpectation(invocation("void execute(Invocable::Handle hTask, Set::View vSetMembers, InvocationObserver::Handle hObserver)")->
+                        withObjectArgument(hTask)->
+                        withObjectArgument(vSetMembers)->
+                        withObjectArgument(hObserver));
+                }
+
             virtual void configure(XmlElement::View vXml)
                 {
                 setExpectation(invocation("void configure(XmlElement::View vXml)")->withObjectArgument(vXml));
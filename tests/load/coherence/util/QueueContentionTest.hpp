@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2000, 2026, Oracle and/or its affiliates.
+ *
+ * Licensed under the Universal Permissive License v 1.0 as shown at
+ * http://oss.oracle.com/licenses/upl.
+ */
+
+#include "cxxtest/TestSuite.h"
+#include "coherence/lang.ns"
+
+#include "coherence/util/AbstractConcurrentQueue.hpp"
+#include "coherence/util/DualQueue.hpp"
+#include "coherence/util/SingleConsumerQueue.hpp"
+
+#include <iostream>
+
+using namespace coherence::lang;
+using namespace std;
+using coherence::util::AbstractConcurrentQueue;
+using coherence::util::DualQueue;
+using coherence::util::SingleConsumerQueue;
+
+/**
+* Contention benchmark comparing the DualQueue and SingleConsumerQueue when
+* many producer threads feed a single consumer, as is the case for the
+* service and event dispatcher queues.
+*/
+class QueueContentionTest : public CxxTest::TestSuite
+    {
+    class ProducerThread
+        : public class_spec<ProducerThread,
+            extends<Object>,
+            implements<Runnable> >
+        {
+        friend class factory<ProducerThread>;
+
+        protected:
+            ProducerThread(AbstractConcurrentQueue::Handle hQueue,
+                    Object::Handle hStart, int32_t cItems)
+                : m_hQueue(self(), hQueue), m_hStart(self(), hStart),
+                  m_cItems(cItems)
+                {
+                }
+
+        public:
+            virtual void run()
+                {
+                COH_SYNCHRONIZED(m_hStart)
+                    {
+                    m_hStart->wait(100);
+                    }
+
+                Object::View v = Object::create();
+                for (int32_t x = 0; x < m_cItems; ++x)
+                    {
+                    m_hQueue->add(v);
+                    }
+                }
+
+        protected:
+            FinalHandle<AbstractConcurrentQueue> m_hQueue;
+            FinalHandle<Object> m_hStart;
+            int32_t m_cItems;
+        };
+
+    public:
+        void testDualQueueContention()
+            {
+            run("DualQueue", DualQueue::create(), 8, 50000);
+            }
+
+        void testSingleConsumerQueueContention()
+            {
+            run("SingleConsumerQueue", SingleConsumerQueue::create(), 8,
+                    50000);
+            }
+
+    protected:
+        /**
+        * Run cProducers threads each adding cItems to the queue while the
+        * calling thread consumes them, and report the throughput.
+        */
+        void run(const char* achName, AbstractConcurrentQueue::Handle hQueue,
+                int32_t cProducers, int32_t cItems)
+            {
+            Object::Handle hStart = Object::create();
+            Thread::Handle ahThreads[64];
+
+            for (int32_t x = 0; x < cProducers; ++x)
+                {
+                ahThreads[x] = Thread::create(
+                        ProducerThread::create(hQueue, hStart, cItems));
+                ahThreads[x]->start();
+                }
+
+            int64_t ldtStart = System::currentTimeMillis();
+            COH_SYNCHRONIZED(hStart)
+                {
+                hStart->notifyAll();
+                }
+
+            int64_t cTotal = (int64_t) cProducers * cItems;
+            for (int64_t c = 0; c < cTotal; ++c)
+                {
+                TS_ASSERT(NULL != hQueue->remove());
+                }
+            int64_t cMillis = System::currentTimeMillis() - ldtStart;
+
+            for (int32_t x = 0; x < cProducers; ++x)
+                {
+                ahThreads[x]->join();
+                }
+
+            TS_ASSERT(hQueue->isEmpty());
+
+            std::cout << std::endl << achName << ": " << cProducers
+                    << " producers, " << cTotal << " items in " << cMillis
+                    << "ms (" << (cTotal * 1000 / (cMillis == 0 ? 1 : cMillis))
+                    << " items/sec), " << hQueue->getStatsFlushed()
+                    << " notifications" << std::endl;
+            }
+    };
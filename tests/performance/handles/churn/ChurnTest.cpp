@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2000, 2026, Oracle and/or its affiliates.
+ *
+ * Licensed under the Universal Permissive License v 1.0 as shown at
+ * http://oss.oracle.com/licenses/upl.
+ */
+#include "coherence/lang.ns"
+
+#include <iostream>
+
+using namespace coherence::lang;
+
+
+/**
+* Worker which repeatedly copies a shared, escaped reference.
+*/
+class Churner
+    : public class_spec<Churner,
+        extends<Object>,
+        implements<Runnable> >
+    {
+    friend class factory<Churner>;
+
+    protected:
+        Churner(Object::Handle hShared, int32_t cCopy, int32_t nStyle)
+            : f_hShared(self(), hShared), m_cCopy(cCopy), m_nStyle(nStyle)
+            {
+            }
+
+    public:
+        virtual void run()
+            {
+            Object::Handle hShared = f_hShared;
+            Object::View   vShared = hShared;
+
+            for (int32_t i = 0, c = m_cCopy; i < c; ++i)
+                {
+                switch (m_nStyle)
+                    {
+                    case 0:
+                        {
+                        Object::Handle h = hShared;
+                        break;
+                        }
+
+                    case 1:
+                        {
+                        Object::View v = vShared;
+                        break;
+                        }
+
+                    case 2:
+                        {
+                        Object::Holder oh = hShared;
+                        break;
+                        }
+
+                    case 3:
+                        {
+                        Object::Handle h = f_hShared;
+                        break;
+                        }
+
+                    default:
+                        break;
+                    }
+                }
+            }
+
+    private:
+        FinalHandle<Object> f_hShared;
+        int32_t             m_cCopy;
+        int32_t             m_nStyle;
+    };
+
+/**
+* Measures the throughput of concurrent handle attach/detach on a single
+* escaped Object, i.e. the cost of the lifecycle atomics under contention.
+*
+* Arguments: [copies per thread] [threads] [style]
+*
+* Styles: 0 - Handle copy, 1 - View copy, 2 - Holder copy,
+*         3 - Handle read from a FinalHandle member
+*/
+class ChurnTest
+    : public class_spec<ChurnTest>
+    {
+    friend class factory<ChurnTest>;
+
+    public:
+        /**
+        * Test entry point
+        */
+        static void main(ObjectArray::View vasArg)
+            {
+            int32_t cCopy = vasArg->length > 0
+                ? Integer32::parse(cast<String::View>(vasArg[0]))
+                : 1000000;
+            int32_t cThreads = vasArg->length > 1
+                ? Integer32::parse(cast<String::View>(vasArg[1]))
+                : 4;
+            int32_t nStyle = vasArg->length > 2
+                ? Integer32::parse(cast<String::View>(vasArg[2]))
+                : 0;
+
+            Object::Handle      hShared  = Object::create();
+            ObjectArray::Handle haThread = ObjectArray::create(cThreads);
+            for (int32_t i = 0; i < cThreads; ++i)
+                {
+                haThread[i] = Thread::create(
+                        Churner::create(hShared, cCopy, nStyle));
+                }
+
+            int64_t ldtStart = System::currentTimeMillis();
+
+            for (int32_t i = 0; i < cThreads; ++i)
+                {
+                cast<Thread::Handle>(haThread[i])->start();
+                }
+            for (int32_t i = 0; i < cThreads; ++i)
+                {
+                cast<Thread::Handle>(haThread[i])->join();
+                }
+
+            int64_t ldtEnd  = System::currentTimeMillis();
+            int64_t cMillis = ldtEnd - ldtStart;
+            int64_t cTotal  = ((int64_t) cCopy) * cThreads;
+
+            std::cout << "performed " << cTotal
+                << " copies(" << nStyle << ") on " << cThreads
+                << " threads in " << cMillis << " ms; throughput = "
+                << (cTotal / ((cMillis == 0 ? 1 : cMillis) / 1000.0)) << "/sec"
+                << std::endl;
+            }
+    };
+COH_REGISTER_EXECUTABLE_CLASS(ChurnTest);
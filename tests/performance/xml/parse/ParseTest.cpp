@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2000, 2026, Oracle and/or its affiliates.
+ *
+ * Licensed under the Universal Permissive License v 1.0 as shown at
+ * http://oss.oracle.com/licenses/upl.
+ */
+#include "coherence/lang.ns"
+
+#include "private/coherence/run/xml/FastXmlParser.hpp"
+#include "private/coherence/run/xml/SimpleParser.hpp"
+
+#include <iostream>
+#include <sstream>
+
+using namespace coherence::lang;
+using namespace coherence::run::xml;
+
+
+/**
+* Measures the time taken by SimpleParser and FastXmlParser to parse a
+* generated cache configuration document.
+*
+* Arguments: [cache mappings] [iterations]
+*/
+class ParseTest
+    : public class_spec<ParseTest>
+    {
+    friend class factory<ParseTest>;
+
+    public:
+        /**
+        * Generate a cache configuration with the specified number of
+        * cache mappings and local schemes.
+        */
+        static String::View generate(int32_t cMapping)
+            {
+            std::stringstream ss;
+            ss << "<?xml version='1.0'?>\n"
+               << "<!-- generated cache configuration -->\n"
+               << "<cache-config>\n"
+               << "  <caching-scheme-mapping>\n";
+            for (int32_t i = 0; i < cMapping; ++i)
+                {
+                ss << "    <cache-mapping>\n"
+                   << "      <cache-name>cache-" << i << "-*</cache-name>\n"
+                   << "      <scheme-name>scheme-" << i << "</scheme-name>\n"
+                   << "      <init-params>\n"
+                   << "        <init-param>\n"
+                   << "          <param-name>size</param-name>\n"
+                   << "          <param-value>" << i << "</param-value>\n"
+                   << "        </init-param>\n"
+                   << "      </init-params>\n"
+                   << "    </cache-mapping>\n";
+                }
+            ss << "  </caching-scheme-mapping>\n"
+               << "  <caching-schemes>\n";
+            for (int32_t i = 0; i < cMapping; ++i)
+                {
+                ss << "    <local-scheme>\n"
+                   << "      <!-- scheme " << i << " -->\n"
+                   << "      <scheme-name>scheme-" << i << "</scheme-name>\n"
+                   << "      <eviction-policy>HYBRID</eviction-policy>\n"
+                   << "      <high-units>{size 100}</high-units>\n"
+                   << "    </local-scheme>\n";
+                }
+            ss << "  </caching-schemes>\n"
+               << "</cache-config>\n";
+            return ss.str();
+            }
+
+        /**
+        * Test entry point
+        */
+        static void main(ObjectArray::View vasArg)
+            {
+            int32_t cMapping = vasArg->length > 0
+                ? Integer32::parse(cast<String::View>(vasArg[0]))
+                : 1000;
+            int32_t cIters = vasArg->length > 1
+                ? Integer32::parse(cast<String::View>(vasArg[1]))
+                : 10;
+
+            String::View vsXml = generate(cMapping);
+
+            for (int32_t nParser = 0; nParser < 2; ++nParser)
+                {
+                int64_t ldtStart = System::currentTimeMillis();
+                for (int32_t i = 0; i < cIters; ++i)
+                    {
+                    if (nParser == 0)
+                        {
+                        SimpleParser::create()->parseXml(vsXml);
+                        }
+                    else
+                        {
+                        FastXmlParser::create()->parseXml(vsXml);
+                        }
+                    }
+                int64_t cMillis = System::currentTimeMillis() - ldtStart;
+
+                std::cout << (nParser == 0 ? "SimpleParser" : "FastXmlParser")
+                    << " parsed " << cIters << " documents of "
+                    << vsXml->length() << " characters in " << cMillis
+                    << " ms; " << (cMillis / (double) cIters) << " ms/doc"
+                    << std::endl;
+                }
+            }
+    };
+COH_REGISTER_EXECUTABLE_CLASS(ParseTest);
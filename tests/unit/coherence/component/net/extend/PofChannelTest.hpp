@@ -0,0 +1,310 @@
+/*
+ * Copyright (c) 2000, 2026, Oracle and/or its affiliates.
+ *
+ * Licensed under the Universal Permissive License v 1.0 as shown at
+ * http://oss.oracle.com/licenses/upl.
+ */
+#include "cxxtest/TestSuite.h"
+
+#include "coherence/lang.ns"
+
+#include "coherence/net/RequestTimeoutException.hpp"
+
+#include "private/coherence/component/net/extend/AbstractPofRequest.hpp"
+#include "private/coherence/component/net/extend/PofChannel.hpp"
+#include "private/coherence/component/net/extend/PofConnection.hpp"
+#include "private/coherence/component/net/extend/protocol/invocation/InvocationRequest.hpp"
+#include "private/coherence/component/util/TcpInitiator.hpp"
+#include "private/coherence/net/messaging/Message.hpp"
+#include "private/coherence/net/messaging/Request.hpp"
+
+using namespace coherence::lang;
+
+using coherence::component::net::extend::AbstractPofRequest;
+using coherence::component::net::extend::PofChannel;
+using coherence::component::net::extend::PofConnection;
+using coherence::component::net::extend::protocol::invocation::InvocationRequest;
+using coherence::component::util::TcpInitiator;
+using coherence::net::RequestTimeoutException;
+using coherence::net::messaging::Message;
+using coherence::net::messaging::Request;
+
+COH_OPEN_NAMESPACE_ANON(PofChannelTest)
+
+/**
+* PofChannel which can be opened without a connected peer and which treats
+* every thread as having entered it.
+*/
+class OpenPofChannel
+    : public class_spec<OpenPofChannel,
+        extends<PofChannel> >
+    {
+    friend class factory<OpenPofChannel>;
+
+    public:
+        virtual bool isActiveThread() const
+            {
+            return true;
+            }
+
+        void open()
+            {
+            setOpen(true);
+            }
+
+        AbstractPofRequest::Status::Handle registerPending(Request::Handle hRequest)
+            {
+            return cast<AbstractPofRequest::Status::Handle>(
+                    registerRequest(hRequest));
+            }
+
+    protected:
+        /**
+        * Keep the Messages queued forever, as there is no peer.
+        */
+        virtual void post(Message::Handle /*hMessage*/)
+            {
+            }
+    };
+
+/**
+* TcpInitiator which exposes send.
+*/
+class SendingTcpInitiator
+    : public class_spec<SendingTcpInitiator,
+        extends<TcpInitiator> >
+    {
+    friend class factory<SendingTcpInitiator>;
+
+    public:
+        void sendMessage(Message::Handle hMessage)
+            {
+            send(hMessage);
+            }
+
+        void setDefaultRequestTimeout(int64_t cMillis)
+            {
+            setRequestTimeout(cMillis);
+            }
+    };
+
+COH_CLOSE_NAMESPACE_ANON
+
+
+/**
+* Test suite for the expiry of the pending Requests of a PofChannel.
+*/
+class PofChannelTest : public CxxTest::TestSuite
+    {
+    public:
+        /**
+        * Test that purgeExpiredRequests cancels and unregisters only the
+        * Requests which have passed their deadline.
+        */
+        void testPurgeExpiredRequests()
+            {
+            SendingTcpInitiator::Handle hInitiator = SendingTcpInitiator::create();
+            PofConnection::Handle       hConnection = PofConnection::create();
+            OpenPofChannel::Handle      hChannel    = instantiateChannel(hInitiator, hConnection);
+
+            int64_t ldtNow = System::currentTimeMillis();
+
+            AbstractPofRequest::Status::Handle hStatusPast1 = instantiateRequest(hChannel, ldtNow - 10);
+            AbstractPofRequest::Status::Handle hStatusPast2 = instantiateRequest(hChannel, ldtNow);
+            AbstractPofRequest::Status::Handle hStatusLater = instantiateRequest(hChannel, ldtNow + 60000);
+            AbstractPofRequest::Status::Handle hStatusNone  = instantiateRequest(hChannel, 0);
+
+            TS_ASSERT_EQUALS(hChannel->purgeExpiredRequests(ldtNow), 2);
+
+            assertTimedOut(hStatusPast1);
+            assertTimedOut(hStatusPast2);
+            TS_ASSERT(NULL == hChannel->getRequest(hStatusPast1->getRequest()->getId()));
+            TS_ASSERT(NULL == hChannel->getRequest(hStatusPast2->getRequest()->getId()));
+
+            TS_ASSERT(!hStatusLater->isClosed());
+            TS_ASSERT(!hStatusNone->isClosed());
+            TS_ASSERT(hChannel->getRequest(hStatusLater->getRequest()->getId()) ==
+                    hStatusLater->getRequest());
+            TS_ASSERT(hChannel->getRequest(hStatusNone->getRequest()->getId()) ==
+                    hStatusNone->getRequest());
+
+            TS_ASSERT_EQUALS(hInitiator->getStatsTimeoutCount(), 2);
+
+            // nothing left to purge
+            TS_ASSERT_EQUALS(hChannel->purgeExpiredRequests(ldtNow), 0);
+            TS_ASSERT_EQUALS(hInitiator->getStatsTimeoutCount(), 2);
+            }
+
+        /**
+        * Test that a Request which has passed its deadline is canceled
+        * rather than sent, and that a Request which has already completed
+        * is dropped.
+        */
+        void testSendExpiredRequest()
+            {
+            SendingTcpInitiator::Handle hInitiator = SendingTcpInitiator::create();
+            PofConnection::Handle       hConnection = PofConnection::create();
+            OpenPofChannel::Handle      hChannel    = instantiateChannel(hInitiator, hConnection);
+
+            int64_t ldtNow = System::currentTimeMillis();
+
+            AbstractPofRequest::Status::Handle hStatus = instantiateRequest(hChannel, ldtNow - 10);
+            hInitiator->sendMessage(hStatus->getRequest());
+
+            assertTimedOut(hStatus);
+            TS_ASSERT_EQUALS(hInitiator->getStatsTimeoutCount(), 1);
+
+            // a Status is only canceled and counted once
+            hInitiator->sendMessage(hStatus->getRequest());
+            TS_ASSERT_EQUALS(hInitiator->getStatsTimeoutCount(), 1);
+            TS_ASSERT_EQUALS(hChannel->purgeExpiredRequests(ldtNow), 0);
+
+            // a canceled Request is dropped without being counted
+            hStatus = instantiateRequest(hChannel, ldtNow + 60000);
+            hStatus->cancel();
+            hInitiator->sendMessage(hStatus->getRequest());
+            TS_ASSERT(!instanceof<RequestTimeoutException::View>(hStatus->getError()));
+            TS_ASSERT_EQUALS(hInitiator->getStatsTimeoutCount(), 1);
+            }
+
+        /**
+        * Test that a Request which times out while its caller waits for the
+        * Response is counted.
+        */
+        void testWaitForResponseTimeout()
+            {
+            SendingTcpInitiator::Handle hInitiator = SendingTcpInitiator::create();
+            PofConnection::Handle       hConnection = PofConnection::create();
+            OpenPofChannel::Handle      hChannel    = instantiateChannel(hInitiator, hConnection);
+
+            AbstractPofRequest::Status::Handle hStatus = instantiateRequest(hChannel, 0);
+            try
+                {
+                hStatus->waitForResponse(10);
+                TS_FAIL("expected RequestTimeoutException");
+                }
+            catch (RequestTimeoutException::View)
+                {
+                }
+
+            assertTimedOut(hStatus);
+            TS_ASSERT_EQUALS(hInitiator->getStatsTimeoutCount(), 1);
+
+            hInitiator->resetStats();
+            TS_ASSERT_EQUALS(hInitiator->getStatsTimeoutCount(), 0);
+            }
+
+        /**
+        * Test that a Request deadline schedules the check for expired
+        * Requests even when there is no default request timeout, and that
+        * the purge reschedules the check for the Requests left pending.
+        */
+        void testRequestDeadlineSchedulesCheck()
+            {
+            SendingTcpInitiator::Handle hInitiator = SendingTcpInitiator::create();
+            PofConnection::Handle       hConnection = PofConnection::create();
+            OpenPofChannel::Handle      hChannel    = instantiateChannel(hInitiator, hConnection);
+
+            hInitiator->setDefaultRequestTimeout(0);
+            TS_ASSERT_EQUALS(hInitiator->getRequestNextCheckMillis(), Integer64::max_value);
+
+            int64_t ldtNow = System::currentTimeMillis();
+
+            hInitiator->onRequestDeadline(ldtNow + 60000);
+            TS_ASSERT_EQUALS(hInitiator->getRequestNextCheckMillis(), ldtNow + 60000);
+            hInitiator->onRequestDeadline(ldtNow + 30000);
+            hInitiator->onRequestDeadline(ldtNow + 45000);
+            TS_ASSERT_EQUALS(hInitiator->getRequestNextCheckMillis(), ldtNow + 30000);
+
+            int64_t cWait = hInitiator->getWaitMillis();
+            TS_ASSERT(cWait > 0 && cWait <= 30000);
+
+            // the purge reports the earliest deadline left pending
+            hInitiator = SendingTcpInitiator::create();
+            hConnection = PofConnection::create();
+            hChannel    = instantiateChannel(hInitiator, hConnection);
+            hInitiator->setDefaultRequestTimeout(0);
+
+            instantiateRequest(hChannel, ldtNow - 10);
+            instantiateRequest(hChannel, ldtNow + 60000);
+            instantiateRequest(hChannel, ldtNow + 20000);
+            instantiateRequest(hChannel, 0);
+            TS_ASSERT_EQUALS(hInitiator->getRequestNextCheckMillis(), Integer64::max_value);
+
+            TS_ASSERT_EQUALS(hChannel->purgeExpiredRequests(ldtNow), 1);
+            TS_ASSERT_EQUALS(hInitiator->getRequestNextCheckMillis(), ldtNow + 20000);
+            }
+
+        /**
+        * Test that a Request sent with a timeout is given a deadline which
+        * schedules the check for expired Requests, and is canceled once it
+        * has passed.
+        */
+        void testSendWithTimeout()
+            {
+            SendingTcpInitiator::Handle hInitiator = SendingTcpInitiator::create();
+            PofConnection::Handle       hConnection = PofConnection::create();
+            OpenPofChannel::Handle      hChannel    = instantiateChannel(hInitiator, hConnection);
+
+            hInitiator->setDefaultRequestTimeout(0);
+
+            int64_t ldtBefore = System::currentTimeMillis();
+
+            InvocationRequest::Handle hRequest = InvocationRequest::create();
+            AbstractPofRequest::Status::Handle hStatus =
+                    cast<AbstractPofRequest::Status::Handle>(hChannel->send(hRequest, 5000));
+
+            int64_t ldtDeadline = hStatus->getDeadlineMillis();
+            TS_ASSERT(ldtDeadline >= ldtBefore + 5000);
+            TS_ASSERT(ldtDeadline <= System::currentTimeMillis() + 5000);
+            TS_ASSERT_EQUALS(hInitiator->getRequestNextCheckMillis(), ldtDeadline);
+
+            TS_ASSERT_EQUALS(hChannel->purgeExpiredRequests(ldtDeadline - 1), 0);
+            TS_ASSERT_EQUALS(hChannel->purgeExpiredRequests(ldtDeadline), 1);
+            assertTimedOut(hStatus);
+
+            // without a timeout there is no deadline
+            hStatus = cast<AbstractPofRequest::Status::Handle>(
+                    hChannel->send(InvocationRequest::create(), 0));
+            TS_ASSERT_EQUALS(hStatus->getDeadlineMillis(), 0);
+            }
+
+    protected:
+        /**
+        * Create an open Channel whose Connection is managed by the given
+        * Initiator.
+        */
+        static OpenPofChannel::Handle instantiateChannel(
+                TcpInitiator::Handle hInitiator, PofConnection::Handle hConnection)
+            {
+            hConnection->setConnectionManager(hInitiator);
+
+            OpenPofChannel::Handle hChannel = OpenPofChannel::create();
+            hChannel->setConnection(hConnection);
+            hChannel->open();
+            return hChannel;
+            }
+
+        /**
+        * Register a new Request with the given deadline.
+        */
+        static AbstractPofRequest::Status::Handle instantiateRequest(
+                OpenPofChannel::Handle hChannel, int64_t ldtDeadline)
+            {
+            InvocationRequest::Handle hRequest = InvocationRequest::create();
+            hRequest->setChannel(hChannel);
+
+            AbstractPofRequest::Status::Handle hStatus = hChannel->registerPending(hRequest);
+            hStatus->setDeadlineMillis(ldtDeadline);
+            return hStatus;
+            }
+
+        /**
+        * Assert that the given Status was closed by a RequestTimeoutException.
+        */
+        static void assertTimedOut(AbstractPofRequest::Status::View vStatus)
+            {
+            TS_ASSERT(vStatus->isClosed());
+            TS_ASSERT(instanceof<RequestTimeoutException::View>(vStatus->getError()));
+            }
+    };
@@ -9,6 +9,14 @@
 #include "mock/CommonMocks.hpp"
 #include "coherence/util/ArrayList.hpp"
 #include "coherence/util/Converter.hpp"
+#include "coherence/util/MapListenerSupport.hpp"
+#include "coherence/util/Listeners.hpp"
+#include "coherence/util/MapEvent.hpp"
+#include "coherence/util/extractor/IdentityExtractor.hpp"
+#include "coherence/util/filter/AlwaysFilter.hpp"
+#include "coherence/util/filter/EqualsFilter.hpp"
+#include "coherence/util/filter/MapEventTransformerFilter.hpp"
+#include "coherence/util/transformer/SemiLiteEventTransformer.hpp"
 
 
 #include "private/coherence/component/net/extend/RemoteNamedCache.hpp"
@@ -22,6 +30,14 @@ using namespace std;
 using namespace mock;
 using coherence::util::ArrayList;
 using coherence::util::Converter;
+using coherence::util::Listeners;
+using coherence::util::MapEvent;
+using coherence::util::MapListenerSupport;
+using coherence::util::extractor::IdentityExtractor;
+using coherence::util::filter::AlwaysFilter;
+using coherence::util::filter::EqualsFilter;
+using coherence::util::filter::MapEventTransformerFilter;
+using coherence::util::transformer::SemiLiteEventTransformer;
 using coherence::component::net::extend::protocol::cache::ListenerFilterRequest;
 using coherence::component::net::extend::protocol::cache::ListenerKeyRequest;
 
@@ -59,6 +75,30 @@ class TestRemoteNamedCache
             }
     };
 
+// a TestRemoteNamedCache which tracks its listeners in a real
+// MapListenerSupport
+class SupportedRemoteNamedCache
+    : public class_spec<SupportedRemoteNamedCache,
+          extends<RemoteNamedCache> >
+    {
+    friend class factory<SupportedRemoteNamedCache>;
+
+    protected:
+        virtual BinaryCache::Handle instantiateBinaryCache()
+            {
+            return TestRemoteNamedBinaryCache::create(this, MapListenerSupport::create());
+            }
+    };
+
+// a MockMapListener tagged as not needing old values
+class SemiLiteMockMapListener
+    : public class_spec<SemiLiteMockMapListener,
+        extends<MockMapListener>,
+        implements<MapListenerSupport::SemiLiteListener> >
+    {
+    friend class factory<SemiLiteMockMapListener>;
+    };
+
 bool matchListenerArgs(ArrayList::View vExpected, ArrayList::View vActual)
     {
     // first arg is converter listener
@@ -360,6 +400,130 @@ class RemoteNamedCacheTest : public CxxTest::TestSuite
         TS_ASSERT(hBinaryCache->getFilterArray()->isEmpty());
         }
 
+    void testAddSemiLiteFilterListener()
+        {
+        RemoteNamedCache::Handle hCache = TestRemoteNamedCache::create();
+
+        // create mocks and test classes
+        TestRemoteNamedBinaryCache::Handle hBinaryCache         = cast<TestRemoteNamedBinaryCache::Handle>(hCache->getBinaryCache());
+        MockMapListenerSupport::Handle     hMockListenerSupport = cast<MockMapListenerSupport::Handle>(hBinaryCache->getMapListenerSupport());
+        MockMapListener::Handle            hMockListener          = SemiLiteMockMapListener::create();
+        MockChannel::Handle                hMockChannel           = MockChannel::create();
+        MockProtocolMessageFactory::Handle hMockFactory           = MockProtocolMessageFactory::create();
+        ListenerFilterRequest::Handle      hListenerFilterRequest = ListenerFilterRequest::create();
+        Filter::View                       vFilter                = EqualsFilter::create(
+                IdentityExtractor::getInstance(), String::create("test"));
+        Filter::View                       vFilterSemiLite        = MapEventTransformerFilter::create(
+                vFilter, SemiLiteEventTransformer::getInstance());
+
+        // the listener is registered under the semi-lite transformer-filter
+        hMockListenerSupport->setStrict(true);
+        hMockListenerSupport->isEmpty(vFilterSemiLite);
+        hMockListenerSupport->setBoolReturn(true);
+        hMockListenerSupport->addListener(hMockListener, vFilterSemiLite, false);
+        hMockListenerSupport->setMatcher(&matchListenerArgs);
+        hMockListenerSupport->replay();
+
+        // mock channel expectations
+        hMockChannel->isOpen();
+        hMockChannel->setBoolReturn(true);
+        hMockChannel->getMessageFactory();
+        hMockChannel->setObjectReturn(hMockFactory);
+        hMockChannel->request(hListenerFilterRequest);
+        hMockChannel->replay();
+
+        // mock MockProtocolMessageFactory expectations
+        hMockFactory->createMessage(ListenerFilterRequest::type_id);
+        hMockFactory->setObjectReturn(hListenerFilterRequest);
+        hMockFactory->replay();
+
+        // set state on cache
+        hCache->registerChannel(hMockChannel);
+
+        // invoke function being tested
+        hCache->addFilterListener(hMockListener, vFilter, false);
+
+        // verify mock calls
+        hMockListenerSupport->verify();
+        hMockChannel->verify();
+        hMockFactory->verify();
+
+        // the proxy is asked to strip the old values
+        TS_ASSERT(hListenerFilterRequest->isAdd());
+        TS_ASSERT(vFilterSemiLite->equals(hListenerFilterRequest->getFilter()));
+        TS_ASSERT(hListenerFilterRequest->getFilterId() == 1);
+        TS_ASSERT(!hListenerFilterRequest->isLite());
+        TS_ASSERT(hBinaryCache->getFilterArray()->get(1)->equals(vFilterSemiLite));
+        }
+
+    void testRemoveSemiLiteFilterListener()
+        {
+        RemoteNamedCache::Handle           hCache          = SupportedRemoteNamedCache::create();
+        TestRemoteNamedBinaryCache::Handle hBinaryCache    = cast<TestRemoteNamedBinaryCache::Handle>(hCache->getBinaryCache());
+        MapListenerSupport::Handle         hSupport        = hBinaryCache->getMapListenerSupport();
+        MockMapListener::Handle            hMockListener   = SemiLiteMockMapListener::create();
+        MockChannel::Handle                hMockChannel    = MockChannel::create();
+        MockProtocolMessageFactory::Handle hMockFactory    = MockProtocolMessageFactory::create();
+        ListenerFilterRequest::Handle      hAddRequest     = ListenerFilterRequest::create();
+        ListenerFilterRequest::Handle      hRemoveRequest  = ListenerFilterRequest::create();
+        Filter::View                       vFilter         = AlwaysFilter::getInstance();
+        Filter::View                       vFilterSemiLite = MapEventTransformerFilter::create(
+                vFilter, SemiLiteEventTransformer::getInstance());
+
+        expectListenerRequests(hMockChannel, hMockFactory, hAddRequest, hRemoveRequest);
+        hCache->registerChannel(hMockChannel);
+
+        // invoke functions being tested
+        hCache->addFilterListener(hMockListener, vFilter, false);
+        TS_ASSERT(!collectListeners(hBinaryCache)->isEmpty());
+        hCache->removeFilterListener(hMockListener, vFilter);
+
+        hMockChannel->verify();
+        hMockFactory->verify();
+
+        // the proxy is asked to remove the semi-lite registration
+        TS_ASSERT(!hRemoveRequest->isAdd());
+        TS_ASSERT(vFilterSemiLite->equals(hRemoveRequest->getFilter()));
+        TS_ASSERT(hRemoveRequest->getFilterId() == 1);
+        TS_ASSERT(hBinaryCache->getFilterArray()->isEmpty());
+
+        // and no further events reach the listener
+        TS_ASSERT(hSupport->isEmpty());
+        TS_ASSERT(collectListeners(hBinaryCache)->isEmpty());
+        }
+
+    void testRemoveSemiLiteMapListener()
+        {
+        RemoteNamedCache::Handle           hCache          = SupportedRemoteNamedCache::create();
+        TestRemoteNamedBinaryCache::Handle hBinaryCache    = cast<TestRemoteNamedBinaryCache::Handle>(hCache->getBinaryCache());
+        MapListenerSupport::Handle         hSupport        = hBinaryCache->getMapListenerSupport();
+        MockMapListener::Handle            hMockListener   = SemiLiteMockMapListener::create();
+        MockChannel::Handle                hMockChannel    = MockChannel::create();
+        MockProtocolMessageFactory::Handle hMockFactory    = MockProtocolMessageFactory::create();
+        ListenerFilterRequest::Handle      hAddRequest     = ListenerFilterRequest::create();
+        ListenerFilterRequest::Handle      hRemoveRequest  = ListenerFilterRequest::create();
+        Filter::View                       vFilterSemiLite = MapEventTransformerFilter::create(
+                (Filter::View) NULL, SemiLiteEventTransformer::getInstance());
+
+        expectListenerRequests(hMockChannel, hMockFactory, hAddRequest, hRemoveRequest);
+        hCache->registerChannel(hMockChannel);
+
+        // invoke functions being tested
+        hCache->addMapListener(hMockListener);
+        TS_ASSERT(!collectListeners(hBinaryCache)->isEmpty());
+        hCache->removeMapListener(hMockListener);
+
+        hMockChannel->verify();
+        hMockFactory->verify();
+
+        TS_ASSERT(!hRemoveRequest->isAdd());
+        TS_ASSERT(vFilterSemiLite->equals(hRemoveRequest->getFilter()));
+        TS_ASSERT(hRemoveRequest->getFilterId() == 1);
+        TS_ASSERT(hBinaryCache->getFilterArray()->isEmpty());
+        TS_ASSERT(hSupport->isEmpty());
+        TS_ASSERT(collectListeners(hBinaryCache)->isEmpty());
+        }
+
     // ConverterListener tests
 
     void testConverterListener_Accessors()
@@ -572,6 +736,41 @@ class RemoteNamedCacheTest : public CxxTest::TestSuite
         hMockEvent->verify();
         }
 
+    // helpers
+
+    static void expectListenerRequests(MockChannel::Handle hMockChannel,
+            MockProtocolMessageFactory::Handle hMockFactory,
+            ListenerFilterRequest::Handle hAddRequest,
+            ListenerFilterRequest::Handle hRemoveRequest)
+        {
+        hMockChannel->isOpen();
+        hMockChannel->setBoolReturn(true);
+        hMockChannel->getMessageFactory();
+        hMockChannel->setObjectReturn(hMockFactory);
+        hMockChannel->request(hAddRequest);
+        hMockChannel->isOpen();
+        hMockChannel->setBoolReturn(true);
+        hMockChannel->getMessageFactory();
+        hMockChannel->setObjectReturn(hMockFactory);
+        hMockChannel->request(hRemoveRequest);
+        hMockChannel->replay();
+
+        hMockFactory->createMessage(ListenerFilterRequest::type_id);
+        hMockFactory->setObjectReturn(hAddRequest);
+        hMockFactory->createMessage(ListenerFilterRequest::type_id);
+        hMockFactory->setObjectReturn(hRemoveRequest);
+        hMockFactory->replay();
+        }
+
+    // the listeners an insert event raised by the cache would be sent to
+    static Listeners::View collectListeners(TestRemoteNamedBinaryCache::Handle hBinaryCache)
+        {
+        return hBinaryCache->getMapListenerSupport()->collectListeners(
+                MapEvent::create(hBinaryCache, MapEvent::entry_inserted,
+                        String::create("key"), (Object::View) NULL,
+                        String::create("value")));
+        }
+
     };
 
 
@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2000, 2026, Oracle and/or its affiliates.
+ *
+ * Licensed under the Universal Permissive License v 1.0 as shown at
+ * http://oss.oracle.com/licenses/upl.
+ */
+#include "cxxtest/TestSuite.h"
+
+#include "coherence/lang.ns"
+
+#include "coherence/net/InvocationObserver.hpp"
+#include "coherence/net/Member.hpp"
+#include "coherence/net/RequestTimeoutException.hpp"
+#include "coherence/net/messaging/ConnectionException.hpp"
+#include "coherence/util/ArrayList.hpp"
+#include "coherence/util/List.hpp"
+
+#include "private/coherence/component/net/extend/AbstractPofRequest.hpp"
+#include "private/coherence/component/net/extend/PofChannel.hpp"
+#include "private/coherence/component/net/extend/protocol/invocation/InvocationRequest.hpp"
+#include "private/coherence/component/net/extend/protocol/invocation/InvocationServiceResponse.hpp"
+#include "private/coherence/net/LocalMember.hpp"
+
+using namespace coherence::lang;
+
+using coherence::component::net::extend::AbstractPofRequest;
+using coherence::component::net::extend::PofChannel;
+using coherence::component::net::extend::protocol::invocation::InvocationRequest;
+using coherence::component::net::extend::protocol::invocation::InvocationServiceResponse;
+using coherence::net::InvocationObserver;
+using coherence::net::LocalMember;
+using coherence::net::Member;
+using coherence::net::RequestTimeoutException;
+using coherence::net::messaging::ConnectionException;
+using coherence::util::ArrayList;
+using coherence::util::List;
+
+COH_OPEN_NAMESPACE_ANON(InvocationRequestTest)
+
+/**
+* InvocationObserver which records each notification it receives.
+*/
+class RecordingObserver
+    : public class_spec<RecordingObserver,
+        extends<Object>,
+        implements<InvocationObserver> >
+    {
+    friend class factory<RecordingObserver>;
+
+    protected:
+        RecordingObserver()
+            : f_hListEvent(self(), ArrayList::create()),
+              m_vMember(self()), m_ohResult(self())
+            {
+            }
+
+    public:
+        virtual void memberCompleted(Member::View vMember,
+                Object::Holder ohResult)
+            {
+            f_hListEvent->add(String::create("completed"));
+            m_vMember  = vMember;
+            m_ohResult = ohResult;
+            }
+
+        virtual void memberFailed(Member::View vMember,
+                Exception::Holder ohFailure)
+            {
+            f_hListEvent->add(String::create("failed"));
+            m_vMember  = vMember;
+            m_ohResult = ohFailure;
+            }
+
+        virtual void memberLeft(Member::View vMember)
+            {
+            f_hListEvent->add(String::create("left"));
+            m_vMember = vMember;
+            }
+
+        virtual void invocationCompleted()
+            {
+            f_hListEvent->add(String::create("invocation"));
+            }
+
+        FinalHandle<List>      f_hListEvent;
+        MemberView<Member>     m_vMember;
+        MemberHolder<Object>   m_ohResult;
+    };
+
+/**
+* InvocationRequest which exposes its observer and member setters.
+*/
+class TestInvocationRequest
+    : public class_spec<TestInvocationRequest,
+        extends<InvocationRequest> >
+    {
+    friend class factory<TestInvocationRequest>;
+
+    public:
+        void setup(InvocationObserver::Handle hObserver, Member::View vMember)
+            {
+            setObserver(hObserver);
+            setMember(vMember);
+            }
+    };
+
+COH_CLOSE_NAMESPACE_ANON
+
+
+/**
+* Test suite for the asynchronous use of InvocationRequest.
+*/
+class InvocationRequestTest : public CxxTest::TestSuite
+    {
+    public:
+        /**
+        * Test that a Response is reported through memberCompleted.
+        */
+        void testObserverCompleted()
+            {
+            RecordingObserver::Handle          hObserver = RecordingObserver::create();
+            Member::View                       vMember   = LocalMember::create();
+            AbstractPofRequest::Status::Handle hStatus   = instantiateStatus(hObserver, vMember);
+
+            InvocationServiceResponse::Handle hResponse = InvocationServiceResponse::create();
+            hResponse->setResult(String::create("result"));
+            hStatus->setResponse(hResponse);
+
+            assertEvents(hObserver, "completed");
+            TS_ASSERT(hObserver->m_vMember == vMember);
+            TS_ASSERT(String::create("result")->equals(hObserver->m_ohResult));
+            }
+
+        /**
+        * Test that a failed Request is reported through memberFailed.
+        */
+        void testObserverFailed()
+            {
+            RecordingObserver::Handle          hObserver = RecordingObserver::create();
+            Member::View                       vMember   = LocalMember::create();
+            AbstractPofRequest::Status::Handle hStatus   = instantiateStatus(hObserver, vMember);
+            Exception::View                    vFailure  = IllegalStateException::create("test");
+
+            hStatus->cancel(vFailure);
+
+            assertEvents(hObserver, "failed");
+            TS_ASSERT(hObserver->m_vMember == vMember);
+            TS_ASSERT(hObserver->m_ohResult == vFailure);
+
+            // a Status is only closed once
+            hStatus->cancel(vFailure);
+            TS_ASSERT_EQUALS(hObserver->f_hListEvent->size(), size32_t(2));
+            }
+
+        /**
+        * Test that a Request which passed its deadline is reported through
+        * memberFailed.
+        */
+        void testObserverTimedOut()
+            {
+            RecordingObserver::Handle          hObserver = RecordingObserver::create();
+            Member::View                       vMember   = LocalMember::create();
+            AbstractPofRequest::Status::Handle hStatus   = instantiateStatus(hObserver, vMember);
+
+            hStatus->cancel(RequestTimeoutException::create("timed out"));
+
+            assertEvents(hObserver, "failed");
+            TS_ASSERT(instanceof<RequestTimeoutException::View>(hObserver->m_ohResult));
+            }
+
+        /**
+        * Test that a Request canceled by the Channel being closed is
+        * reported through memberLeft.
+        */
+        void testObserverChannelClosed()
+            {
+            RecordingObserver::Handle          hObserver = RecordingObserver::create();
+            Member::View                       vMember   = LocalMember::create();
+            AbstractPofRequest::Status::Handle hStatus   = instantiateStatus(hObserver, vMember);
+
+            hStatus->cancel(ConnectionException::create("channel closed"));
+
+            assertEvents(hObserver, "left");
+            TS_ASSERT(hObserver->m_vMember == vMember);
+            }
+
+        /**
+        * Test that a synchronous Request has no observer to notify.
+        */
+        void testNoObserver()
+            {
+            InvocationRequest::Handle          hRequest = InvocationRequest::create();
+            AbstractPofRequest::Status::Handle hStatus  = AbstractPofRequest::Status::create();
+            hStatus->setChannel(PofChannel::create());
+            hStatus->setRequest(hRequest);
+            hRequest->setStatus(hStatus);
+
+            hStatus->setResponse(InvocationServiceResponse::create());
+            TS_ASSERT(hStatus->isClosed());
+            }
+
+    protected:
+        /**
+        * Create the Status of an InvocationRequest sent by
+        * InvocationService::execute.
+        *
+        * The Channel is not connected, so the notification is delivered on
+        * the thread which closes the Status.
+        */
+        static AbstractPofRequest::Status::Handle instantiateStatus(
+                InvocationObserver::Handle hObserver, Member::View vMember)
+            {
+            TestInvocationRequest::Handle hRequest = TestInvocationRequest::create();
+            hRequest->setup(hObserver, vMember);
+
+            AbstractPofRequest::Status::Handle hStatus = AbstractPofRequest::Status::create();
+            hStatus->setChannel(PofChannel::create());
+            hStatus->setRequest(hRequest);
+            hRequest->setStatus(hStatus);
+            return hStatus;
+            }
+
+        /**
+        * Assert that the observer was told of the given member outcome and
+        * then of the completion of the invocation.
+        */
+        static void assertEvents(RecordingObserver::View vObserver,
+                const char* achEvent)
+            {
+            List::View vList = vObserver->f_hListEvent;
+            TS_ASSERT_EQUALS(vList->size(), size32_t(2));
+            TS_ASSERT(String::create(achEvent)->equals(vList->get(0)));
+            TS_ASSERT(String::create("invocation")->equals(vList->get(1)));
+            }
+    };
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2000, 2026, Oracle and/or its affiliates.
+ *
+ * Licensed under the Universal Permissive License v 1.0 as shown at
+ * http://oss.oracle.com/licenses/upl.
+ */
+#include "cxxtest/TestSuite.h"
+#include "coherence/lang.ns"
+
+#include "coherence/util/ArrayList.hpp"
+#include "coherence/util/List.hpp"
+
+#include "private/coherence/component/net/extend/util/PriorityGate.hpp"
+
+using namespace coherence::lang;
+
+using coherence::component::net::extend::util::PriorityGate;
+using coherence::util::ArrayList;
+using coherence::util::List;
+
+
+/**
+* Test Suite for PriorityGate.
+*/
+class PriorityGateTest : public CxxTest::TestSuite
+    {
+    /**
+    * Runnable which enters the gate in a lane and records the lane.
+    */
+    class Entrant
+        : public class_spec<Entrant,
+            extends<Object>,
+            implements<Runnable> >
+        {
+        friend class factory<Entrant>;
+
+        protected:
+            Entrant(PriorityGate::Handle hGate, List::Handle hList, int32_t nLane)
+                : f_hGate(self(), hGate), f_hList(self(), hList), m_nLane(nLane),
+                  m_fInterrupted(self(), false)
+                {
+                }
+
+        public:
+            virtual void run()
+                {
+                PriorityGate::Handle hGate = f_hGate;
+                List::Handle         hList = f_hList;
+
+                hGate->enter(m_nLane);
+                m_fInterrupted = Thread::currentThread()->isInterrupted();
+                COH_SYNCHRONIZED (hList)
+                    {
+                    hList->add(Integer32::create(m_nLane));
+                    }
+                hGate->exit();
+                }
+
+        protected:
+            FinalHandle<PriorityGate> f_hGate;
+            FinalHandle<List>         f_hList;
+            int32_t                   m_nLane;
+
+        public:
+            Volatile<bool>            m_fInterrupted;
+        };
+
+    public:
+        /**
+        * Start a thread which waits in the given lane, and wait for it to
+        * be waiting.
+        */
+        static Thread::Handle startEntrant(PriorityGate::Handle hGate,
+                List::Handle hList, int32_t nLane)
+            {
+            int32_t        cWaiting = hGate->getWaitingCount(nLane);
+            Thread::Handle hThread  = Thread::create(
+                    Entrant::create(hGate, hList, nLane));
+            hThread->start();
+
+            while (hGate->getWaitingCount(nLane) == cWaiting)
+                {
+                Thread::sleep(1);
+                }
+            return hThread;
+            }
+
+        /**
+        * Test that waiting threads are admitted in priority order.
+        */
+        void testPriorityOrder()
+            {
+            PriorityGate::Handle hGate = PriorityGate::create(3, 16);
+            List::Handle         hList = ArrayList::create();
+
+            hGate->enter(1);
+            Thread::Handle hBulk   = startEntrant(hGate, hList, 2);
+            Thread::Handle hNormal = startEntrant(hGate, hList, 1);
+            Thread::Handle hHigh   = startEntrant(hGate, hList, 0);
+            hGate->exit();
+
+            hBulk->join();
+            hNormal->join();
+            hHigh->join();
+
+            TS_ASSERT_EQUALS(3, (int32_t) hList->size());
+            TS_ASSERT(Integer32::valueOf(0)->equals(hList->get(0)));
+            TS_ASSERT(Integer32::valueOf(1)->equals(hList->get(1)));
+            TS_ASSERT(Integer32::valueOf(2)->equals(hList->get(2)));
+            }
+
+        /**
+        * Test that a lower priority lane is admitted once it has been
+        * bypassed the maximum number of times.
+        */
+        void testBypassLimit()
+            {
+            PriorityGate::Handle hGate    = PriorityGate::create(2, 2);
+            List::Handle         hList    = ArrayList::create();
+            ObjectArray::Handle  haThread = ObjectArray::create(5);
+
+            hGate->enter(0);
+            haThread[0] = startEntrant(hGate, hList, 1);
+            for (int32_t i = 1; i < 5; ++i)
+                {
+                haThread[i] = startEntrant(hGate, hList, 0);
+                }
+            hGate->exit();
+
+            for (int32_t i = 0; i < 5; ++i)
+                {
+                cast<Thread::Handle>(haThread[i])->join();
+                }
+
+            TS_ASSERT_EQUALS(5, (int32_t) hList->size());
+            TS_ASSERT(Integer32::valueOf(0)->equals(hList->get(0)));
+            TS_ASSERT(Integer32::valueOf(0)->equals(hList->get(1)));
+            TS_ASSERT(Integer32::valueOf(1)->equals(hList->get(2)));
+            TS_ASSERT(Integer32::valueOf(0)->equals(hList->get(3)));
+            TS_ASSERT(Integer32::valueOf(0)->equals(hList->get(4)));
+            }
+
+        /**
+        * Test that interrupting a waiting thread does not abandon its
+        * entry, and that the interrupt is preserved once it is admitted.
+        */
+        void testInterruptedWaiter()
+            {
+            PriorityGate::Handle hGate    = PriorityGate::create(2, 16);
+            List::Handle         hList    = ArrayList::create();
+            Entrant::Handle      hEntrant = Entrant::create(hGate, hList, 1);
+            Thread::Handle       hThread  = Thread::create(hEntrant);
+
+            hGate->enter(0);
+            hThread->start();
+            while (hGate->getWaitingCount(1) == 0)
+                {
+                Thread::sleep(1);
+                }
+
+            hThread->interrupt();
+            Thread::sleep(50);
+
+            // the thread is still waiting for the gate
+            TS_ASSERT_EQUALS(1, hGate->getWaitingCount(1));
+            TS_ASSERT(hList->isEmpty());
+
+            hGate->exit();
+            hThread->join();
+
+            TS_ASSERT_EQUALS(1, (int32_t) hList->size());
+            TS_ASSERT(hEntrant->m_fInterrupted);
+            TS_ASSERT_EQUALS(0, hGate->getWaitingCount(1));
+            }
+
+        /**
+        * Test that lanes outside of the configured range are clamped.
+        */
+        void testLaneRange()
+            {
+            PriorityGate::Handle hGate = PriorityGate::create(2, 16);
+
+            hGate->enter(7);
+            hGate->exit();
+            hGate->enter(-1);
+            hGate->exit();
+
+            TS_ASSERT_EQUALS(0, hGate->getWaitingCount(-1));
+            TS_ASSERT_EQUALS(0, hGate->getWaitingCount(7));
+            }
+    };
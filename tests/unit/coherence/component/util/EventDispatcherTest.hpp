@@ -0,0 +1,399 @@
+/*
+ * Copyright (c) 2000, 2026, Oracle and/or its affiliates.
+ *
+ * Licensed under the Universal Permissive License v 1.0 as shown at
+ * http://oss.oracle.com/licenses/upl.
+ */
+#include "cxxtest/TestSuite.h"
+#include "coherence/lang.ns"
+
+#include "coherence/net/NamedCache.hpp"
+#include "coherence/net/cache/CacheEvent.hpp"
+#include "coherence/util/ArrayList.hpp"
+#include "coherence/util/BatchMapListener.hpp"
+#include "coherence/util/DualQueue.hpp"
+#include "coherence/util/HashSet.hpp"
+#include "coherence/util/MultiplexingMapListener.hpp"
+
+#include "private/coherence/component/util/RunnableCacheEvent.hpp"
+#include "private/coherence/component/util/Service.hpp"
+#include "private/coherence/component/util/TcpInitiator.hpp"
+#include "private/coherence/net/cache/LocalNamedCache.hpp"
+#include "private/coherence/util/logging/Logger.hpp"
+
+using namespace coherence::lang;
+using coherence::component::util::RunnableCacheEvent;
+using coherence::component::util::Service;
+using coherence::component::util::TcpInitiator;
+using coherence::net::NamedCache;
+using coherence::net::cache::CacheEvent;
+using coherence::net::cache::LocalNamedCache;
+using coherence::util::ArrayList;
+using coherence::util::BatchMapListener;
+using coherence::util::DualQueue;
+using coherence::util::HashSet;
+using coherence::util::List;
+using coherence::util::MapEvent;
+using coherence::util::MapListener;
+using coherence::util::MultiplexingMapListener;
+using coherence::util::Queue;
+using coherence::util::Set;
+using coherence::util::logging::Logger;
+
+COH_OPEN_NAMESPACE (test)
+
+class TestEventDispatcher
+    : public class_spec<TestEventDispatcher,
+        extends<Service::EventDispatcher> >
+    {
+    friend class factory<TestEventDispatcher>;
+
+    protected:
+        TestEventDispatcher(Service::View vService)
+            : super(vService)
+            {
+            }
+
+    public:
+        bool hasWorkers() const
+            {
+            return f_haWorker != NULL;
+            }
+
+    protected:
+        virtual Queue::Handle instantiateQueue() const
+            {
+            // the EventQueue only accepts tasks once its Service is running
+            return DualQueue::create();
+            }
+    };
+
+/**
+* Records each event along with the thread which delivered it, and whether
+* it was delivered while another delivery to this listener was in progress.
+*/
+class ThreadRecordingListener
+    : public class_spec<ThreadRecordingListener,
+        extends<MultiplexingMapListener> >
+    {
+    friend class factory<ThreadRecordingListener>;
+
+    protected:
+        ThreadRecordingListener(bool fThrow)
+            : f_hList(self(), ArrayList::create()),
+              f_hSetThread(self(), HashSet::create()),
+              m_fActive(self(), false), m_fOverlap(self(), false),
+              m_fThrow(fThrow)
+            {
+            }
+
+    public:
+        virtual void onMapEvent(MapEvent::View vEvent)
+            {
+            if (m_fActive)
+                {
+                m_fOverlap = true;
+                }
+            m_fActive = true;
+            COH_SYNCHRONIZED (this)
+                {
+                f_hList->add(vEvent->getNewValue());
+                f_hSetThread->add(Thread::currentThread());
+                }
+            m_fActive = false;
+
+            if (m_fThrow)
+                {
+                COH_THROW (IllegalStateException::create("test"));
+                }
+            }
+
+        size32_t getEventCount() const
+            {
+            COH_SYNCHRONIZED (this)
+                {
+                return f_hList->size();
+                }
+            }
+
+        FinalHandle<List>   f_hList;
+        FinalHandle<Set>    f_hSetThread;
+        Volatile<bool>      m_fActive;
+        Volatile<bool>      m_fOverlap;
+        bool                m_fThrow;
+    };
+
+/**
+* A BatchMapListener which records each batch and then throws.
+*/
+class ThrowingBatchListener
+    : public class_spec<ThrowingBatchListener,
+        extends<ThreadRecordingListener>,
+        implements<BatchMapListener> >
+    {
+    friend class factory<ThrowingBatchListener>;
+
+    protected:
+        ThrowingBatchListener()
+            : super(true)
+            {
+            }
+
+    public:
+        virtual void onMapEvents(ObjectArray::View vaEvent)
+            {
+            COH_SYNCHRONIZED (this)
+                {
+                for (size32_t i = 0, c = vaEvent->length; i < c; ++i)
+                    {
+                    f_hList->add(cast<MapEvent::View>(vaEvent[i])->getNewValue());
+                    }
+                }
+            COH_THROW (IllegalStateException::create("test"));
+            }
+    };
+
+/**
+* Records the number of events a listener had received when it ran.
+*/
+class BarrierTask
+    : public class_spec<BarrierTask,
+        extends<Object>,
+        implements<Runnable> >
+    {
+    friend class factory<BarrierTask>;
+
+    protected:
+        BarrierTask(ThreadRecordingListener::View vListener)
+            : m_cSeen(self(), -1), f_vListener(self(), vListener)
+            {
+            }
+
+    public:
+        virtual void run()
+            {
+            m_cSeen = (int32_t) f_vListener->getEventCount();
+            }
+
+        Volatile<int32_t> m_cSeen;
+        FinalView<ThreadRecordingListener> f_vListener;
+    };
+
+COH_CLOSE_NAMESPACE
+
+using test::BarrierTask;
+using test::TestEventDispatcher;
+using test::ThreadRecordingListener;
+using test::ThrowingBatchListener;
+
+/**
+* Test suite for the Service::EventDispatcher and its EventWorkers.
+*/
+class EventDispatcherTest : public CxxTest::TestSuite
+    {
+    public:
+        /**
+        * Test that with several workers each listener still receives its
+        * events on a single thread, one at a time and in order.
+        */
+        void testListenerOrdering()
+            {
+            Service::Handle             hService    = TcpInitiator::create();
+            TestEventDispatcher::Handle hDispatcher = startDispatcher(hService);
+            NamedCache::Handle          hCache      = LocalNamedCache::create();
+
+            ObjectArray::Handle haListener = ObjectArray::create(8);
+            for (size32_t i = 0; i < haListener->length; ++i)
+                {
+                haListener[i] = ThreadRecordingListener::create(false);
+                }
+
+            const int32_t cEvents = 200;
+            for (int32_t i = 0; i < cEvents; ++i)
+                {
+                for (size32_t j = 0; j < haListener->length; ++j)
+                    {
+                    // vary the key so that key affinity would not help
+                    dispatch(hDispatcher, hCache, Integer32::create(i + j), i,
+                            cast<MapListener::Handle>(haListener[j]));
+                    }
+                }
+            hDispatcher->drainQueue();
+
+            for (size32_t i = 0; i < haListener->length; ++i)
+                {
+                ThreadRecordingListener::View vListener =
+                        cast<ThreadRecordingListener::View>(haListener[i]);
+                List::View vList = vListener->f_hList;
+                TS_ASSERT_EQUALS(vList->size(), size32_t(cEvents));
+                for (int32_t j = 0, c = vList->size(); j < c; ++j)
+                    {
+                    TS_ASSERT(vList->get(j)->equals(Integer32::create(j)));
+                    }
+                TS_ASSERT_EQUALS(vListener->f_hSetThread->size(), size32_t(1));
+                TS_ASSERT(!vListener->m_fOverlap);
+                TS_ASSERT(hDispatcher->isWorkerThread(cast<Thread::View>(
+                        vListener->f_hSetThread->iterator()->next())));
+                }
+
+            stopDispatcher(hDispatcher);
+            }
+
+        /**
+        * Test that a listener which throws does not cause the tasks
+        * queued behind it on the same worker to be dropped.
+        */
+        void testListenerException()
+            {
+            Service::Handle             hService    = TcpInitiator::create();
+            TestEventDispatcher::Handle hDispatcher = startDispatcher(hService);
+            NamedCache::Handle          hCache      = LocalNamedCache::create();
+
+            ThreadRecordingListener::Handle hListenerThrow =
+                    ThreadRecordingListener::create(true);
+            ThreadRecordingListener::Handle hListener =
+                    ThreadRecordingListener::create(false);
+
+            // each failure is logged by the worker
+            int32_t nLevel = Logger::getLogger()->getLevel();
+            Logger::getLogger()->setLevel(0);
+
+            const int32_t cEvents = 10;
+            for (int32_t i = 0; i < cEvents; ++i)
+                {
+                dispatch(hDispatcher, hCache, Integer32::create(i), i, hListenerThrow);
+                dispatch(hDispatcher, hCache, Integer32::create(i), i, hListener);
+                }
+            hDispatcher->drainQueue();
+            Logger::getLogger()->setLevel(nLevel);
+
+            TS_ASSERT_EQUALS(hListenerThrow->getEventCount(), size32_t(cEvents));
+            TS_ASSERT_EQUALS(hListener->getEventCount(), size32_t(cEvents));
+
+            stopDispatcher(hDispatcher);
+            }
+
+        /**
+        * Test that a task which is not a MapEvent runs only once all
+        * events queued before it have been delivered, and that waiting for
+        * the workers is woken by them rather than by a timeout.
+        */
+        void testDrainWorkers()
+            {
+            Service::Handle             hService    = TcpInitiator::create();
+            TestEventDispatcher::Handle hDispatcher = startDispatcher(hService);
+            NamedCache::Handle          hCache      = LocalNamedCache::create();
+
+            ThreadRecordingListener::Handle hListener =
+                    ThreadRecordingListener::create(false);
+
+            const int32_t cRounds = 20;
+            int64_t       ldtStart = System::currentTimeMillis();
+            for (int32_t i = 0; i < cRounds; ++i)
+                {
+                dispatch(hDispatcher, hCache, Integer32::create(i), i, hListener);
+
+                BarrierTask::Handle hTask = BarrierTask::create(hListener);
+                hDispatcher->getQueue()->add(hTask);
+                hDispatcher->drainQueue();
+                TS_ASSERT_EQUALS(hTask->m_cSeen, i + 1);
+                }
+
+            // each drainWorkers wait is bounded to a second; were the workers
+            // not waking the dispatcher this would take at least cRounds seconds
+            TS_ASSERT(System::currentTimeMillis() - ldtStart < 10000);
+
+            stopDispatcher(hDispatcher);
+            }
+
+        /**
+        * Test that a BatchMapListener which throws does not leave the
+        * batches gathered for other listeners undelivered.
+        */
+        void testBatchListenerException()
+            {
+            Service::Handle             hService    = TcpInitiator::create();
+            TestEventDispatcher::Handle hDispatcher = startDispatcher(hService, 1);
+            NamedCache::Handle          hCache      = LocalNamedCache::create();
+
+            ObjectArray::Handle haListener = ObjectArray::create(4);
+            for (size32_t i = 0; i < haListener->length; ++i)
+                {
+                haListener[i] = ThrowingBatchListener::create();
+                }
+
+            const int32_t cEvents = 10;
+            for (int32_t i = 0; i < cEvents; ++i)
+                {
+                for (size32_t j = 0; j < haListener->length; ++j)
+                    {
+                    dispatch(hDispatcher, hCache, Integer32::create(i), i,
+                            cast<MapListener::Handle>(haListener[j]));
+                    }
+                }
+            hDispatcher->drainQueue();
+
+            // every batch is delivered, whichever listener failed first
+            for (size32_t i = 0; i < haListener->length; ++i)
+                {
+                TS_ASSERT_EQUALS(cast<ThrowingBatchListener::View>(
+                        haListener[i])->getEventCount(), size32_t(cEvents));
+                }
+
+            stopDispatcher(hDispatcher);
+            }
+
+        /**
+        * Test that a coherence.events.threads value which is not positive
+        * leaves the default single delivery thread in place.
+        */
+        void testInvalidWorkerCount()
+            {
+            Service::Handle hService = TcpInitiator::create();
+
+            System::setProperty("coherence.events.threads", "-1");
+            TestEventDispatcher::Handle hDispatcher =
+                    TestEventDispatcher::create(hService);
+            System::clearProperty("coherence.events.threads");
+            TS_ASSERT_EQUALS(hDispatcher->getWorkerCount(), size32_t(1));
+
+            System::setProperty("coherence.events.threads", "3");
+            hDispatcher = TestEventDispatcher::create(hService);
+            System::clearProperty("coherence.events.threads");
+            TS_ASSERT_EQUALS(hDispatcher->getWorkerCount(), size32_t(3));
+            }
+
+    protected:
+        static TestEventDispatcher::Handle startDispatcher(Service::View vService,
+                size32_t cWorkers = 4)
+            {
+            TestEventDispatcher::Handle hDispatcher =
+                    TestEventDispatcher::create(vService);
+            hDispatcher->setWorkerCount(cWorkers);
+            hDispatcher->start();
+
+            // the workers are created by the dispatcher thread
+            for (int32_t i = 0; cWorkers > 1 && i < 1000 && !hDispatcher->hasWorkers(); ++i)
+                {
+                Thread::sleep(5);
+                }
+            TS_ASSERT_EQUALS(hDispatcher->hasWorkers(), cWorkers > 1);
+            return hDispatcher;
+            }
+
+        static void stopDispatcher(TestEventDispatcher::Handle hDispatcher)
+            {
+            hDispatcher->stop();
+            hDispatcher->getThread()->join(5000);
+            }
+
+        static void dispatch(TestEventDispatcher::Handle hDispatcher,
+                NamedCache::Handle hCache, Object::View vKey, int32_t nValue,
+                MapListener::Handle hListener)
+            {
+            hDispatcher->getQueue()->add(RunnableCacheEvent::create(
+                    CacheEvent::create(hCache, MapEvent::entry_inserted, vKey,
+                            (Object::View) NULL, Integer32::create(nValue), false),
+                    hListener));
+            }
+    };
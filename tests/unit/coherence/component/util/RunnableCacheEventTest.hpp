@@ -0,0 +1,273 @@
+/*
+ * Copyright (c) 2000, 2026, Oracle and/or its affiliates.
+ *
+ * Licensed under the Universal Permissive License v 1.0 as shown at
+ * http://oss.oracle.com/licenses/upl.
+ */
+#include "cxxtest/TestSuite.h"
+#include "coherence/lang.ns"
+#include "mock/CommonMocks.hpp"
+
+#include "coherence/net/cache/CacheEvent.hpp"
+#include "coherence/util/ArrayList.hpp"
+#include "coherence/util/BatchMapListener.hpp"
+#include "coherence/util/ConflatingListener.hpp"
+#include "coherence/util/IdentityHashMap.hpp"
+#include "coherence/util/MultiplexingMapListener.hpp"
+
+#include "private/coherence/component/util/RunnableCacheEvent.hpp"
+
+using namespace coherence::lang;
+using coherence::component::util::RunnableCacheEvent;
+using coherence::net::cache::CacheEvent;
+using coherence::util::ArrayList;
+using coherence::util::BatchMapListener;
+using coherence::util::ConflatingListener;
+using coherence::util::IdentityHashMap;
+using coherence::util::List;
+using coherence::util::Map;
+using coherence::util::MapEvent;
+using coherence::util::MapListener;
+using coherence::util::MultiplexingMapListener;
+using mock::MockNamedCache;
+
+COH_OPEN_NAMESPACE (test)
+
+class RecordingListener
+    : public class_spec<RecordingListener,
+        extends<MultiplexingMapListener> >
+    {
+    friend class factory<RecordingListener>;
+
+    protected:
+        RecordingListener()
+            : f_hList(self(), ArrayList::create())
+            {
+            }
+
+    public:
+        virtual void onMapEvent(MapEvent::View vEvent)
+            {
+            f_hList->add(vEvent);
+            }
+
+        FinalHandle<List> f_hList;
+    };
+
+class ConflatingRecordingListener
+    : public class_spec<ConflatingRecordingListener,
+        extends<RecordingListener>,
+        implements<ConflatingListener> >
+    {
+    friend class factory<ConflatingRecordingListener>;
+    };
+
+class BatchRecordingListener
+    : public class_spec<BatchRecordingListener,
+        extends<RecordingListener>,
+        implements<BatchMapListener> >
+    {
+    friend class factory<BatchRecordingListener>;
+
+    protected:
+        BatchRecordingListener()
+            : m_cBatch(0)
+            {
+            }
+
+    public:
+        virtual void onMapEvents(ObjectArray::View vaEvent)
+            {
+            ++m_cBatch;
+            for (size32_t i = 0, c = vaEvent->length; i < c; ++i)
+                {
+                f_hList->add(vaEvent[i]);
+                }
+            }
+
+        int32_t m_cBatch;
+    };
+
+COH_CLOSE_NAMESPACE
+
+using test::BatchRecordingListener;
+using test::RecordingListener;
+using test::ConflatingRecordingListener;
+
+/**
+* Test suite for the RunnableCacheEvent class.
+*/
+class RunnableCacheEventTest : public CxxTest::TestSuite
+    {
+    public:
+        /**
+        * Test that pending events for a ConflatingListener are merged into
+        * a single net event per key.
+        */
+        void testConflate()
+            {
+            MockNamedCache::Handle hCache = MockNamedCache::create();
+            hCache->setStrict(false);
+            for (int32_t i = 0; i < 3; ++i)
+                {
+                hCache->isActive();
+                hCache->setBoolReturn(true);
+                }
+            hCache->replay();
+
+            RecordingListener::Handle hListener =
+                    ConflatingRecordingListener::create();
+            Map::Handle  hMapPending = IdentityHashMap::create();
+            List::Handle hQueue      = ArrayList::create();
+
+            String::View vsA = String::create("a");
+            String::View vsB = String::create("b");
+            String::View vsC = String::create("c");
+
+            // insert + update => insert
+            enqueue(hQueue, hMapPending, hListener, CacheEvent::create(hCache,
+                    MapEvent::entry_inserted, vsA, (Object::View) NULL,
+                    Integer32::create(1), false));
+            enqueue(hQueue, hMapPending, hListener, CacheEvent::create(hCache,
+                    MapEvent::entry_updated, vsA, Integer32::create(1),
+                    Integer32::create(2), false));
+
+            // insert + delete => nothing
+            enqueue(hQueue, hMapPending, hListener, CacheEvent::create(hCache,
+                    MapEvent::entry_inserted, vsB, (Object::View) NULL,
+                    Integer32::create(1), false));
+            enqueue(hQueue, hMapPending, hListener, CacheEvent::create(hCache,
+                    MapEvent::entry_deleted, vsB, Integer32::create(1),
+                    (Object::View) NULL, false));
+
+            // update + update + delete => delete of the original value
+            enqueue(hQueue, hMapPending, hListener, CacheEvent::create(hCache,
+                    MapEvent::entry_updated, vsC, Integer32::create(1),
+                    Integer32::create(2), false));
+            enqueue(hQueue, hMapPending, hListener, CacheEvent::create(hCache,
+                    MapEvent::entry_updated, vsC, Integer32::create(2),
+                    Integer32::create(3), false));
+            enqueue(hQueue, hMapPending, hListener, CacheEvent::create(hCache,
+                    MapEvent::entry_deleted, vsC, Integer32::create(3),
+                    (Object::View) NULL, false));
+
+            TS_ASSERT_EQUALS(hQueue->size(), size32_t(3));
+            for (size32_t i = 0, c = hQueue->size(); i < c; ++i)
+                {
+                cast<RunnableCacheEvent::Handle>(hQueue->get(i))->run();
+                }
+            TS_ASSERT(hMapPending->isEmpty());
+
+            List::View vList = hListener->f_hList;
+            TS_ASSERT_EQUALS(vList->size(), size32_t(2));
+
+            MapEvent::View vEvt = cast<MapEvent::View>(vList->get(0));
+            TS_ASSERT_EQUALS(vEvt->getId(), MapEvent::entry_inserted);
+            TS_ASSERT(vEvt->getKey()->equals(vsA));
+            TS_ASSERT(NULL == vEvt->getOldValue());
+            TS_ASSERT(vEvt->getNewValue()->equals(Integer32::create(2)));
+
+            vEvt = cast<MapEvent::View>(vList->get(1));
+            TS_ASSERT_EQUALS(vEvt->getId(), MapEvent::entry_deleted);
+            TS_ASSERT(vEvt->getKey()->equals(vsC));
+            TS_ASSERT(vEvt->getOldValue()->equals(Integer32::create(1)));
+            TS_ASSERT(NULL == vEvt->getNewValue());
+
+            // once run, later events are no longer merged into the task
+            TS_ASSERT(!RunnableCacheEvent::conflate(RunnableCacheEvent::create(
+                    CacheEvent::create(hCache, MapEvent::entry_updated, vsA,
+                            Integer32::create(2), Integer32::create(3), false),
+                    (MapListener::Handle) hListener), hMapPending));
+            }
+
+        /**
+        * Test that events for listeners which are not ConflatingListeners,
+        * and events which cannot be merged, are all delivered.
+        */
+        void testNoConflate()
+            {
+            MockNamedCache::Handle hCache = MockNamedCache::create();
+            hCache->setStrict(false);
+            hCache->replay();
+
+            Map::Handle hMapPending = IdentityHashMap::create();
+            List::Handle hQueue     = ArrayList::create();
+            String::View vsA        = String::create("a");
+
+            RecordingListener::Handle hListener = RecordingListener::create();
+            enqueue(hQueue, hMapPending, hListener, CacheEvent::create(hCache,
+                    MapEvent::entry_inserted, vsA, (Object::View) NULL,
+                    Integer32::create(1), false));
+            enqueue(hQueue, hMapPending, hListener, CacheEvent::create(hCache,
+                    MapEvent::entry_updated, vsA, Integer32::create(1),
+                    Integer32::create(2), false));
+            TS_ASSERT_EQUALS(hQueue->size(), size32_t(2));
+            TS_ASSERT(hMapPending->isEmpty());
+
+            // synthetic and regular events are kept apart
+            hQueue->clear();
+            hListener = ConflatingRecordingListener::create();
+            enqueue(hQueue, hMapPending, hListener, CacheEvent::create(hCache,
+                    MapEvent::entry_updated, vsA, Integer32::create(1),
+                    Integer32::create(2), false));
+            enqueue(hQueue, hMapPending, hListener, CacheEvent::create(hCache,
+                    MapEvent::entry_deleted, vsA, Integer32::create(2),
+                    (Object::View) NULL, true));
+            TS_ASSERT_EQUALS(hQueue->size(), size32_t(2));
+            }
+
+        /**
+        * Test that dispatchBatch delivers the events of several tasks
+        * through a single call.
+        */
+        void testDispatchBatch()
+            {
+            MockNamedCache::Handle hCache = MockNamedCache::create();
+            hCache->setStrict(false);
+            for (int32_t i = 0; i < 3; ++i)
+                {
+                hCache->isActive();
+                hCache->setBoolReturn(true);
+                }
+            hCache->replay();
+
+            BatchRecordingListener::Handle hListener =
+                    BatchRecordingListener::create();
+            List::Handle hListTask = ArrayList::create();
+            for (int32_t i = 0; i < 3; ++i)
+                {
+                RunnableCacheEvent::Handle hTask = RunnableCacheEvent::create(
+                        CacheEvent::create(hCache, MapEvent::entry_updated,
+                                Integer32::create(i), Integer32::create(i),
+                                Integer32::create(i + 1), false),
+                        (MapListener::Handle) hListener);
+                TS_ASSERT(hTask->isBatching());
+                hListTask->add(hTask);
+                }
+
+            RunnableCacheEvent::dispatchBatch(hListTask);
+
+            TS_ASSERT_EQUALS(hListener->m_cBatch, 1);
+            TS_ASSERT_EQUALS(hListener->f_hList->size(), size32_t(3));
+            for (int32_t i = 0; i < 3; ++i)
+                {
+                TS_ASSERT(cast<MapEvent::View>(hListener->f_hList->get(i))
+                        ->getKey()->equals(Integer32::create(i)));
+                }
+            }
+
+    protected:
+        /**
+        * Queue a task for the specified event unless it was conflated.
+        */
+        void enqueue(List::Handle hQueue, Map::Handle hMapPending,
+                MapListener::Handle hListener, MapEvent::Handle hEvent)
+            {
+            RunnableCacheEvent::Handle hTask =
+                    RunnableCacheEvent::create(hEvent, hListener);
+            if (!RunnableCacheEvent::conflate(hTask, hMapPending))
+                {
+                hQueue->add(hTask);
+                }
+            }
+    };
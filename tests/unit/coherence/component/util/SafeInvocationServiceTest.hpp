@@ -70,6 +70,30 @@ class SafeInvocationServiceTest : public CxxTest::TestSuite
         hMockWrappedService->verify();
         }
 
+    void testExecute()
+        {
+        SafeInvocationService::Handle hService = SafeInvocationService::create();
+        MockRemoteInvocationService::Handle hMockWrappedService = MockRemoteInvocationService::create();
+        hService->setService(hMockWrappedService);
+        hMockWrappedService->setStrict(true);
+
+        //set expectations
+        Set::View set = DummySet::create();
+        Invocable::Handle invocable = DummyInvocable::create();
+
+        hMockWrappedService->isRunning();
+        hMockWrappedService->lastExpectation()->setBoolReturn(true);
+
+        hMockWrappedService->execute(invocable, set, NULL);
+
+        //replay
+        hMockWrappedService->replay();
+        hService->execute(invocable, set, NULL);
+
+        //verify
+        hMockWrappedService->verify();
+        }
+
     void testGetConfig()
         {
         SafeInvocationService::Handle hService = SafeInvocationService::create();
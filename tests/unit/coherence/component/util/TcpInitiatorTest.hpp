@@ -8,7 +8,10 @@
 
 #include "coherence/lang.ns"
 
+#include "coherence/net/AddressProvider.hpp"
 #include "coherence/net/DefaultOperationalContext.hpp"
+#include "coherence/net/InetSocketAddress.hpp"
+#include "coherence/net/messaging/ConnectionException.hpp"
 #include "coherence/run/xml/XmlElement.hpp"
 
 #include "private/coherence/component/util/TcpInitiator.hpp"
@@ -18,11 +21,81 @@ using namespace coherence::lang;
 using namespace std;
 
 using coherence::component::util::TcpInitiator;
+using coherence::net::AddressProvider;
 using coherence::net::DefaultOperationalContext;
+using coherence::net::InetSocketAddress;
+using coherence::net::messaging::ConnectionException;
 using coherence::run::xml::SimpleParser;
 using coherence::run::xml::XmlElement;
 
 
+/**
+* TcpInitiator which exposes openConnection.
+*/
+class TestTcpInitiator
+    : public class_spec<TestTcpInitiator,
+        extends<TcpInitiator> >
+    {
+    friend class factory<TestTcpInitiator>;
+
+    public:
+        void open()
+            {
+            openConnection();
+            }
+    };
+
+
+/**
+* AddressProvider which hands out ports 1..n of the loopback address in
+* turn, returning NULL at the end of each pass, and counts the outcomes it
+* is told of.
+*/
+class CountingAddressProvider
+    : public class_spec<CountingAddressProvider,
+        extends<Object>,
+        implements<AddressProvider> >
+    {
+    friend class factory<CountingAddressProvider>;
+
+    protected:
+        CountingAddressProvider(int32_t cAddr)
+            : m_cAddr(cAddr), m_iNext(0), m_cPass(0), m_cAccept(0),
+              m_cReject(0)
+            {
+            }
+
+    public:
+        virtual InetSocketAddress::View getNextAddress()
+            {
+            if (m_iNext == m_cAddr)
+                {
+                m_iNext = 0;
+                ++m_cPass;
+                return NULL;
+                }
+            return InetSocketAddress::create((String::View) "127.0.0.1",
+                    (uint16_t) ++m_iNext);
+            }
+
+        virtual void accept()
+            {
+            ++m_cAccept;
+            }
+
+        virtual void reject(Exception::Holder /*oheCause*/)
+            {
+            ++m_cReject;
+            }
+
+        int32_t m_cAddr;
+        int32_t m_iNext;
+        int32_t m_cPass;
+        int32_t m_cAccept;
+        int32_t m_cReject;
+    };
+
+
 /**
 * TcpInitiator Unit Test Suite.
 */
@@ -106,6 +179,104 @@ class TcpInitiatorTest : public CxxTest::TestSuite
             TS_ASSERT(hInitiator->getConnectTimeout() == hInitiator->getRequestTimeout());
             }
 
+        /**
+        * Test racing connect attempts to several addresses.
+        */
+        void testConnectParallelism()
+            {
+            stringstream ss;
+                ss  << "         <initiator-config>"
+                    << "            <tcp-initiator>"
+                    << "               <remote-addresses>"
+                    << "                  <socket-address>"
+                    << "                     <address>127.0.0.1</address>"
+                    << "                     <port>1</port>"
+                    << "                  </socket-address>"
+                    << "                  <socket-address>"
+                    << "                     <address>127.0.0.1</address>"
+                    << "                     <port>2</port>"
+                    << "                  </socket-address>"
+                    << "               </remote-addresses>"
+                    << "            </tcp-initiator>"
+                    << "            <connect-timeout>5s</connect-timeout>"
+                    << "         </initiator-config>";
+            TcpInitiator::Handle hInitiator = loadConfig(&ss);
+            TS_ASSERT(hInitiator->getConnectParallelism() == 1);
+
+            System::setProperty("coherence.tcp.connect.parallel", "2");
+            try
+                {
+                ss.clear();
+                ss.seekg(0);
+                hInitiator = loadConfig(&ss);
+                System::clearProperty("coherence.tcp.connect.parallel");
+                }
+            catch (...)
+                {
+                System::clearProperty("coherence.tcp.connect.parallel");
+                throw;
+                }
+            TS_ASSERT(hInitiator->getConnectParallelism() == 2);
+
+            // both attempts are refused, and both addresses are reported
+            try
+                {
+                cast<TestTcpInitiator::Handle>(hInitiator)->open();
+                TS_FAIL("expected ConnectionException");
+                }
+            catch (ConnectionException::View e)
+                {
+                String::View vsMsg = e->getMessage();
+                TS_ASSERT(vsMsg->indexOf(":1") != String::npos);
+                TS_ASSERT(vsMsg->indexOf(":2") != String::npos);
+                }
+            }
+
+        /**
+        * Test that racing connects gives up after a single pass over the
+        * addresses when none of them can be reached, even though the
+        * number of addresses is not a multiple of the parallelism.
+        */
+        void testConnectParallelismExhausted()
+            {
+            stringstream ss;
+                ss  << "         <initiator-config>"
+                    << "            <tcp-initiator>"
+                    << "               <remote-addresses>"
+                    << "                  <socket-address>"
+                    << "                     <address>127.0.0.1</address>"
+                    << "                     <port>1</port>"
+                    << "                  </socket-address>"
+                    << "               </remote-addresses>"
+                    << "            </tcp-initiator>"
+                    << "            <connect-timeout>5s</connect-timeout>"
+                    << "         </initiator-config>";
+            TcpInitiator::Handle hInitiator = loadConfig(&ss);
+
+            CountingAddressProvider::Handle hProvider =
+                    CountingAddressProvider::create(3);
+            hInitiator->setRemoteAddressProvider(hProvider);
+            hInitiator->setConnectParallelism(2);
+
+            try
+                {
+                cast<TestTcpInitiator::Handle>(hInitiator)->open();
+                TS_FAIL("expected ConnectionException");
+                }
+            catch (ConnectionException::View e)
+                {
+                String::View vsMsg = e->getMessage();
+                TS_ASSERT(vsMsg->indexOf(":1") != String::npos);
+                TS_ASSERT(vsMsg->indexOf(":2") != String::npos);
+                TS_ASSERT(vsMsg->indexOf(":3") != String::npos);
+                }
+
+            // each address is tried and rejected exactly once
+            TS_ASSERT_EQUALS(hProvider->m_cPass, 1);
+            TS_ASSERT_EQUALS(hProvider->m_cReject, 3);
+            TS_ASSERT_EQUALS(hProvider->m_cAccept, 0);
+            }
+
     private:
 
         /**
@@ -113,7 +284,7 @@ class TcpInitiatorTest : public CxxTest::TestSuite
          */
         TcpInitiator::Handle loadConfig(stringstream *ss)
             {
-            TcpInitiator::Handle hInitiator = TcpInitiator::create();
+            TcpInitiator::Handle hInitiator = TestTcpInitiator::create();
             hInitiator->setOperationalContext(DefaultOperationalContext::create());
 
             XmlElement::Handle hXml = SimpleParser::create()->parseXml(*ss);
@@ -41,4 +41,131 @@ class AllocatorTest : public CxxTest::TestSuite
                     }
                 }
             }
+
+        /**
+        * Test that allocations are served by the matching size class.
+        */
+        void testSizeClasses()
+            {
+            size_t cClasses = Allocator::getSizeClassCount();
+            TS_ASSERT(cClasses > 0);
+            TS_ASSERT(Allocator::getSizeClassSlotSize(cClasses) == 0);
+
+            for (size_t i = 0; i < cClasses; ++i)
+                {
+                size_t cbSlot = Allocator::getSizeClassSlotSize(i);
+                if (i > 0)
+                    {
+                    TS_ASSERT(cbSlot == Allocator::getSizeClassSlotSize(i - 1) * 2);
+                    }
+
+                size_t cBefore = Allocator::getSizeClassHits(i) +
+                        Allocator::getSizeClassMisses(i);
+
+                void* ab = Allocator::allocate(cbSlot - cbSlot / 4);
+                TS_ASSERT(ab != NULL);
+                Allocator::release(ab);
+
+                TS_ASSERT(Allocator::getSizeClassHits(i) +
+                        Allocator::getSizeClassMisses(i) == cBefore + 1);
+                }
+            }
+
+        /**
+        * Test that blocks allocated within an arena scope may outlive it.
+        */
+        void testArenaScope()
+            {
+            size_t       cbArena  = Allocator::setArenaSize(65536);
+            const size_t c        = 10000;
+            size_t       cHits    = Allocator::getArenaHits();
+            size_t       cRewinds = Allocator::getArenaRewinds();
+            void**       aab      = new void*[c];
+            String::View vs;
+            {
+            Allocator::ArenaScope scope;
+            for (size_t i = 0; i < c; ++i)
+                {
+                unsigned char* ab = (unsigned char*) Allocator::allocate(64);
+                TS_ASSERT(ab[0] == 0 && ab[63] == 0);
+                ab[0] = ab[63] = 0xFF;
+                aab[i] = ab;
+                }
+            vs = COH_TO_STRING("arena " << c);
+            }
+
+            TS_ASSERT(Allocator::getArenaHits() - cHits > c);
+
+            // live blocks prevent the chunk from being recycled
+            TS_ASSERT(Allocator::getArenaRewinds() == cRewinds);
+
+            for (size_t i = 0; i < c; ++i)
+                {
+                Allocator::release(aab[i]);
+                }
+            delete[] aab;
+
+            // the String survives the scope and the release of its
+            // neighbours
+            TS_ASSERT(vs->equals("arena 10000"));
+
+            Allocator::setArenaSize(cbArena);
+            }
+
+        /**
+        * Test that a chunk is recycled in bulk when none of the blocks
+        * allocated within the scope survive it.
+        */
+        void testArenaRewind()
+            {
+            size_t cbArena = Allocator::setArenaSize(65536);
+            void*  abFirst = NULL;
+
+            for (int32_t i = 0; i < 3; ++i)
+                {
+                size_t cHits    = Allocator::getArenaHits();
+                size_t cRewinds = Allocator::getArenaRewinds();
+                {
+                Allocator::ArenaScope scope;
+                void* ab = Allocator::allocate(64);
+                {
+                Allocator::ArenaScope scopeNested;
+                for (int32_t j = 0; j < 100; ++j)
+                    {
+                    Allocator::release(Allocator::allocate(128));
+                    }
+                }
+                // only the outermost scope recycles the chunk
+                TS_ASSERT(Allocator::getArenaRewinds() == cRewinds);
+                Allocator::release(ab);
+
+                if (i == 1)
+                    {
+                    abFirst = ab;
+                    }
+                else if (i == 2)
+                    {
+                    // the rewound chunk is reused from its start
+                    TS_ASSERT(ab == abFirst);
+                    }
+                }
+                TS_ASSERT(Allocator::getArenaHits() - cHits == 101);
+                TS_ASSERT(Allocator::getArenaRewinds() == cRewinds + 1);
+                }
+
+            // allocations outside of a scope do not use the arena
+            size_t cHits = Allocator::getArenaHits();
+            Allocator::release(Allocator::allocate(64));
+            TS_ASSERT(Allocator::getArenaHits() == cHits);
+
+            // disabled arenas are not used within a scope
+            Allocator::setArenaSize(0);
+            {
+            Allocator::ArenaScope scope;
+            Allocator::release(Allocator::allocate(64));
+            }
+            TS_ASSERT(Allocator::getArenaHits() == cHits);
+
+            Allocator::setArenaSize(cbArena);
+            }
     };
@@ -46,6 +46,48 @@ class TestObject
         bool fInit;
     };
 
+class SyncIncrementer
+        : public class_spec<SyncIncrementer,
+            extends<Object>,
+            implements<Runnable> >
+    {
+    friend class factory<SyncIncrementer>;
+
+    protected:
+        SyncIncrementer(Object::View vMonitor, int32_t cIters)
+                : m_vMonitor(self(), vMonitor), m_cIters(cIters), m_cCount(0)
+            {
+            }
+
+    public:
+        virtual void run()
+            {
+            Object::View vMonitor = m_vMonitor;
+            for (int32_t i = 0; i < m_cIters; ++i)
+                {
+                COH_SYNCHRONIZED (vMonitor)
+                    {
+                    COH_SYNCHRONIZED (vMonitor) // recursive
+                        {
+                        int32_t c = m_cCount;
+                        Thread::yield();
+                        m_cCount = c + 1;
+                        }
+                    }
+                }
+            }
+
+        int32_t getCount() const
+            {
+            return m_cCount;
+            }
+
+    protected:
+        FinalView<Object> m_vMonitor;
+        int32_t           m_cIters;
+        int32_t           m_cCount;
+    };
+
 COH_CLOSE_NAMESPACE_ANON
 
 /**
@@ -378,4 +420,109 @@ class ObjectTest : public CxxTest::TestSuite
             TS_ASSERT(cbV < v->sizeOf(true));
             cbV = v->sizeOf(true);
             }
+
+        /**
+        * Run synchronization over an escaped Object from multiple threads,
+        * including recursion and waiting within a recursively held monitor.
+        */
+        static void assertSynchronizedEscaped()
+            {
+            Object::View vMonitor = Object::create();
+            MemberView<Object> vm(System::common(), vMonitor); // escape
+
+            SyncIncrementer::Handle hInc = SyncIncrementer::create(vMonitor, 1000);
+            Thread::Handle          ahThread[4];
+            for (int32_t i = 0; i < 4; ++i)
+                {
+                ahThread[i] = Thread::create(hInc);
+                ahThread[i]->start();
+                }
+            for (int32_t i = 0; i < 4; ++i)
+                {
+                ahThread[i]->join();
+                }
+            TS_ASSERT(hInc->getCount() == 4000);
+
+            // wait and notify within a recursively held monitor
+            COH_SYNCHRONIZED (vMonitor)
+                {
+                COH_SYNCHRONIZED (vMonitor)
+                    {
+                    vMonitor->notifyAll();
+                    vMonitor->wait(1);
+                    }
+                vMonitor->notify();
+                }
+            }
+
+        void testSynchronizedEscaped()
+            {
+            assertSynchronizedEscaped();
+            }
+
+        void testSynchronizedThin()
+            {
+            bool fThin = Object::_setThinMonitorEnabled(true);
+            assertSynchronizedEscaped();
+            Object::_setThinMonitorEnabled(fThin);
+            }
+
+        void testThinMonitorSizeOf()
+            {
+            bool fThin = Object::_setThinMonitorEnabled(true);
+
+            Object::View       v = Object::create();
+            MemberView<Object> vm(System::common(), v); // escape
+            size64_t           cb = v->sizeOf(true);
+
+            // test that syncing on an escaped object is free
+            COH_SYNCHRONIZED (v)
+                {
+                COH_SYNCHRONIZED (v)
+                    {
+                    v->notifyAll();
+                    }
+                }
+            TS_ASSERT(cb == v->sizeOf(true));
+
+            // test that waiting inflates the monitor
+            COH_SYNCHRONIZED (v)
+                {
+                v->wait(1);
+                }
+            TS_ASSERT(cb < v->sizeOf(true));
+
+            Object::_setThinMonitorEnabled(fThin);
+            }
+
+        void testThinMonitorDisabledWhileHeld()
+            {
+            bool fThin = Object::_setThinMonitorEnabled(true);
+
+            Object::View       v = Object::create();
+            MemberView<Object> vm(System::common(), v); // escape
+            size64_t           cb = v->sizeOf(true);
+
+            COH_SYNCHRONIZED (v)
+                {
+                // disabling leaves the held thin monitor intact
+                TS_ASSERT(Object::_setThinMonitorEnabled(false));
+                TS_ASSERT(cb == v->sizeOf(true));
+
+                // a recursive enter now inflates, taking over the holds
+                COH_SYNCHRONIZED (v)
+                    {
+                    TS_ASSERT(cb < v->sizeOf(true));
+                    }
+                }
+
+            // the monitor is usable by other threads once released
+            SyncIncrementer::Handle hInc = SyncIncrementer::create(v, 100);
+            Thread::Handle          hThread = Thread::create(hInc);
+            hThread->start();
+            hThread->join();
+            TS_ASSERT(hInc->getCount() == 100);
+
+            Object::_setThinMonitorEnabled(fThin);
+            }
     };
@@ -8,20 +8,135 @@
 
 #include "coherence/lang.ns"
 
+#include "coherence/net/CacheFactory.hpp"
 #include "coherence/net/DefaultConfigurableCacheFactory.hpp"
 #include "coherence/net/NamedCache.hpp"
 
+#include "coherence/run/xml/XmlElement.hpp"
+
+#include "coherence/security/RunAsBlock.hpp"
+#include "coherence/security/auth/GenericSubject.hpp"
+
+#include "coherence/util/ArrayList.hpp"
+#include "coherence/util/HashSet.hpp"
+#include "coherence/util/Map.hpp"
+
+#include "private/coherence/security/SecurityHelper.hpp"
+
 #include <sstream>
 
 using namespace coherence::lang;
 using namespace std;
 
+using coherence::net::CacheFactory;
 using coherence::net::DefaultConfigurableCacheFactory;
 using coherence::net::NamedCache;
+using coherence::run::xml::XmlElement;
+using coherence::security::SecurityHelper;
+using coherence::security::auth::GenericSubject;
+using coherence::security::auth::Subject;
+using coherence::util::ArrayList;
+using coherence::util::HashSet;
+using coherence::util::Map;
+using coherence::util::Set;
 
 /**
  * DefaultConfigurableCacheFactory test suite
  */
+/**
+* DefaultConfigurableCacheFactory which records the Subject each local
+* cache is created as.
+*/
+class SubjectRecordingCacheFactory
+    : public class_spec<SubjectRecordingCacheFactory,
+        extends<DefaultConfigurableCacheFactory> >
+    {
+    friend class factory<SubjectRecordingCacheFactory>;
+
+    protected:
+        SubjectRecordingCacheFactory()
+            : f_hSetSubject(self(), HashSet::create())
+            {
+            }
+
+    public:
+        virtual NamedCache::Handle instantiateLocalCache(CacheInfo::View vInfo,
+                XmlElement::View vXmlScheme)
+            {
+            Subject::View vSubject = SecurityHelper::getCurrentSubject();
+            COH_SYNCHRONIZED (this)
+                {
+                f_hSetSubject->add(vSubject);
+                }
+            return super::instantiateLocalCache(vInfo, vXmlScheme);
+            }
+
+        FinalHandle<Set> f_hSetSubject;
+    };
+
+/**
+* DefaultConfigurableCacheFactory which counts the local caches it creates,
+* and takes a while to create each of them.
+*/
+class SlowCacheFactory
+    : public class_spec<SlowCacheFactory,
+        extends<DefaultConfigurableCacheFactory> >
+    {
+    friend class factory<SlowCacheFactory>;
+
+    protected:
+        SlowCacheFactory()
+            : m_cCaches(0)
+            {
+            }
+
+    public:
+        virtual NamedCache::Handle instantiateLocalCache(CacheInfo::View vInfo,
+                XmlElement::View vXmlScheme)
+            {
+            COH_SYNCHRONIZED (this)
+                {
+                ++m_cCaches;
+                }
+            Thread::sleep(50);
+            return super::instantiateLocalCache(vInfo, vXmlScheme);
+            }
+
+        int32_t m_cCaches;
+    };
+
+/**
+* Runnable which ensures a cache through ensureConfiguredCache and records
+* the result.
+*/
+class EnsureCacheTask
+    : public class_spec<EnsureCacheTask,
+        extends<Object>,
+        implements<Runnable> >
+    {
+    friend class factory<EnsureCacheTask>;
+
+    protected:
+        EnsureCacheTask(DefaultConfigurableCacheFactory::Handle hCCF,
+                String::View vsName)
+            : f_hCCF(self(), hCCF), f_vsName(self(), vsName), m_hCache(self())
+            {
+            }
+
+    public:
+        virtual void run()
+            {
+            DefaultConfigurableCacheFactory::CacheInfo::View vInfo =
+                    f_hCCF->findSchemeMapping(f_vsName);
+            m_hCache = f_hCCF->ensureConfiguredCache(vInfo,
+                    f_hCCF->resolveScheme(vInfo));
+            }
+
+        FinalHandle<DefaultConfigurableCacheFactory> f_hCCF;
+        FinalView<String>                            f_vsName;
+        MemberHandle<NamedCache>                     m_hCache;
+    };
+
 class DefaultConfigurableCacheFactoryTest : public CxxTest::TestSuite
     {
     public:
@@ -56,4 +171,277 @@ class DefaultConfigurableCacheFactoryTest : public CxxTest::TestSuite
                 System::setProperty("coherence.cacheconfig", vsCacheConfig);
                 }
             }
+
+        /**
+         * Test ensuring a number of caches at once.
+         */
+        void testEnsureCaches()
+            {
+            stringstream ss;
+            ss << "<cache-config>"
+               << "  <caching-scheme-mapping>"
+               << "    <cache-mapping>"
+               << "      <cache-name>local-*</cache-name>"
+               << "      <scheme-name>example-local</scheme-name>"
+               << "    </cache-mapping>"
+               << "  </caching-scheme-mapping>"
+               << "  <caching-schemes>"
+               << "    <local-scheme>"
+               << "      <scheme-name>example-local</scheme-name>"
+               << "    </local-scheme>"
+               << "  </caching-schemes>"
+               << "</cache-config>";
+
+            DefaultConfigurableCacheFactory::Handle hCCF = DefaultConfigurableCacheFactory::create();
+            hCCF->setConfig(CacheFactory::loadXml(ss));
+            hCCF->setEnsureCacheParallelism(4);
+
+            NamedCache::Handle hCacheExisting = hCCF->ensureCache("local-0");
+
+            ArrayList::Handle hListNames = ArrayList::create();
+            for (int32_t i = 0; i < 20; ++i)
+                {
+                hListNames->add(COH_TO_STRING("local-" << i));
+                }
+            hListNames->add(String::create("local-1"));
+
+            Map::View vMapCaches = hCCF->ensureCaches(hListNames);
+            TS_ASSERT(vMapCaches->size() == 20);
+            TS_ASSERT(vMapCaches->get(String::create("local-0")) == hCacheExisting);
+
+            for (int32_t i = 0; i < 20; ++i)
+                {
+                String::View       vsName = COH_TO_STRING("local-" << i);
+                NamedCache::Handle hCache = cast<NamedCache::Handle>(vMapCaches->get(vsName));
+
+                TS_ASSERT(hCache->getCacheName()->equals(vsName));
+                TS_ASSERT(hCache == hCCF->ensureCache(vsName));
+                }
+
+            // unmapped cache names are reported once the others are ensured
+            hListNames->add(String::create("unmapped"));
+            TS_ASSERT_THROWS(hCCF->ensureCaches(hListNames), IllegalArgumentException::View);
+
+            hCCF->shutdown();
+            }
+
+        /**
+         * Test that ensureCaches configures every cache as the calling
+         * Subject, whichever thread configures it.
+         */
+        void testEnsureCachesSubject()
+            {
+            stringstream ss;
+            ss << "<cache-config>"
+               << "  <caching-scheme-mapping>"
+               << "    <cache-mapping>"
+               << "      <cache-name>local-*</cache-name>"
+               << "      <scheme-name>example-local</scheme-name>"
+               << "    </cache-mapping>"
+               << "  </caching-scheme-mapping>"
+               << "  <caching-schemes>"
+               << "    <local-scheme>"
+               << "      <scheme-name>example-local</scheme-name>"
+               << "    </local-scheme>"
+               << "  </caching-schemes>"
+               << "</cache-config>";
+
+            SubjectRecordingCacheFactory::Handle hCCF = SubjectRecordingCacheFactory::create();
+            hCCF->setConfig(CacheFactory::loadXml(ss));
+            hCCF->setEnsureCacheParallelism(4);
+
+            ArrayList::Handle hListNames = ArrayList::create();
+            for (int32_t i = 0; i < 20; ++i)
+                {
+                hListNames->add(COH_TO_STRING("local-" << i));
+                }
+
+            Subject::View vSubject = GenericSubject::create("user");
+            COH_RUN_AS (vSubject)
+                {
+                Map::View vMapCaches = hCCF->ensureCaches(hListNames);
+                TS_ASSERT(vMapCaches->size() == 20);
+
+                // the caches are found again by the same Subject
+                for (int32_t i = 0; i < 20; ++i)
+                    {
+                    String::View vsName = COH_TO_STRING("local-" << i);
+                    TS_ASSERT(vMapCaches->get(vsName) == hCCF->ensureCache(vsName));
+                    }
+                }
+
+            TS_ASSERT(hCCF->f_hSetSubject->size() == 1);
+            TS_ASSERT(hCCF->f_hSetSubject->contains(vSubject));
+
+            hCCF->shutdown();
+            }
+
+        /**
+         * Test that concurrent callers ensuring the same cache configure it
+         * only once and all receive the registered cache.
+         */
+        void testEnsureCacheConcurrently()
+            {
+            stringstream ss;
+            ss << "<cache-config>"
+               << "  <caching-scheme-mapping>"
+               << "    <cache-mapping>"
+               << "      <cache-name>local-*</cache-name>"
+               << "      <scheme-name>example-local</scheme-name>"
+               << "    </cache-mapping>"
+               << "  </caching-scheme-mapping>"
+               << "  <caching-schemes>"
+               << "    <local-scheme>"
+               << "      <scheme-name>example-local</scheme-name>"
+               << "    </local-scheme>"
+               << "  </caching-schemes>"
+               << "</cache-config>";
+
+            SlowCacheFactory::Handle hCCF = SlowCacheFactory::create();
+            hCCF->setConfig(CacheFactory::loadXml(ss));
+
+            const size32_t      cThreads = 6;
+            ObjectArray::Handle haTask   = ObjectArray::create(cThreads);
+            ObjectArray::Handle haThread = ObjectArray::create(cThreads);
+            for (size32_t i = 0; i < cThreads; ++i)
+                {
+                haTask[i]   = EnsureCacheTask::create(hCCF, "local-shared");
+                haThread[i] = Thread::create(cast<Runnable::Handle>(haTask[i]));
+                cast<Thread::Handle>(haThread[i])->start();
+                }
+            for (size32_t i = 0; i < cThreads; ++i)
+                {
+                cast<Thread::Handle>(haThread[i])->join();
+                }
+
+            TS_ASSERT_EQUALS(hCCF->m_cCaches, 1);
+
+            NamedCache::Handle hCache = hCCF->ensureCache("local-shared");
+            TS_ASSERT(hCache->isActive());
+            for (size32_t i = 0; i < cThreads; ++i)
+                {
+                TS_ASSERT(cast<EnsureCacheTask::View>(haTask[i])->m_hCache == hCache);
+                }
+
+            hCCF->shutdown();
+            }
+
+        /**
+         * Test that an invalid coherence.cachefactory.ensure.parallel value
+         * does not prevent the factory from being created.
+         */
+        void testEnsureCacheParallelismProperty()
+            {
+            DefaultConfigurableCacheFactory::Handle hCCF;
+            System::setProperty("coherence.cachefactory.ensure.parallel", "lots");
+            try
+                {
+                hCCF = DefaultConfigurableCacheFactory::create();
+                }
+            catch (Exception::View)
+                {
+                }
+            System::clearProperty("coherence.cachefactory.ensure.parallel");
+            TS_ASSERT(NULL != hCCF && hCCF->getEnsureCacheParallelism() == 8);
+
+            System::setProperty("coherence.cachefactory.ensure.parallel", "3");
+            hCCF = DefaultConfigurableCacheFactory::create();
+            System::clearProperty("coherence.cachefactory.ensure.parallel");
+            TS_ASSERT_EQUALS(hCCF->getEnsureCacheParallelism(), 3);
+            }
+
+        /**
+         * Test the resolution of cache names to scheme mappings.
+         */
+        void testFindSchemeMapping()
+            {
+            stringstream ss;
+            ss << "<cache-config>"
+               << "  <caching-scheme-mapping>"
+               << "    <cache-mapping>"
+               << "      <cache-name>*</cache-name>"
+               << "      <scheme-name>default</scheme-name>"
+               << "      <init-params>"
+               << "        <init-param>"
+               << "          <param-name>name</param-name>"
+               << "          <param-value>all-*</param-value>"
+               << "        </init-param>"
+               << "      </init-params>"
+               << "    </cache-mapping>"
+               << "    <cache-mapping>"
+               << "      <cache-name>tenant-x*</cache-name>"
+               << "      <scheme-name>tenant-x</scheme-name>"
+               << "    </cache-mapping>"
+               << "    <cache-mapping>"
+               << "      <cache-name>t*</cache-name>"
+               << "      <scheme-name>t</scheme-name>"
+               << "    </cache-mapping>"
+               << "    <cache-mapping>"
+               << "      <cache-name>tenant-*</cache-name>"
+               << "      <scheme-name>tenant</scheme-name>"
+               << "      <init-params>"
+               << "        <init-param>"
+               << "          <param-name>name</param-name>"
+               << "          <param-value>t-*-x</param-value>"
+               << "        </init-param>"
+               << "        <init-param>"
+               << "          <param-name>size</param-name>"
+               << "          <param-value>10</param-value>"
+               << "        </init-param>"
+               << "      </init-params>"
+               << "    </cache-mapping>"
+               << "    <cache-mapping>"
+               << "      <cache-name>tenant-b</cache-name>"
+               << "      <scheme-name>tenant-b</scheme-name>"
+               << "    </cache-mapping>"
+               << "    <cache-mapping>"
+               << "      <cache-name>bad*pattern</cache-name>"
+               << "      <scheme-name>bad</scheme-name>"
+               << "    </cache-mapping>"
+               << "  </caching-scheme-mapping>"
+               << "  <caching-schemes>"
+               << "    <local-scheme>"
+               << "      <scheme-name>default</scheme-name>"
+               << "      <service-name>LocalCache</service-name>"
+               << "    </local-scheme>"
+               << "  </caching-schemes>"
+               << "</cache-config>";
+
+            DefaultConfigurableCacheFactory::Handle hCCF = DefaultConfigurableCacheFactory::create();
+            hCCF->setConfig(CacheFactory::loadXml(ss));
+
+            // exact matches are preferred over any wildcard
+            DefaultConfigurableCacheFactory::CacheInfo::View vInfo =
+                    hCCF->findSchemeMapping("tenant-b");
+            TS_ASSERT(vInfo->getSchemeName()->equals("tenant-b"));
+
+            // the last matching wildcard in document order applies, rather
+            // than the longest, and its suffix is substituted for "*"
+            vInfo = hCCF->findSchemeMapping("tenant-xyz");
+            TS_ASSERT(vInfo->getSchemeName()->equals("tenant"));
+            TS_ASSERT(vInfo->getAttributes()->get(String::create("name"))->equals(
+                    String::create("t-xyz-x")));
+            TS_ASSERT(vInfo->getAttributes()->get(String::create("size"))->equals(
+                    String::create("10")));
+
+            vInfo = hCCF->findSchemeMapping("top");
+            TS_ASSERT(vInfo->getSchemeName()->equals("t"));
+
+            vInfo = hCCF->findSchemeMapping("other");
+            TS_ASSERT(vInfo->getSchemeName()->equals("default"));
+            TS_ASSERT(vInfo->getAttributes()->get(String::create("name"))->equals(
+                    String::create("all-other")));
+
+            // invalid wildcard patterns are reported once they match
+            TS_ASSERT_THROWS(hCCF->findSchemeMapping("bad-name"),
+                    IllegalArgumentException::View);
+
+            NamedCache::View vCache = hCCF->ensureCache("other");
+            TS_ASSERT(Class::getSimpleClassName(vCache)->equals("LocalNamedCache"));
+
+            // the "t" scheme is mapped but not defined
+            TS_ASSERT_THROWS(hCCF->ensureCache("top"), IllegalArgumentException::View);
+
+            hCCF->shutdown();
+            }
     };
@@ -0,0 +1,367 @@
+/*
+ * Copyright (c) 2000, 2026, Oracle and/or its affiliates.
+ *
+ * Licensed under the Universal Permissive License v 1.0 as shown at
+ * http://oss.oracle.com/licenses/upl.
+ */
+#include "cxxtest/TestSuite.h"
+
+#include "coherence/lang.ns"
+
+#include "coherence/net/cache/BundlingNamedCache.hpp"
+
+#include "coherence/util/AtomicCounter.hpp"
+#include "coherence/util/InvocableMap.hpp"
+#include "coherence/util/Map.hpp"
+#include "coherence/util/Set.hpp"
+#include "coherence/util/processor/AbstractProcessor.hpp"
+
+#include "private/coherence/net/cache/LocalNamedCache.hpp"
+
+using namespace coherence::lang;
+
+using coherence::net::NamedCache;
+using coherence::net::cache::AbstractBundler;
+using coherence::net::cache::BundlingNamedCache;
+using coherence::net::cache::LocalNamedCache;
+using coherence::util::AtomicCounter;
+using coherence::util::InvocableMap;
+using coherence::util::Map;
+using coherence::util::Set;
+using coherence::util::processor::AbstractProcessor;
+
+
+/**
+* Test Suite for the BundlingNamedCache.
+*/
+class BundlingNamedCacheTest : public CxxTest::TestSuite
+    {
+    class PutGetRunner
+        : public class_spec<PutGetRunner,
+            extends<Object>,
+            implements<Runnable> >
+        {
+        friend class factory<PutGetRunner>;
+
+        protected:
+            PutGetRunner(NamedCache::Handle hCache, int32_t nId)
+                : m_hCache(self(), hCache), m_nId(nId)
+                {
+                }
+
+        public:
+            virtual void run()
+                {
+                for (int32_t i = 0; i < 500; ++i)
+                    {
+                    Integer32::View vKey = Integer32::create(m_nId * 1000 + i);
+                    m_hCache->put(vKey, Integer32::create(i));
+                    TS_ASSERT(Integer32::create(i)->equals(m_hCache->get(vKey)));
+                    }
+                }
+
+        protected:
+            FinalHandle<NamedCache> m_hCache;
+            int32_t m_nId;
+        };
+
+    /**
+    * EntryProcessor which increments an Integer32 value, optionally failing
+    * instead, and counts its processAll calls.
+    */
+    class IncrementProcessor
+        : public class_spec<IncrementProcessor,
+            extends<AbstractProcessor> >
+        {
+        friend class factory<IncrementProcessor>;
+
+        protected:
+            IncrementProcessor(bool fFail = false)
+                : f_hCountCalls(self(), AtomicCounter::create()),
+                  f_hCountEntries(self(), AtomicCounter::create()),
+                  m_fFail(fFail)
+                {
+                }
+
+        public:
+            virtual Object::Holder process(InvocableMap::Entry::Handle hEntry) const
+                {
+                if (m_fFail)
+                    {
+                    COH_THROW (UnsupportedOperationException::create("fail"));
+                    }
+                Integer32::View vValue = cast<Integer32::View>(hEntry->getValue());
+                Integer32::View vNew   = Integer32::create(
+                        vValue == NULL ? 1 : vValue->getInt32Value() + 1);
+                hEntry->setValue(vNew);
+                return vNew;
+                }
+
+            virtual Map::View processAll(Set::View vSetEntries) const
+                {
+                f_hCountCalls->increment();
+                f_hCountEntries->increment(vSetEntries->size());
+                return super::processAll(vSetEntries);
+                }
+
+            int64_t getCallCount() const
+                {
+                return f_hCountCalls->getCount();
+                }
+
+            int64_t getEntryCount() const
+                {
+                return f_hCountEntries->getCount();
+                }
+
+        protected:
+            mutable FinalHandle<AtomicCounter> f_hCountCalls;
+            mutable FinalHandle<AtomicCounter> f_hCountEntries;
+            bool m_fFail;
+        };
+
+    /**
+    * Runnable which invokes an EntryProcessor against a key a number of
+    * times, recording the last result or the exception.
+    */
+    class InvokeRunner
+        : public class_spec<InvokeRunner,
+            extends<Object>,
+            implements<Runnable> >
+        {
+        friend class factory<InvokeRunner>;
+
+        protected:
+            InvokeRunner(NamedCache::Handle hCache, Object::View vKey,
+                    InvocableMap::EntryProcessor::Handle hAgent, int32_t cIters)
+                : f_hCache(self(), hCache), f_vKey(self(), vKey),
+                  f_hAgent(self(), hAgent), m_cIters(cIters),
+                  m_ohResult(self()), m_vException(self())
+                {
+                }
+
+        public:
+            virtual void run()
+                {
+                try
+                    {
+                    for (int32_t i = 0; i < m_cIters; ++i)
+                        {
+                        m_ohResult = f_hCache->invoke(f_vKey, f_hAgent);
+                        }
+                    }
+                catch (Exception::View e)
+                    {
+                    m_vException = e;
+                    }
+                }
+
+            Object::Holder getResult() const
+                {
+                return m_ohResult;
+                }
+
+            Exception::View getException() const
+                {
+                return m_vException;
+                }
+
+        protected:
+            FinalHandle<NamedCache> f_hCache;
+            FinalView<Object> f_vKey;
+            FinalHandle<InvocableMap::EntryProcessor> f_hAgent;
+            int32_t m_cIters;
+            MemberHolder<Object> m_ohResult;
+            MemberView<Exception> m_vException;
+        };
+
+    public:
+        /**
+        * Test concurrent put and get operations with bundles flushed as
+        * soon as the bundler is idle.
+        */
+        void testFlushOnIdle()
+            {
+            BundlingNamedCache::Handle hCache =
+                    BundlingNamedCache::create(LocalNamedCache::create());
+            AbstractBundler::Handle hPut = hCache->ensurePutBundler(10);
+            AbstractBundler::Handle hGet = hCache->ensureGetBundler(10);
+
+            hPut->setFlushOnIdle(true);
+            hGet->setFlushOnIdle(true);
+            TS_ASSERT(hPut->isFlushOnIdle());
+            TS_ASSERT(hGet->isFlushOnIdle());
+
+            Thread::Handle ahThread[4];
+            for (int32_t i = 0; i < 4; ++i)
+                {
+                ahThread[i] = Thread::create(PutGetRunner::create(hCache, i));
+                ahThread[i]->start();
+                }
+            for (int32_t i = 0; i < 4; ++i)
+                {
+                ahThread[i]->join();
+                }
+
+            TS_ASSERT(hCache->size() == 4 * 500);
+            TS_ASSERT(hPut->getInFlightCount() == 0);
+            TS_ASSERT(hGet->getInFlightCount() == 0);
+            }
+    
+        /**
+        * Test that invoke requests sharing an EntryProcessor are executed
+        * by a single invokeAll, and that requests for different
+        * EntryProcessors share a bundle but are invoked separately.
+        */
+        void testInvokeBundling()
+            {
+            BundlingNamedCache::Handle hCache =
+                    BundlingNamedCache::create(LocalNamedCache::create());
+            AbstractBundler::Handle hInvoke = hCache->ensureInvokeBundler(2);
+            TS_ASSERT(hCache->getInvokeBundler() == hInvoke);
+
+            // the bundle is flushed by the size threshold, not the delay
+            hInvoke->setDelayMillis(60000);
+
+            IncrementProcessor::Handle hAgent = IncrementProcessor::create();
+            runInvokes(hCache, Integer32::create(1), hAgent,
+                    Integer32::create(2), hAgent);
+            TS_ASSERT_EQUALS(hAgent->getCallCount(), 1);
+            TS_ASSERT_EQUALS(hAgent->getEntryCount(), 2);
+            TS_ASSERT(Integer32::create(1)->equals(hCache->get(Integer32::create(1))));
+            TS_ASSERT(Integer32::create(1)->equals(hCache->get(Integer32::create(2))));
+
+            IncrementProcessor::Handle hAgent1 = IncrementProcessor::create();
+            IncrementProcessor::Handle hAgent2 = IncrementProcessor::create();
+            runInvokes(hCache, Integer32::create(1), hAgent1,
+                    Integer32::create(2), hAgent2);
+            TS_ASSERT_EQUALS(hAgent1->getCallCount(), 1);
+            TS_ASSERT_EQUALS(hAgent1->getEntryCount(), 1);
+            TS_ASSERT_EQUALS(hAgent2->getCallCount(), 1);
+            TS_ASSERT_EQUALS(hAgent2->getEntryCount(), 1);
+            TS_ASSERT(Integer32::create(2)->equals(hCache->get(Integer32::create(1))));
+            TS_ASSERT(Integer32::create(2)->equals(hCache->get(Integer32::create(2))));
+            }
+
+        /**
+        * Test that a failing bundled invocation is reported to the requests
+        * of its own EntryProcessor only.
+        */
+        void testInvokeBundlingFailure()
+            {
+            BundlingNamedCache::Handle hCache =
+                    BundlingNamedCache::create(LocalNamedCache::create());
+            hCache->ensureInvokeBundler(2)->setDelayMillis(60000);
+
+            IncrementProcessor::Handle hFail  = IncrementProcessor::create(true);
+            IncrementProcessor::Handle hAgent = IncrementProcessor::create();
+
+            InvokeRunner::Handle hRunFail = InvokeRunner::create(hCache,
+                    Integer32::create(1), hFail, 1);
+            InvokeRunner::Handle hRunOk   = InvokeRunner::create(hCache,
+                    Integer32::create(2), hAgent, 1);
+            runAll(hRunFail, hRunOk);
+
+            TS_ASSERT(instanceof<UnsupportedOperationException::View>(hRunFail->getException()));
+            TS_ASSERT(NULL == hRunOk->getException());
+            TS_ASSERT(Integer32::create(1)->equals(hRunOk->getResult()));
+            TS_ASSERT_EQUALS(hFail->getCallCount(), 1);
+            TS_ASSERT(!hCache->containsKey(Integer32::create(1)));
+            }
+
+        /**
+        * Test that concurrent invoke requests against the same entry are
+        * each executed, whether or not they are bundled.
+        */
+        void testInvokeSameKey()
+            {
+            BundlingNamedCache::Handle hCache =
+                    BundlingNamedCache::create(LocalNamedCache::create());
+            hCache->ensureInvokeBundler(10);
+
+            IncrementProcessor::Handle hAgent = IncrementProcessor::create();
+            Integer32::View            vKey   = Integer32::create(0);
+
+            InvokeRunner::Handle ahRun[4];
+            Thread::Handle       ahThread[4];
+            for (int32_t i = 0; i < 4; ++i)
+                {
+                ahRun[i]    = InvokeRunner::create(hCache, vKey, hAgent, 100);
+                ahThread[i] = Thread::create(ahRun[i]);
+                ahThread[i]->start();
+                }
+            for (int32_t i = 0; i < 4; ++i)
+                {
+                ahThread[i]->join();
+                TS_ASSERT(NULL == ahRun[i]->getException());
+                }
+
+            TS_ASSERT(Integer32::create(400)->equals(hCache->get(vKey)));
+            }
+
+        /**
+        * Test the microsecond delay accessors and concurrent put and get
+        * operations with a sub-millisecond delay.
+        */
+        void testDelayMicros()
+            {
+            BundlingNamedCache::Handle hCache =
+                    BundlingNamedCache::create(LocalNamedCache::create());
+            AbstractBundler::Handle hPut = hCache->ensurePutBundler(10);
+            AbstractBundler::Handle hGet = hCache->ensureGetBundler(10);
+
+            TS_ASSERT_EQUALS(hPut->getDelayMicros(), 1000);
+            hPut->setDelayMillis(3);
+            TS_ASSERT_EQUALS(hPut->getDelayMicros(), 3000);
+
+            hPut->setDelayMicros(250);
+            hGet->setDelayMicros(250);
+            TS_ASSERT_EQUALS(hPut->getDelayMicros(), 250);
+            TS_ASSERT_EQUALS(hPut->getDelayMillis(), 1);
+            TS_ASSERT_THROWS(hPut->setDelayMicros(0), IllegalArgumentException::View);
+
+            Thread::Handle ahThread[4];
+            for (int32_t i = 0; i < 4; ++i)
+                {
+                ahThread[i] = Thread::create(PutGetRunner::create(hCache, i));
+                ahThread[i]->start();
+                }
+            for (int32_t i = 0; i < 4; ++i)
+                {
+                ahThread[i]->join();
+                }
+
+            TS_ASSERT(hCache->size() == 4 * 500);
+            }
+
+    protected:
+        /**
+        * Invoke the given EntryProcessors concurrently, once each.
+        */
+        static void runInvokes(NamedCache::Handle hCache,
+                Object::View vKey1, InvocableMap::EntryProcessor::Handle hAgent1,
+                Object::View vKey2, InvocableMap::EntryProcessor::Handle hAgent2)
+            {
+            InvokeRunner::Handle hRun1 = InvokeRunner::create(hCache, vKey1, hAgent1, 1);
+            InvokeRunner::Handle hRun2 = InvokeRunner::create(hCache, vKey2, hAgent2, 1);
+            runAll(hRun1, hRun2);
+
+            TS_ASSERT(NULL == hRun1->getException());
+            TS_ASSERT(NULL == hRun2->getException());
+            TS_ASSERT(hCache->get(vKey1)->equals(hRun1->getResult()));
+            TS_ASSERT(hCache->get(vKey2)->equals(hRun2->getResult()));
+            }
+
+        /**
+        * Run the given Runnables on their own threads and wait for them.
+        */
+        static void runAll(Runnable::Handle hRun1, Runnable::Handle hRun2)
+            {
+            Thread::Handle hThread1 = Thread::create(hRun1);
+            Thread::Handle hThread2 = Thread::create(hRun2);
+            hThread1->start();
+            hThread2->start();
+            hThread1->join();
+            hThread2->join();
+            }
+    };
@@ -10,18 +10,37 @@
 
 #include "mock/CommonMocks.hpp"
 
+#include "coherence/io/pof/SystemPofContext.hpp"
+
 #include "coherence/util/ArrayList.hpp"
+#include "coherence/util/Binary.hpp"
 #include "coherence/util/Collections.hpp"
+#include "coherence/util/ConverterCollections.hpp"
 #include "coherence/util/HashSet.hpp"
+#include "coherence/util/NullImplementation.hpp"
+
+#include "coherence/util/extractor/IdentityExtractor.hpp"
 
 #include "coherence/util/filter/AlwaysFilter.hpp"
 
 #include "coherence/net/cache/ContinuousQueryCache.hpp"
+#include "coherence/net/cache/WrapperNamedCache.hpp"
 
+#include "private/coherence/component/net/extend/RemoteNamedCache.hpp"
+#include "private/coherence/net/cache/LocalNamedCache.hpp"
+
+using coherence::component::net::extend::RemoteNamedCache;
+using coherence::io::pof::SystemPofContext;
 using coherence::net::cache::ContinuousQueryCache;
+using coherence::net::cache::LocalNamedCache;
+using coherence::net::cache::WrapperNamedCache;
 using coherence::util::ArrayList;
+using coherence::util::Binary;
+using coherence::util::ConverterCollections;
 using coherence::util::Filter;
 using coherence::util::HashSet;
+using coherence::util::NullImplementation;
+using coherence::util::extractor::IdentityExtractor;
 using coherence::util::filter::AlwaysFilter;
 
 namespace
@@ -36,6 +55,95 @@ namespace
 
 class ContinuousQueryCacheTest : public CxxTest::TestSuite
     {
+    /**
+    * NamedCache which counts the keys passed to getAll, and the queries and
+    * getAll requests made against it.
+    */
+    class CountingCache
+        : public class_spec<CountingCache,
+            extends<WrapperNamedCache> >
+        {
+        friend class factory<CountingCache>;
+
+        protected:
+            CountingCache(NamedCache::Handle hCache)
+                : super(hCache), m_cKeys(0), m_cGetAll(0), m_cKeySet(0),
+                  m_cEntrySet(0)
+                {
+                }
+
+        public:
+            virtual Map::View getAll(Collection::View vKeys) const
+                {
+                m_cKeys += vKeys->size();
+                ++m_cGetAll;
+                return super::getAll(vKeys);
+                }
+
+            virtual Set::View keySet(Filter::View vFilter) const
+                {
+                ++m_cKeySet;
+                return super::keySet(vFilter);
+                }
+
+            virtual Set::View entrySet(Filter::View vFilter) const
+                {
+                ++m_cEntrySet;
+                return super::entrySet(vFilter);
+                }
+
+            mutable size32_t m_cKeys;
+            mutable size32_t m_cGetAll;
+            mutable size32_t m_cKeySet;
+            mutable size32_t m_cEntrySet;
+        };
+
+    /**
+    * IdentityExtractor which, like most extractors, cannot extract from a
+    * NULL target.
+    */
+    class NonNullExtractor
+        : public class_spec<NonNullExtractor,
+            extends<IdentityExtractor> >
+        {
+        friend class factory<NonNullExtractor>;
+
+        public:
+            virtual Object::Holder extract(Object::Holder ohTarget) const
+                {
+                COH_ENSURE_PARAM(ohTarget);
+                return ohTarget;
+                }
+        };
+
+    /**
+    * ContinuousQueryCache exposing its internals to the tests.
+    */
+    class ExposedCache
+        : public class_spec<ExposedCache,
+            extends<ContinuousQueryCache> >
+        {
+        friend class factory<ExposedCache>;
+
+        protected:
+            ExposedCache(NamedCache::Handle hCache)
+                : super(hCache, AlwaysFilter::getInstance(), true)
+                {
+                }
+
+        public:
+            void resync(NamedCache::Handle hCache)
+                {
+                resynchronizeInternalCache(ensureInternalCache(), hCache,
+                        getFilter());
+                }
+
+            ObservableMap::Handle exposeInternalCache()
+                {
+                return getInternalCache();
+                }
+        };
+
     public:
 
     void testGetCache()
@@ -239,6 +347,286 @@ class ContinuousQueryCacheTest : public CxxTest::TestSuite
         }
 
 
+    void testPagedPopulation()
+        {
+        NamedCache::Handle hCache = LocalNamedCache::create();
+        for (int32_t i = 0; i < 25; ++i)
+            {
+            hCache->put(Integer32::create(i), Integer32::create(i * 10));
+            }
+
+        // 25 entries in pages of 4
+        CountingCache::Handle hCounting = CountingCache::create(hCache);
+        System::setProperty("coherence.cqc.page.size", "4");
+        ContinuousQueryCache::Handle hCqc = ContinuousQueryCache::create(
+                hCounting, AlwaysFilter::getInstance(), true);
+        System::clearProperty("coherence.cqc.page.size");
+
+        TS_ASSERT(hCqc->getPageSize() == 4);
+        TS_ASSERT(hCqc->size() == 25);
+        TS_ASSERT(hCounting->m_cKeySet == 1);
+        TS_ASSERT(hCounting->m_cEntrySet == 0);
+        TS_ASSERT(hCounting->m_cGetAll == 7);
+        for (int32_t i = 0; i < 25; ++i)
+            {
+            TS_ASSERT(hCqc->get(Integer32::create(i))->equals(
+                    Integer32::create(i * 10)));
+            }
+
+        // switching from keys to values also loads in pages
+        hCqc = ContinuousQueryCache::create(hCache, AlwaysFilter::getInstance(),
+                false);
+        hCqc->setPageSize(3);
+        hCqc->setCacheValues(true);
+        TS_ASSERT(hCqc->size() == 25);
+        TS_ASSERT(hCqc->get(Integer32::create(24))->equals(
+                Integer32::create(240)));
+        }
+
+    void testUnpagedPopulation()
+        {
+        NamedCache::Handle hCache = LocalNamedCache::create();
+        for (int32_t i = 0; i < 25; ++i)
+            {
+            hCache->put(Integer32::create(i), Integer32::create(i * 10));
+            }
+
+        // without paging the query result is retrieved in one request
+        CountingCache::Handle hCounting = CountingCache::create(hCache);
+        ContinuousQueryCache::Handle hCqc = ContinuousQueryCache::create(
+                hCounting, AlwaysFilter::getInstance(), true);
+
+        TS_ASSERT(hCqc->getPageSize() == 0);
+        TS_ASSERT(hCqc->size() == 25);
+        TS_ASSERT(hCqc->get(Integer32::create(7))->equals(Integer32::create(70)));
+        TS_ASSERT(hCounting->m_cEntrySet == 1);
+        TS_ASSERT(hCounting->m_cKeySet == 0);
+        TS_ASSERT(hCounting->m_cGetAll == 0);
+        }
+
+    void testDefaultPageSize()
+        {
+        NamedCache::Handle hCache = LocalNamedCache::create();
+        hCache->put(Integer32::create(1), Integer32::create(10));
+
+        // paging is opt-in
+        System::clearProperty("coherence.cqc.page.size");
+        ContinuousQueryCache::Handle hCqc = ContinuousQueryCache::create(
+                hCache, AlwaysFilter::getInstance(), true);
+        TS_ASSERT(hCqc->getPageSize() == 0);
+        TS_ASSERT(hCqc->size() == 1);
+
+        // an unparsable value is ignored rather than failing construction
+        System::setProperty("coherence.cqc.page.size", "lots");
+        hCqc = ContinuousQueryCache::create(hCache,
+                AlwaysFilter::getInstance(), true);
+        TS_ASSERT(hCqc->getPageSize() == 0);
+        TS_ASSERT(hCqc->size() == 1);
+
+        System::setProperty("coherence.cqc.page.size", " 7 ");
+        hCqc = ContinuousQueryCache::create(hCache,
+                AlwaysFilter::getInstance(), true);
+        TS_ASSERT(hCqc->getPageSize() == 7);
+
+        System::setProperty("coherence.cqc.page.size", "-5");
+        hCqc = ContinuousQueryCache::create(hCache,
+                AlwaysFilter::getInstance(), true);
+        TS_ASSERT(hCqc->getPageSize() == 0);
+        System::clearProperty("coherence.cqc.page.size");
+        }
+
+    void testIncrementalResync()
+        {
+        NamedCache::Handle hCache = LocalNamedCache::create();
+        NamedCache::Handle hCacheNew = LocalNamedCache::create();
+        for (int32_t i = 0; i < 5; ++i)
+            {
+            hCache->put(Integer32::create(i), Integer32::create(i * 10));
+            hCacheNew->put(Integer32::create(i), Integer32::create(i * 10));
+            }
+        hCacheNew->put(Integer32::create(0), Integer32::create(99));
+        hCacheNew->remove(Integer32::create(1));
+        hCacheNew->put(Integer32::create(5), Integer32::create(50));
+
+        ExposedCache::Handle hCqc = ExposedCache::create(hCache);
+        hCqc->setVersionExtractor(IdentityExtractor::getInstance());
+
+        CountingCache::Handle hCounting = CountingCache::create(hCacheNew);
+        hCqc->resync(hCounting);
+
+        // only the updated and inserted entries were retrieved
+        TS_ASSERT(hCounting->m_cKeys == 2);
+        TS_ASSERT(hCqc->size() == 5);
+        TS_ASSERT(!hCqc->containsKey(Integer32::create(1)));
+        TS_ASSERT(hCqc->get(Integer32::create(0))->equals(Integer32::create(99)));
+        TS_ASSERT(hCqc->get(Integer32::create(3))->equals(Integer32::create(30)));
+        TS_ASSERT(hCqc->get(Integer32::create(5))->equals(Integer32::create(50)));
+        }
+
+    void testIncrementalResyncNullValue()
+        {
+        NamedCache::Handle hCache    = LocalNamedCache::create();
+        NamedCache::Handle hCacheNew = LocalNamedCache::create();
+        hCache->put(Integer32::create(1), Integer32::create(10));
+        hCache->put(Integer32::create(2), NULL);
+        hCacheNew->put(Integer32::create(1), Integer32::create(10));
+        hCacheNew->put(Integer32::create(2), Integer32::create(20));
+
+        ExposedCache::Handle hCqc = ExposedCache::create(hCache);
+        hCqc->setVersionExtractor(NonNullExtractor::create());
+
+        // the NULL local value is fetched again rather than extracted from
+        CountingCache::Handle hCounting = CountingCache::create(hCacheNew);
+        hCqc->resync(hCounting);
+
+        TS_ASSERT(hCounting->m_cKeys == 1);
+        TS_ASSERT(hCqc->get(Integer32::create(2))->equals(Integer32::create(20)));
+        }
+
+    void testBinaryStorage()
+        {
+        NamedCache::Handle hCache = LocalNamedCache::create();
+        for (int32_t i = 0; i < 5; ++i)
+            {
+            hCache->put(Integer32::create(i), COH_TO_STRING("value-" << i));
+            }
+
+        System::setProperty("coherence.cqc.storage", "binary");
+        System::setProperty("coherence.cqc.storage.decoded", "2");
+        ExposedCache::Handle hCqc = ExposedCache::create(hCache);
+        System::clearProperty("coherence.cqc.storage");
+        System::clearProperty("coherence.cqc.storage.decoded");
+
+        TS_ASSERT(hCqc->isBinaryStorage());
+        TS_ASSERT(hCqc->size() == 5);
+
+        // values are held in serialized form
+        ObservableMap::View vMapRaw = cast<ConverterCollections::
+                ConverterObservableMap::View>(hCqc->exposeInternalCache())
+                ->getObservableMap();
+        TS_ASSERT(instanceof<Binary::View>(vMapRaw->get(Integer32::create(3))));
+
+        // and decoded on access, including after an update
+        TS_ASSERT(hCqc->get(Integer32::create(3))->equals(
+                String::create("value-3")));
+        hCache->put(Integer32::create(3), String::create("updated"));
+        TS_ASSERT(hCqc->get(Integer32::create(3))->equals(
+                String::create("updated")));
+        TS_ASSERT(hCqc->get(Integer32::create(4))->equals(
+                String::create("value-4")));
+        }
+
+    void testBinaryStorageDecodedValues()
+        {
+        NamedCache::Handle hCache = LocalNamedCache::create();
+        hCache->put(Integer32::create(1), String::create("same"));
+        hCache->put(Integer32::create(2), String::create("same"));
+
+        System::setProperty("coherence.cqc.storage", "binary");
+        System::setProperty("coherence.cqc.storage.decoded", "4");
+        ExposedCache::Handle hCqc = ExposedCache::create(hCache);
+
+        // a retained value is reused for its own entry, but entries with
+        // equal serialized values do not share it
+        Object::Holder oh1 = hCqc->get(Integer32::create(1));
+        Object::Holder oh2 = hCqc->get(Integer32::create(2));
+        TS_ASSERT(oh1->equals(oh2));
+        TS_ASSERT(oh1 != oh2);
+        TS_ASSERT(hCqc->get(Integer32::create(1)) == oh1);
+        TS_ASSERT(hCqc->get(Integer32::create(2)) == oh2);
+
+        // an unparsable count disables retention rather than failing
+        System::setProperty("coherence.cqc.storage.decoded", "some");
+        ExposedCache::Handle hCqcUnparsed = ExposedCache::create(hCache);
+        System::clearProperty("coherence.cqc.storage");
+        System::clearProperty("coherence.cqc.storage.decoded");
+
+        TS_ASSERT(hCqcUnparsed->isBinaryStorage());
+        Object::Holder oh = hCqcUnparsed->get(Integer32::create(1));
+        TS_ASSERT(oh->equals(String::create("same")));
+        TS_ASSERT(hCqcUnparsed->get(Integer32::create(1)) != oh);
+
+        // a retained value does not keep a replaced Binary alive
+        ObservableMap::View vMapRaw = cast<ConverterCollections::
+                ConverterObservableMap::View>(hCqc->exposeInternalCache())
+                ->getObservableMap();
+        WeakReference::View vRef = WeakReference::valueOf(
+                vMapRaw->get(Integer32::create(1)));
+        TS_ASSERT(vRef->get() != NULL);
+        hCache->put(Integer32::create(1), String::create("changed"));
+        TS_ASSERT(vRef->get() == NULL);
+        TS_ASSERT(hCqc->get(Integer32::create(1))->equals(
+                String::create("changed")));
+        }
+
+    void testSetBinaryStorage()
+        {
+        NamedCache::Handle hCache = LocalNamedCache::create();
+        for (int32_t i = 0; i < 5; ++i)
+            {
+            hCache->put(Integer32::create(i), COH_TO_STRING("value-" << i));
+            }
+
+        System::clearProperty("coherence.cqc.storage");
+        ExposedCache::Handle hCqc = ExposedCache::create(hCache);
+        TS_ASSERT(!hCqc->isBinaryStorage());
+
+        // switching the storage mode reloads the internal cache
+        hCqc->setBinaryStorage(true);
+        TS_ASSERT(hCqc->isBinaryStorage());
+        TS_ASSERT(hCqc->size() == 5);
+        ObservableMap::View vMapRaw = cast<ConverterCollections::
+                ConverterObservableMap::View>(hCqc->exposeInternalCache())
+                ->getObservableMap();
+        TS_ASSERT(instanceof<Binary::View>(vMapRaw->get(Integer32::create(2))));
+        TS_ASSERT(hCqc->get(Integer32::create(2))->equals(
+                String::create("value-2")));
+
+        // and remains connected to the underlying cache
+        hCache->put(Integer32::create(2), String::create("updated"));
+        TS_ASSERT(hCqc->get(Integer32::create(2))->equals(
+                String::create("updated")));
+
+        // but is refused once a listener has been added
+        hCqc->addMapListener(MockMapListener::create());
+        TS_ASSERT_THROWS(hCqc->setBinaryStorage(false),
+                IllegalStateException::View);
+        TS_ASSERT(hCqc->isBinaryStorage());
+        }
+
+    void testBinaryStorageReceivedValues()
+        {
+        // the underlying cache exchanges values with its store in serialized
+        // form, as a RemoteNamedCache does with its proxy
+        RemoteNamedCache::ConverterFromBinary::Handle hConvUp =
+                RemoteNamedCache::ConverterFromBinary::create();
+        RemoteNamedCache::ConverterValueToBinary::Handle hConvDown =
+                RemoteNamedCache::ConverterValueToBinary::create();
+        hConvUp->setSerializer(SystemPofContext::getInstance());
+        hConvDown->setSerializer(SystemPofContext::getInstance());
+
+        NamedCache::Handle hCacheStore = LocalNamedCache::create();
+        Converter::View    vConvNull   = NullImplementation::getConverter();
+        NamedCache::Handle hCache      =
+                ConverterCollections::ConverterNamedCache::create(hCacheStore,
+                    ConverterCollections::EntryConverter::create(vConvNull, hConvUp),
+                    ConverterCollections::EntryConverter::create(vConvNull, hConvDown));
+
+        System::setProperty("coherence.cqc.storage", "binary");
+        ExposedCache::Handle hCqc = ExposedCache::create(hCache);
+        System::clearProperty("coherence.cqc.storage");
+
+        // an event value is stored as received rather than re-serialized
+        hCache->put(Integer32::create(1), String::create("one"));
+        ObservableMap::View vMapRaw = cast<ConverterCollections::
+                ConverterObservableMap::View>(hCqc->exposeInternalCache())
+                ->getObservableMap();
+        TS_ASSERT(vMapRaw->get(Integer32::create(1)) ==
+                hCacheStore->get(Integer32::create(1)));
+        TS_ASSERT(hCqc->get(Integer32::create(1))->equals(
+                String::create("one")));
+        }
+
     void testGetPutWithCacheValues()
         {
 /*
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2000, 2026, Oracle and/or its affiliates.
+ *
+ * Licensed under the Universal Permissive License v 1.0 as shown at
+ * http://oss.oracle.com/licenses/upl.
+ */
+#include "cxxtest/TestSuite.h"
+#include "coherence/lang.ns"
+
+#include "coherence/io/IOException.hpp"
+#include "private/coherence/run/xml/FastXmlParser.hpp"
+#include "private/coherence/run/xml/SimpleParser.hpp"
+#include <fstream>
+#include <sstream>
+#include <stdlib.h>
+
+using namespace coherence::lang;
+using namespace coherence::run::xml;
+using coherence::io::IOException;
+
+
+COH_PRAGMA_PUSH // Windows generates warnings related to use of env variables
+/**
+* Test Suite for FastXmlParser
+*/
+class FastXmlParserTestSuite : public CxxTest::TestSuite
+    {
+    public:
+        /**
+        * Assert that FastXmlParser and SimpleParser produce the same
+        * document for the specified XML.
+        */
+        static void assertSameAsSimple(String::View vsXml)
+            {
+            XmlDocument::View vXmlSimple = SimpleParser::create()->parseXml(vsXml);
+            XmlDocument::View vXmlFast   = FastXmlParser::create()->parseXml(vsXml);
+
+            TS_ASSERT(vXmlFast->equals(vXmlSimple));
+            TS_ASSERT(vXmlFast->getXml()->equals(vXmlSimple->getXml()));
+            }
+
+        void testParseXml()
+            {
+            std::stringstream xmlScriptPath;
+            xmlScriptPath << getenv ("DEV_ROOT") << "/tests/unit/resource/tangosol-coherence-2.xml";
+
+            std::fstream filestr(xmlScriptPath.str().c_str(), std::fstream::in);
+            XmlDocument::Handle hXmlFast = FastXmlParser::create()->parseXml(filestr);
+            filestr.close();
+
+            std::fstream filestr2(xmlScriptPath.str().c_str(), std::fstream::in);
+            XmlDocument::Handle hXmlSimple = SimpleParser::create()->parseXml(filestr2);
+            filestr2.close();
+
+            TS_ASSERT(hXmlFast->equals(hXmlSimple));
+            TS_ASSERT(hXmlFast->getXml()->equals(hXmlSimple->getXml()));
+
+            // round trip
+            assertSameAsSimple(hXmlFast->getXml());
+            }
+
+        void testParseXmlString()
+            {
+            assertSameAsSimple("<root/>");
+            assertSameAsSimple("<root>value</root>");
+            assertSameAsSimple(
+                    "<?xml version='1.0' encoding=\"UTF-8\" standalone='yes'?>\n"
+                    "<!-- document comment -->\n"
+                    "<!-- second comment -->\n"
+                    "<root a=\"1\" b='two &amp; three'>\n"
+                    "  <!-- element comment -->\n"
+                    "  <child-1 x='y'/>\n"
+                    "  <child-1>  text &lt;value&gt;  </child-1>\n"
+                    "  <child.2><![CDATA[ <raw> & data ]]></child.2>\n"
+                    "  <?ignored instruction?>\n"
+                    "  <nested><a><b>deep</b></a></nested >\n"
+                    "  mixed content\n"
+                    "</root>\n"
+                    "<!-- trailing -->\n");
+            }
+
+        void testParseDoctype()
+            {
+            assertSameAsSimple(
+                    "<!DOCTYPE root PUBLIC \"-//Test//DTD Test//EN\" \"test.dtd\">"
+                    "<root><a>1</a></root>");
+            assertSameAsSimple(
+                    "<!DOCTYPE root SYSTEM 'test.dtd' [ <!ELEMENT root ANY> ]>"
+                    "<root/>");
+
+            XmlDocument::View vXml = FastXmlParser::create()->parseXml(
+                    "<!DOCTYPE root SYSTEM 'test.dtd'><root/>");
+            TS_ASSERT(vXml->getDtdUri()->equals("test.dtd"));
+            }
+
+        void testParseXmlWithError()
+            {
+            FastXmlParser::Handle hParser = FastXmlParser::create();
+
+            TS_ASSERT_THROWS(hParser->parseXml("Invalid XML<element>value</element>"),
+                    RuntimeException::View);
+            TS_ASSERT_THROWS(hParser->parseXml("<a><b></a>"),
+                    RuntimeException::View);
+            TS_ASSERT_THROWS(hParser->parseXml("<a>unterminated"),
+                    RuntimeException::View);
+            TS_ASSERT_THROWS(hParser->parseXml("<a x=1/>"),
+                    RuntimeException::View);
+            TS_ASSERT_THROWS(hParser->parseXml("<a><?xml version='1.0'?></a>"),
+                    RuntimeException::View);
+            TS_ASSERT_THROWS(hParser->parseXml("<?xml encoding='UTF-8'?><a/>"),
+                    RuntimeException::View);
+            TS_ASSERT_THROWS(hParser->parseXml("<!DOCTYPE b><a/>"),
+                    RuntimeException::View);
+
+            // the parser is reusable after an error
+            TS_ASSERT(hParser->parseXml("<a>1</a>")->getString()->equals("1"));
+            }
+
+        void testParseXmlWithBadStream()
+            {
+            std::fstream filestr("!~!!~bogus.xml", std::fstream::in);
+            TS_ASSERT_THROWS(FastXmlParser::create()->parseXml(filestr),
+                    IOException::View);
+            }
+    };
+
+COH_PRAGMA_POP
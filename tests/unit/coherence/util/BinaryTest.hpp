@@ -6,6 +6,8 @@
  */
 #include "coherence/lang.ns"
 
+#include "coherence/io/OctetArrayReadBuffer.hpp"
+
 #include "coherence/util/Binary.hpp"
 #include "coherence/util/BinaryWriteBuffer.hpp"
 
@@ -13,6 +15,7 @@
 
 using namespace coherence::lang;
 
+using coherence::io::OctetArrayReadBuffer;
 using coherence::util::Binary;
 using coherence::util::BinaryWriteBuffer;
 
@@ -298,4 +301,32 @@ class BinaryTest : public CxxTest::TestSuite
             TS_ASSERT(vBin->getReadBuffer(1, 5)->toOctetArray()->equals(
                     vab->subArray(1, 6)));
             }
+
+        /**
+        * Test that a Binary extracted from a buffer over an immutable Array
+        * references a slice of that Array rather than a copy of it.
+        */
+        void testSlice()
+            {
+            Array<octet_t>::View vab = createByteArray(10, (octet_t) 7);
+
+            OctetArrayReadBuffer::View vBuf =
+                    OctetArrayReadBuffer::create(vab, 0, 10, false);
+            Binary::View vBin = vBuf->toBinary(2, 5);
+            TS_ASSERT(vBin->length() == 5);
+            TS_ASSERT(vBin->isImmutable());
+
+            const octet_t* abSlice = vBin->toOctetArray()->raw;
+            const octet_t* abOrig  = vab->raw;
+            TS_ASSERT(abSlice == abOrig + 2);
+
+            // a mutable source Array must still be copied
+            Array<octet_t>::Handle hab = createByteArray(10, (octet_t) 7);
+            vBuf    = OctetArrayReadBuffer::create(hab, 0, 10, false);
+            vBin    = vBuf->toBinary(2, 5);
+            abSlice = vBin->toOctetArray()->raw;
+            abOrig  = hab->raw;
+            TS_ASSERT(abSlice != abOrig + 2);
+            TS_ASSERT(vBin->equals(Binary::create(vab, 2, 5)));
+            }
     };
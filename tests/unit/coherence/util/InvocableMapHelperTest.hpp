@@ -8,15 +8,98 @@
 #include "cxxtest/TestSuite.h"
 #include "coherence/lang.ns"
 
+#include "coherence/util/HashSet.hpp"
 #include "coherence/util/SimpleMapIndex.hpp"
+#include "coherence/util/extractor/IdentityExtractor.hpp"
+#include "coherence/util/filter/EqualsFilter.hpp"
 #include "coherence/util/filter/GreaterFilter.hpp"
 
 #include "private/coherence/util/InvocableMapHelper.hpp"
 
 using namespace coherence::lang;
 using namespace coherence::util;
+using coherence::util::extractor::IdentityExtractor;
 using namespace coherence::util::filter;
 
+COH_OPEN_NAMESPACE_ANON(InvocableMapHelperTest)
+
+/**
+* Filter which records the threads it is evaluated on.
+*/
+class ThreadRecordingFilter
+    : public class_spec<ThreadRecordingFilter,
+        extends<Object>,
+        implements<Filter> >
+    {
+    friend class factory<ThreadRecordingFilter>;
+
+    protected:
+        ThreadRecordingFilter()
+            : f_hSetThread(self(), HashSet::create())
+            {
+            }
+
+    public:
+        virtual bool evaluate(Object::View v) const
+            {
+            COH_SYNCHRONIZED (this)
+                {
+                f_hSetThread->add(Thread::currentThread());
+                }
+            return cast<Integer32::View>(v)->getInt32Value() % 2 == 0;
+            }
+
+        size32_t getThreadCount() const
+            {
+            COH_SYNCHRONIZED (this)
+                {
+                return f_hSetThread->size();
+                }
+            }
+
+        ObjectArray::Handle getThreads() const
+            {
+            COH_SYNCHRONIZED (this)
+                {
+                return f_hSetThread->toArray();
+                }
+            }
+
+    protected:
+        mutable FinalHandle<Set> f_hSetThread;
+    };
+
+/**
+* Filter which runs a parallel query of its own for each value.
+*/
+class NestedQueryFilter
+    : public class_spec<NestedQueryFilter,
+        extends<Object>,
+        implements<Filter> >
+    {
+    friend class factory<NestedQueryFilter>;
+
+    protected:
+        NestedQueryFilter(Map::View vMap)
+            : f_vMap(self(), vMap)
+            {
+            }
+
+    public:
+        virtual bool evaluate(Object::View v) const
+            {
+            Set::View vSet = InvocableMapHelper::query(f_vMap, NULL,
+                    EqualsFilter::create(IdentityExtractor::create(), v),
+                    false, false, NULL);
+            return vSet->size() == 1;
+            }
+
+    protected:
+        FinalView<Map> f_vMap;
+    };
+
+COH_CLOSE_NAMESPACE_ANON
+
 /**
 * Test Suite for InvocableMapHelper.
 */
@@ -92,6 +175,118 @@ class InvocableMapHelperTest : public CxxTest::TestSuite
             TS_ASSERT(checkEntrySetValue(set, Integer32::create(5)));
             }
 
+        void testParallelQuery()
+            {
+            Map::Handle map = HashMap::create();
+            for (int32_t i = 0; i < 1000; ++i)
+                {
+                map->put(Integer32::create(i), Integer32::create(i));
+                }
+
+            size32_t cThreshold = InvocableMapHelper::getParallelQueryThreshold();
+            size32_t cThreads   = InvocableMapHelper::getParallelQueryThreads();
+            InvocableMapHelper::setParallelQueryThreshold(100);
+            InvocableMapHelper::setParallelQueryThreads(3);
+
+            Filter::View vFilter = GreaterFilter::create(
+                    IdentityExtractor::create(), Integer32::create(500));
+            Set::View setKeys = InvocableMapHelper::query(map, NULL, vFilter,
+                    false, false, NULL);
+            Set::View setEntries = InvocableMapHelper::query(map, NULL, vFilter,
+                    true, true, NULL);
+
+            InvocableMapHelper::setParallelQueryThreshold(cThreshold);
+            InvocableMapHelper::setParallelQueryThreads(cThreads);
+
+            TS_ASSERT(setKeys->size() == 499);
+            TS_ASSERT(setEntries->size() == 499);
+            for (int32_t i = 0; i < 1000; ++i)
+                {
+                TS_ASSERT(setKeys->contains(Integer32::create(i)) == (i > 500));
+                }
+            TS_ASSERT(checkEntrySetValue(setEntries, Integer32::create(501)));
+            TS_ASSERT(checkEntrySetValue(setEntries, Integer32::create(999)));
+            }
+
+        void testParallelQueryThreads()
+            {
+            Map::Handle map = HashMap::create();
+            for (int32_t i = 0; i < 1000; ++i)
+                {
+                map->put(Integer32::create(i), Integer32::create(i));
+                }
+
+            size32_t cThreshold = InvocableMapHelper::getParallelQueryThreshold();
+            size32_t cThreads   = InvocableMapHelper::getParallelQueryThreads();
+            InvocableMapHelper::setParallelQueryThreshold(100);
+            InvocableMapHelper::setParallelQueryThreads(3);
+
+            // repeated queries share the pooled threads rather than each
+            // starting threads of their own
+            ThreadRecordingFilter::Handle hFilter = ThreadRecordingFilter::create();
+            for (int32_t i = 0; i < 20; ++i)
+                {
+                TS_ASSERT(InvocableMapHelper::query(map, NULL, hFilter,
+                        false, false, NULL)->size() == 500);
+                }
+            size32_t cUsed = hFilter->getThreadCount();
+
+            // a query nested within a parallel evaluation can always be
+            // completed by its caller, even with every pool thread busy
+            Map::Handle mapSmall = HashMap::create();
+            for (int32_t i = 0; i < 200; ++i)
+                {
+                mapSmall->put(Integer32::create(i), Integer32::create(i));
+                }
+            Set::View setNested = InvocableMapHelper::query(mapSmall, NULL,
+                    NestedQueryFilter::create(mapSmall), false, false, NULL);
+
+            InvocableMapHelper::setParallelQueryThreshold(cThreshold);
+            InvocableMapHelper::setParallelQueryThreads(cThreads);
+
+            TS_ASSERT(cUsed >= 1 && cUsed <= 3);
+            TS_ASSERT(setNested->size() == 200);
+            }
+
+        void testShutdownParallelQueries()
+            {
+            Map::Handle map = HashMap::create();
+            for (int32_t i = 0; i < 1000; ++i)
+                {
+                map->put(Integer32::create(i), Integer32::create(i));
+                }
+
+            size32_t cThreshold = InvocableMapHelper::getParallelQueryThreshold();
+            size32_t cThreads   = InvocableMapHelper::getParallelQueryThreads();
+            InvocableMapHelper::setParallelQueryThreshold(100);
+            InvocableMapHelper::setParallelQueryThreads(3);
+
+            ThreadRecordingFilter::Handle hFilter = ThreadRecordingFilter::create();
+            for (int32_t i = 0; i < 20; ++i)
+                {
+                InvocableMapHelper::query(map, NULL, hFilter, false, false, NULL);
+                }
+
+            // shutting down waits for the pool threads to exit
+            InvocableMapHelper::shutdownParallelQueries();
+            ObjectArray::Handle haThread = hFilter->getThreads();
+            for (size32_t i = 0; i < haThread->length; ++i)
+                {
+                Thread::View vThread = cast<Thread::View>(haThread[i]);
+                TS_ASSERT(vThread == Thread::currentThread() || !vThread->isAlive());
+                }
+
+            // a later parallel query starts a new pool
+            Set::View setKeys = InvocableMapHelper::query(map, NULL,
+                    ThreadRecordingFilter::create(), false, false, NULL);
+            InvocableMapHelper::shutdownParallelQueries();
+
+            InvocableMapHelper::setParallelQueryThreshold(cThreshold);
+            InvocableMapHelper::setParallelQueryThreads(cThreads);
+
+            TS_ASSERT(setKeys->size() == 500);
+            }
+
         void testQueryWithIndex()
             {
             Map::Handle map = HashMap::create();
@@ -253,6 +253,32 @@ class LoggerTest : public CxxTest::TestSuite
                 }
             }
 
+        void testQueueLimit()
+            {
+            // the LogOutput takes ownership of its stream
+            mteststream = new ostringstream;
+
+            Logger::Handle hLogger = Logger::create();
+            cast<Standard::Handle>(hLogger->getLogOutput())->setOutputStream(mteststream);
+            hLogger->setLevel(Logger::level_all);
+            hLogger->setQueueLimit(2);
+
+            // not yet started, so nothing is drained
+            for (int32_t i = 0; i < 5; ++i)
+                {
+                hLogger->log(1, (String::View) COH_TO_STRING("QUEUED " << i),
+                        (ObjectArray::View) NULL);
+                }
+            TS_ASSERT(hLogger->getQueue()->size() == 2);
+            TS_ASSERT(hLogger->getDroppedCount() == 3);
+
+            hLogger->start();
+            TS_ASSERT(waitForMessage("QUEUED 1"));
+            TS_ASSERT(waitForMessage("dropped 3 log messages (limit=2)"));
+            TS_ASSERT(mteststream->str().find("QUEUED 2") == string::npos);
+            hLogger->shutdown();
+            }
+
         void testLifecycle()
             {
             Logger::Handle hLogger = Logger::getLogger();
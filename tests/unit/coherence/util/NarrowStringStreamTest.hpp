@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2000, 2026, Oracle and/or its affiliates.
+ *
+ * Licensed under the Universal Permissive License v 1.0 as shown at
+ * http://oss.oracle.com/licenses/upl.
+ */
+#include "cxxtest/TestSuite.h"
+
+#include "coherence/lang.ns"
+
+#include "private/coherence/util/NarrowStringStream.hpp"
+
+#include <string>
+
+using namespace coherence::lang;
+
+using coherence::util::NarrowStringStream;
+
+
+/**
+* Test Suite for the NarrowStringStream.
+*/
+class NarrowStringStreamTest : public CxxTest::TestSuite
+    {
+    public:
+        void testFormat()
+            {
+            String::View vs = COH_TO_STACK_STRING("value=" << 5 << ','
+                    << int64_t(-7) << ',' << Integer32::create(42) << ','
+                    << String::create("abc"));
+
+            TS_ASSERT(vs->equals("value=5,-7,42,abc"));
+            TS_ASSERT(vs->equals(COH_TO_STRING("value=" << 5 << ','
+                    << int64_t(-7) << ',' << Integer32::create(42) << ','
+                    << String::create("abc"))));
+            }
+
+        void testEmpty()
+            {
+            NarrowStringStream ss;
+            TS_ASSERT(ss.toString()->length() == 0);
+            }
+
+        void testOverflow()
+            {
+            NarrowStringStream ss;
+            std::string        s;
+            for (int32_t i = 0; i < 1000; ++i)
+                {
+                ss << i << ' ';
+                s += std::string(COH_TO_STRING(i << ' '));
+                }
+
+            // a single write larger than the fixed buffer
+            std::string sLarge(3 * NarrowStringStream::buffer_size, 'x');
+            ss << sLarge;
+            s += sLarge;
+
+            TS_ASSERT(ss.toString()->equals(String::create(s)));
+            }
+
+        void testUnicode()
+            {
+            String::View vsUnicode = String::create(L"caf\x00e9");
+            String::View vs        = COH_TO_STACK_STRING('[' << vsUnicode << ']');
+
+            TS_ASSERT(vs->equals(COH_TO_STRING('[' << vsUnicode << ']')));
+            TS_ASSERT(vs->length() == 6);
+            }
+    };
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2000, 2026, Oracle and/or its affiliates.
+ *
+ * Licensed under the Universal Permissive License v 1.0 as shown at
+ * http://oss.oracle.com/licenses/upl.
+ */
+#include "cxxtest/TestSuite.h"
+#include "coherence/lang.ns"
+
+#include "coherence/util/SingleConsumerQueue.hpp"
+
+using namespace coherence::lang;
+using namespace std;
+using coherence::util::SingleConsumerQueue;
+
+
+/**
+* Test Suite for the SingleConsumerQueue object.
+*/
+class SingleConsumerQueueTest : public CxxTest::TestSuite
+    {
+    class ProducerThread
+        : public class_spec<ProducerThread,
+            extends<Object>,
+            implements<Runnable> >
+        {
+        friend class factory<ProducerThread>;
+
+        protected:
+            ProducerThread(SingleConsumerQueue::Handle hQueue, int32_t nId)
+                : m_hQueue(self(), hQueue), m_nId(nId)
+                {
+                }
+
+        public:
+            virtual void run()
+                {
+                for (int32_t x = 0; x < 1024; ++x)
+                    {
+                    m_hQueue->add(Integer32::create(m_nId * 1024 + x));
+                    }
+                }
+
+        protected:
+            FinalHandle<SingleConsumerQueue> m_hQueue;
+            int32_t m_nId;
+        };
+
+    public:
+
+        void testAdd()
+            {
+            SingleConsumerQueue::Handle hQueue = SingleConsumerQueue::create();
+            String::Handle              hS     = String::create("TEST");
+            String::View                vS2    = String::create("TEST2");
+
+            TS_ASSERT(hQueue->isEmpty());
+            hQueue->add(hS);
+            hQueue->add(vS2);
+
+            TS_ASSERT(hQueue->size() == 2);
+            TS_ASSERT(hS == hQueue->peekNoWait());
+
+            // handles come back as handles, views as views
+            Object::Holder oh = hQueue->remove();
+            TS_ASSERT(hS == oh);
+            TS_ASSERT(is_handle(oh));
+
+            oh = hQueue->remove();
+            TS_ASSERT(vS2 == oh);
+            TS_ASSERT(!is_handle(oh));
+
+            TS_ASSERT(hQueue->isEmpty());
+            TS_ASSERT(NULL == hQueue->removeNoWait());
+            TS_ASSERT(NULL == hQueue->peekNoWait());
+            }
+
+        void testAddHead()
+            {
+            SingleConsumerQueue::Handle hQueue = SingleConsumerQueue::create();
+            String::Handle              hS     = String::create("TEST");
+            String::Handle              hS2    = String::create("TEST2");
+
+            hQueue->setBatchSize(2);
+            hQueue->add(hS);
+            hQueue->addHead(hS2);
+
+            TS_ASSERT(hQueue->size() == 2);
+            TS_ASSERT(hS2 == hQueue->remove());
+            TS_ASSERT(hS == hQueue->remove());
+            }
+
+        void testFlush()
+            {
+            SingleConsumerQueue::Handle hQueue = SingleConsumerQueue::create();
+            String::Handle              hS     = String::create("TEST");
+
+            hQueue->setBatchSize(10);
+            hQueue->add(hS);
+            TS_ASSERT(hQueue->getFlushState() == SingleConsumerQueue::flush_pending);
+
+            hQueue->flush();
+            TS_ASSERT(hQueue->getStatsFlushed() == 1);
+            TS_ASSERT(hQueue->getFlushState() == SingleConsumerQueue::flush_explicit);
+
+            TS_ASSERT(hQueue->remove() == hS);
+            TS_ASSERT(hQueue->getStatsEmptied() == 1);
+            }
+
+        void testRelease()
+            {
+            SingleConsumerQueue::Handle hQueue = SingleConsumerQueue::create();
+            String::Handle              hS     = String::create("TEST");
+            WeakReference::Handle       hRef   = hS->_attachWeak();
+
+            hQueue->add(hS);
+            hS     = NULL;
+            hQueue = NULL;
+
+            // the queue must not leak its remaining elements
+            TS_ASSERT(NULL == hRef->get());
+            }
+
+        void testProducerConsumer()
+            {
+            SingleConsumerQueue::Handle hQueue = SingleConsumerQueue::create();
+            Thread::Handle              ahThread[4];
+
+            for (int32_t i = 0; i < 4; ++i)
+                {
+                ahThread[i] = Thread::create(ProducerThread::create(hQueue, i));
+                ahThread[i]->start();
+                }
+
+            // elements from any one producer arrive in order
+            int32_t anLast[4] = {-1, -1, -1, -1};
+            for (int32_t c = 0; c < 4 * 1024; ++c)
+                {
+                int32_t n = cast<Integer32::View>(hQueue->remove())->getValue();
+                int32_t i = n / 1024;
+                TS_ASSERT(n % 1024 == anLast[i] + 1);
+                anLast[i] = n % 1024;
+                }
+
+            for (int32_t i = 0; i < 4; ++i)
+                {
+                ahThread[i]->join();
+                }
+            TS_ASSERT(hQueue->isEmpty());
+            }
+    };
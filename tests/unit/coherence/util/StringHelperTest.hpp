@@ -215,4 +215,24 @@ class StringHelperTest : public CxxTest::TestSuite
             lResult = StringHelper::parseMemorySize("1G");
             TS_ASSERT(lTest == lResult);
             }
+
+        void testGetCountProperty()
+            {
+            String::View vsName = "coherence.test.count";
+
+            System::clearProperty(vsName);
+            TS_ASSERT(StringHelper::getCountProperty(vsName) == 0);
+            TS_ASSERT(StringHelper::getCountProperty(vsName, 7) == 7);
+
+            System::setProperty(vsName, " 12 ");
+            TS_ASSERT(StringHelper::getCountProperty(vsName, 7) == 12);
+
+            System::setProperty(vsName, "-3");
+            TS_ASSERT(StringHelper::getCountProperty(vsName, 7) == 0);
+
+            System::setProperty(vsName, "many");
+            TS_ASSERT(StringHelper::getCountProperty(vsName, 7) == 7);
+
+            System::clearProperty(vsName);
+            }
     };
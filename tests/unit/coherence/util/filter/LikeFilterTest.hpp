@@ -10,6 +10,8 @@
 #include "coherence/util/extractor/IdentityExtractor.hpp"
 #include "coherence/util/filter/LikeFilter.hpp"
 
+#include <cctype>
+
 using namespace coherence::lang;
 
 using coherence::util::extractor::IdentityExtractor;
@@ -74,4 +76,92 @@ class LikeFilterSuite : public CxxTest::TestSuite
                         String::create("%GetLogonData_getAccountIndicativeInfoInput_7137B2C9070C4951AE00EE5C4F01435A%"));
             TS_ASSERT(hFilter->evaluate(String::create("xGetLogonDataxgetAccountIndicativeInfoInputx7137B2C9070C4951AE00EE5C4F01435Axxx")));
             }
+
+        /**
+        * Test each compiled plan against a reference matcher.
+        */
+        void testPlans()
+            {
+            const char* aachPattern[] =
+                {
+                "a", "abc", "a%", "abc%", "%c", "%abc", "%b%", "%abc%", "a_c",
+                "%a_c%", "_b%", "%b_", "a%c", "%a%c%", "ab%bc", "%%", "%", "_",
+                "%aa%", "%ab_%ba%"
+                };
+            const char* aachValue[] =
+                {
+                "", "a", "A", "abc", "ABC", "aBc", "xabcx", "aac", "abbc",
+                "abcbc", "bab", "ba", "aaab", "a%c", "xaXcx", "abab", "cba",
+                "zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzabcbazzzzzzzzzzzz"
+                };
+
+            for (size32_t i = 0; i < sizeof(aachPattern) / sizeof(char*); ++i)
+                {
+                for (size32_t j = 0; j < 2; ++j)
+                    {
+                    bool               fIgnoreCase = j == 1;
+                    LikeFilter::Handle hFilter     = LikeFilter::create(
+                            IdentityExtractor::getInstance(),
+                            String::create(aachPattern[i]), '\\', fIgnoreCase);
+
+                    for (size32_t k = 0; k < sizeof(aachValue) / sizeof(char*); ++k)
+                        {
+                        bool fExpect = like(aachPattern[i], aachValue[k],
+                                fIgnoreCase);
+                        if (hFilter->evaluate(String::create(aachValue[k])) != fExpect)
+                            {
+                            TS_FAIL(COH_TO_STRING("\"" << aachValue[k]
+                                    << "\" LIKE \"" << aachPattern[i]
+                                    << "\" (ignore case " << fIgnoreCase
+                                    << ") should be " << fExpect)
+                                    ->getCString());
+                            }
+                        }
+                    }
+                }
+            }
+
+    protected:
+        /**
+        * Reference LIKE matcher using '\\' as the escape character.
+        */
+        static bool like(const char* achPattern, const char* achValue,
+                bool fIgnoreCase)
+            {
+            char ch = *achPattern;
+            if (ch == '\0')
+                {
+                return *achValue == '\0';
+                }
+            if (ch == '%')
+                {
+                for (const char* pch = achValue; ; ++pch)
+                    {
+                    if (like(achPattern + 1, pch, fIgnoreCase))
+                        {
+                        return true;
+                        }
+                    if (*pch == '\0')
+                        {
+                        return false;
+                        }
+                    }
+                }
+            if (*achValue == '\0')
+                {
+                return false;
+                }
+            if (ch == '\\')
+                {
+                ch = *++achPattern;
+                }
+            else if (ch == '_')
+                {
+                return like(achPattern + 1, achValue + 1, fIgnoreCase);
+                }
+            bool fEqual = fIgnoreCase
+                    ? tolower(ch) == tolower(*achValue)
+                    : ch == *achValue;
+            return fEqual && like(achPattern + 1, achValue + 1, fIgnoreCase);
+            }
 	};